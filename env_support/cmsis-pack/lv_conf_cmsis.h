@@ -192,6 +192,10 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** If there are multiple draw units, max. number of draw tasks queued for each render thread.
+     *  More tasks can be dispatched at once but an idle thread might need to steal more often. */
+    #define LV_DRAW_SW_THREAD_QUEUE_SIZE    8
+
     /** Enable native helium assembly to be compiled. */
     #define LV_USE_NATIVE_HELIUM_ASM    0
 
@@ -201,10 +205,11 @@
     #define LV_DRAW_SW_COMPLEX          1
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /** Allow buffering some shadow calculation.
-         *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+        /** Size of the cache storing the blurred corners of the box shadows [bytes].
+         *  Shadows with the same width, radius and similar size share a corner
+         *  so they are blurred only once. A corner costs `2 * (shadow_width + radius)^2` bytes.
+         *  0: disable the cache */
+        #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0
 
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
@@ -81,6 +81,17 @@
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
+
+    /** Number of separate memory arenas for the threads other than the one calling `lv_init()`
+     *  (e.g. render and decoder threads). Each arena has its own lock, so these threads don't wait
+     *  for each other in `lv_malloc()`. The threads get the arenas in round-robin order and
+     *  fall back to the main pool when their arena is full. A block freed by another thread is
+     *  given back to its arena without locking (if the compiler has atomic builtins).
+     *  Requires `LV_USE_OS` and thread-local storage support in the compiler. 0: disable */
+    #define LV_MEM_THREAD_ARENA_CNT 0
+
+    /** Size of each thread arena. The arenas are taken from the end of `LV_MEM_SIZE`. */
+    #define LV_MEM_THREAD_ARENA_SIZE (32 * 1024U)     /**< [bytes] */
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -151,6 +162,19 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Divide the layers into a grid of `N x N` bins and keep a list of the draw tasks touching each bin.
+ * This way the dependency check of the draw tasks needs to look only at the draw tasks in the same bins
+ * instead of all the older draw tasks of the layer. Useful if there are hundreds or thousands of draw tasks.
+ * The bins are created only when a layer has at least `LV_DRAW_TASK_INDEX_MIN_TASK_CNT` draw tasks.
+ * Set to 0 to disable the draw task index. */
+#define LV_DRAW_TASK_INDEX_GRID_SIZE      8
+#define LV_DRAW_TASK_INDEX_MIN_TASK_CNT   32
+
+/** Size of an arena (bump allocator) per display for the draw tasks created while refreshing the display.
+ * It replaces the `lv_malloc`/`lv_free` pairs of each draw task and is reused after each refreshed area.
+ * If the arena is full `lv_malloc` is used. Set to 0 to always use `lv_malloc`. */
+#define LV_DRAW_ARENA_SIZE    0     /**< [bytes]*/
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -194,6 +218,15 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** If there are multiple draw units, max. number of draw tasks queued for each render thread.
+     *  More tasks can be dispatched at once but an idle thread might need to steal more often. */
+    #define LV_DRAW_SW_THREAD_QUEUE_SIZE    8
+
+    /** If there are multiple draw units, split the fills, box shadows, images and layers
+     *  larger than this area into horizontal bands rendered by all the draw units in parallel.
+     *  Set to 0 to disable splitting. [px] */
+    #define LV_DRAW_SW_SPLIT_MIN_AREA   (200 * 200)
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -206,10 +239,11 @@
     #define LV_DRAW_SW_COMPLEX          1
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /** Allow buffering some shadow calculation.
-         *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+        /** Size of the cache storing the blurred corners of the box shadows [bytes].
+         *  Shadows with the same width, radius and similar size share a corner
+         *  so they are blurred only once. A corner costs `2 * (shadow_width + radius)^2` bytes.
+         *  0: disable the cache */
+        #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0
 
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
@@ -494,6 +528,31 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Number of resolved style property values cached in each `lv_obj_t` to avoid
+ *  looking up the same properties again and again (e.g. when a static screen is redrawn).
+ *  The cache is allocated when a property of the object is read first and it's
+ *  invalidated when the styles, state or parent of the object (or its parents) change.
+ *  Modifying a shared style (`lv_style_set_...()`) invalidates the cache of all objects.
+ *  0: disable the cache */
+#define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE    0
+
+/** Keep the children of widgets having at least this many children sorted by their Y coordinate
+ *  while refreshing the screen. This way only the children on the refreshed area are visited
+ *  instead of all the children (e.g. long lists or large grids of buttons).
+ *  0: disable the index */
+#define LV_OBJ_CHILD_INDEX_MIN_CNT  0
+
+/** Apply the scroll offset and the movement of widgets to their children only when the
+ *  coordinates of a child are used (e.g. it's drawn or clicked). This way scrolling takes the same
+ *  time regardless of the number of children and descendants.
+ *  Custom code reading `obj->coords` directly needs to call `lv_obj_sync_coords(obj)` first. */
+#define LV_OBJ_LAZY_COORDS  0
+
+/** When a widget is scrolled in `LV_DISPLAY_RENDER_MODE_DIRECT`, move its already rendered pixels
+ *  in the draw buffer and redraw only the uncovered strip, instead of redrawing the whole widget.
+ *  It's used only for widgets with a plain opaque background and nothing drawn over them. */
+#define LV_OBJ_SCROLL_BLIT  0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -657,6 +716,16 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Size of the cache storing the unpacked (and decompressed) glyph bitmaps
+ *  of the built-in fonts to avoid unpacking them on every draw [bytes].
+ *  0: disable the cache */
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+
+/** Number of letters whose glyph index is cached to avoid searching them
+ *  in the character maps of the built-in fonts on every use.
+ *  0: disable the cache */
+#define LV_FONT_FMT_TXT_GID_CACHE_CNT 0
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -766,6 +835,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1   /**< Enable selecting text of the label */
     #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
+    #define LV_LABEL_LINE_TABLE 0       /**< Store the line breaks of labels to speed up drawing and hit testing of long texts */
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
 #endif
 
@@ -1086,6 +1156,9 @@
     /** Profiler end point function with custom tag */
     #define LV_PROFILER_END_TAG   LV_PROFILER_BUILTIN_END_TAG
 
+    /** Profiler function to record the value of a counter */
+    #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+
     /*Enable layout profiler*/
     #define LV_PROFILER_LAYOUT 1
 
@@ -66,6 +66,7 @@ fout.write(
 #define LV_DRAW_SW_ASM_NONE             0
 #define LV_DRAW_SW_ASM_NEON             1
 #define LV_DRAW_SW_ASM_HELIUM           2
+#define LV_DRAW_SW_ASM_X86_SIMD         3
 #define LV_DRAW_SW_ASM_CUSTOM           255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -268,6 +269,11 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
     #endif
 #endif
 
+#if (defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE) || \
+    (defined(CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE) && CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #warning "LV_DRAW_SW_SHADOW_CACHE_SIZE was replaced by LV_DRAW_SW_SHADOW_CACHE_BYTES which is the size of the whole cache in bytes (not the largest cached shadow). Please update lv_conf.h or run menuconfig again."
+#endif
+
 /*Allow only upper case letters and '/'  ('/' is a special case for backward compatibility)*/
 #define LV_FS_IS_VALID_LETTER(l) ((l) == '/' || ((l) >= 'A' && (l) <= 'Z'))
 
@@ -94,6 +94,15 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    uint32_t style_resolved_cache_epoch;
+#endif
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+    uint32_t obj_child_index_epoch;
+#endif
+#if LV_OBJ_LAZY_COORDS
+    uint32_t obj_coords_epoch;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -105,6 +114,8 @@ typedef struct _lv_global_t {
     uint32_t layout_count;
     lv_layout_dsc_t * layout_list;
     bool layout_update_mutex;
+    uint32_t layout_visited_cnt;
+    uint32_t layout_updated_cnt;
 
     uint32_t memory_zero;
     uint32_t math_rand_seed;
@@ -125,10 +136,13 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_USE_OS != LV_OS_NONE
+    lv_mutex_t img_decoder_lock;
+#endif
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+#if defined(LV_DRAW_SW_SHADOW_CACHE_BYTES) && LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
     lv_draw_sw_shadow_cache_t sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
@@ -198,6 +212,7 @@ typedef struct _lv_global_t {
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
+    lv_font_fmt_txt_cache_t font_fmt_txt_cache;
 
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
@@ -14,7 +14,7 @@
 #include "lv_obj_class_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
-#include "lv_refr.h"
+#include "lv_refr_private.h"
 #include "lv_group.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -262,8 +262,13 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
     /* We must invalidate the area occupied by the object before we hide it as calls to invalidate hidden objects are ignored */
     if(f & LV_OBJ_FLAG_HIDDEN) lv_obj_invalidate(obj);
 
+    /*Floating objects don't follow the scrolling of the parent*/
+    if(f & LV_OBJ_FLAG_FLOATING) lv_obj_sync_coords(obj);
+
     obj->flags |= f;
 
+    if(f & LV_OBJ_FLAG_FLOATING) lv_obj_reset_coords_ofs(obj);
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
             lv_group_t * group = lv_obj_get_group(obj);
@@ -304,8 +309,12 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_invalidate_area(obj, &ver_area);
     }
 
+    if(f & LV_OBJ_FLAG_FLOATING) lv_obj_sync_coords(obj);
+
     obj->flags &= (~f);
 
+    if(f & LV_OBJ_FLAG_FLOATING) lv_obj_reset_coords_ofs(obj);
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -563,10 +572,12 @@ static void lv_obj_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         int32_t sl = lv_obj_get_scroll_left(parent);
         int32_t st = lv_obj_get_scroll_top(parent);
 
+        lv_obj_sync_coords(parent);
         obj->coords.y1 = parent->coords.y1 + lv_obj_get_style_pad_top(parent, LV_PART_MAIN) - st;
         obj->coords.y2 = obj->coords.y1 - 1;
         obj->coords.x1  = parent->coords.x1 + lv_obj_get_style_pad_left(parent, LV_PART_MAIN) - sl;
         obj->coords.x2  = obj->coords.x1 - 1;
+        lv_obj_reset_coords_ofs(obj);
     }
 
     /*Set attributes*/
@@ -626,6 +637,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 #endif
 
+        lv_obj_free_child_index(obj);
+
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
@@ -633,6 +646,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 #if LV_OBJ_ID_AUTO_ASSIGN
     lv_obj_free_id(obj);
 #endif
+
+    lv_obj_style_free_resolved_cache(obj);
 }
 
 static void lv_obj_draw(lv_event_t * e)
@@ -1001,6 +1016,7 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     lv_obj_invalidate(obj);
 
     obj->state = new_state;
+    lv_obj_style_invalidate_resolved_cache(obj, LV_STYLE_PROP_ANY);
     lv_obj_update_layer_type(obj);
     lv_obj_style_transition_dsc_t * ts = lv_malloc_zeroed(sizeof(lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
@@ -52,6 +52,9 @@ lv_result_t lv_obj_send_event(lv_obj_t * obj, lv_event_code_t event_code, void *
 
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The event handlers might read the coordinates of the object or its parents directly*/
+    lv_obj_sync_coords(obj);
+
     lv_event_t e;
     e.current_target = obj;
     e.original_target = obj;
@@ -392,6 +395,7 @@ static lv_result_t event_send_core(lv_event_t * e)
         for(uint32_t i = 0; i < child_count && res == LV_RESULT_OK && !e->stop_processing; i++) {
             lv_obj_t * child = lv_obj_get_child(target, i);
             if(child) {
+                lv_obj_sync_coords_with_parent(child);
                 e->current_target = child;
                 res = event_send_core(e);
                 if(res != LV_RESULT_OK) {
@@ -22,6 +22,9 @@
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define update_layout_mutex LV_GLOBAL_DEFAULT()->layout_update_mutex
+#define layout_visited_cnt LV_GLOBAL_DEFAULT()->layout_visited_cnt
+#define layout_updated_cnt LV_GLOBAL_DEFAULT()->layout_updated_cnt
+#define obj_coords_epoch LV_GLOBAL_DEFAULT()->obj_coords_epoch
 
 /**********************
  *      TYPEDEFS
@@ -33,8 +36,12 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_layout_ancestors(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
+#if LV_OBJ_LAZY_COORDS
+    static void get_parent_ofs(const lv_obj_t * obj, lv_point_t * ofs);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -210,6 +217,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_layout_ancestors(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -294,6 +302,7 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_layout_ancestors(obj);
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
@@ -314,14 +323,25 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     update_layout_mutex = true;
 
     lv_obj_t * scr = lv_obj_get_screen(obj);
-    /*Repeat until there are no more layout invalidations*/
-    while(scr->scr_layout_inv) {
-        LV_LOG_TRACE("Layout update begin");
-        scr->scr_layout_inv = 0;
-        layout_update_core(scr);
-        LV_LOG_TRACE("Layout update end");
+    if(scr->scr_layout_inv) {
+        layout_visited_cnt = 0;
+        layout_updated_cnt = 0;
+
+        /*Repeat until there are no more layout invalidations*/
+        while(scr->scr_layout_inv) {
+            LV_LOG_TRACE("Layout update begin");
+            scr->scr_layout_inv = 0;
+            layout_update_core(scr);
+            LV_LOG_TRACE("Layout update end");
+        }
+
+        LV_PROFILER_LAYOUT_COUNTER("layout_visited", (int32_t)layout_visited_cnt);
+        LV_PROFILER_LAYOUT_COUNTER("layout_updated", (int32_t)layout_updated_cnt);
     }
 
+    /*The callers usually read the coordinates after this*/
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     update_layout_mutex = false;
     LV_PROFILER_LAYOUT_END;
 }
@@ -475,6 +495,9 @@ void lv_obj_align_to(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align, in
 
     if(LV_COORD_IS_PCT(x_ofs)) x_ofs = (lv_obj_get_width(base) * LV_COORD_GET_PCT(x_ofs)) / 100;
     if(LV_COORD_IS_PCT(y_ofs)) y_ofs = (lv_obj_get_height(base) * LV_COORD_GET_PCT(y_ofs)) / 100;
+
+    lv_obj_sync_coords((lv_obj_t *)base);
+    lv_obj_sync_coords(parent);
     if(lv_obj_get_style_base_dir(parent, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
         x += x_ofs + base->coords.x1 - parent->coords.x1 + lv_obj_get_scroll_right(parent) - pleft;
     }
@@ -491,6 +514,7 @@ void lv_obj_get_coords(const lv_obj_t * obj, lv_area_t * coords)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
     lv_area_copy(coords, &obj->coords);
 }
 
@@ -498,6 +522,8 @@ int32_t lv_obj_get_x(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     int32_t rel_x;
     lv_obj_t * parent = lv_obj_get_parent(obj);
     if(parent) {
@@ -522,6 +548,8 @@ int32_t lv_obj_get_y(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     int32_t rel_y;
     lv_obj_t * parent = lv_obj_get_parent(obj);
     if(parent) {
@@ -707,6 +735,8 @@ void lv_obj_refr_pos(lv_obj_t * obj)
 
 void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
 {
+    lv_obj_sync_coords(obj);
+
     /*Convert x and y to absolute coordinates*/
     lv_obj_t * parent = obj->parent;
 
@@ -776,6 +806,16 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
 
 void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, bool ignore_floating)
 {
+#if LV_OBJ_LAZY_COORDS
+    /*Only save the movement. The children will apply it when their coordinates are used.*/
+    if(lv_obj_get_child_count(obj) == 0) return;
+    lv_point_t * ofs = ignore_floating ? &obj->spec_attr->child_scroll_ofs : &obj->spec_attr->child_ofs;
+    ofs->x += x_diff;
+    ofs->y += y_diff;
+
+    /*The synced descendants need to be synced again*/
+    obj_coords_epoch++;
+#else
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
@@ -788,8 +828,53 @@ void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, boo
 
         lv_obj_move_children_by(child, x_diff, y_diff, false);
     }
+#endif
+}
+
+#if LV_OBJ_LAZY_COORDS
+void lv_obj_sync_coords(lv_obj_t * obj)
+{
+    /*Nothing has moved since the object was synced with all its parents,
+     *so the parents don't need to be checked either*/
+    uint32_t epoch = obj_coords_epoch;
+    if(obj->coords_epoch == epoch) return;
+
+    if(obj->parent) {
+        lv_obj_sync_coords(obj->parent);
+        lv_obj_sync_coords_with_parent(obj);
+    }
+
+    obj->coords_epoch = epoch;
+}
+
+void lv_obj_sync_coords_with_parent(lv_obj_t * obj)
+{
+    lv_point_t ofs;
+    get_parent_ofs(obj, &ofs);
+
+    int32_t x_diff = ofs.x - obj->coords_ofs.x;
+    int32_t y_diff = ofs.y - obj->coords_ofs.y;
+    if(x_diff == 0 && y_diff == 0) return;
+
+    lv_area_move(&obj->coords, x_diff, y_diff);
+    obj->coords_ofs = ofs;
+
+    /*The children are moved too, but only when their coordinates are used*/
+    if(obj->spec_attr) {
+        obj->spec_attr->child_ofs.x += x_diff;
+        obj->spec_attr->child_ofs.y += y_diff;
+    }
 }
 
+void lv_obj_reset_coords_ofs(lv_obj_t * obj)
+{
+    get_parent_ofs(obj, &obj->coords_ofs);
+
+    /*The new parent might not be synced yet, so sync the object and its children again*/
+    obj_coords_epoch++;
+}
+#endif
+
 void lv_obj_transform_point(const lv_obj_t * obj, lv_point_t * p, lv_obj_point_transform_flag_t flags)
 {
     lv_obj_transform_point_array(obj, p, 1, flags);
@@ -863,6 +948,8 @@ void lv_obj_invalidate(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     /*Truncate the area to the object*/
     lv_area_t obj_coords;
     int32_t ext_size = lv_obj_get_ext_draw_size(obj);
@@ -890,6 +977,9 @@ bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
         return false;
     }
 
+    /*It also makes the coordinates of the parents up to date*/
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     /*Truncate the area to the object*/
     lv_area_t obj_coords;
     int32_t ext_size = lv_obj_get_ext_draw_size(obj);
@@ -931,6 +1021,8 @@ bool lv_obj_is_visible(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     lv_area_t obj_coords;
     int32_t ext_size = lv_obj_get_ext_draw_size(obj);
     lv_area_copy(&obj_coords, &obj->coords);
@@ -952,6 +1044,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
 {
+    lv_obj_sync_coords((lv_obj_t *)obj);
     lv_area_copy(area, &obj->coords);
     if(obj->spec_attr) {
         lv_area_increase(area, obj->spec_attr->ext_click_pad, obj->spec_attr->ext_click_pad);
@@ -1077,6 +1170,29 @@ const lv_matrix_t * lv_obj_get_transform(const lv_obj_t * obj)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_OBJ_LAZY_COORDS
+/**
+ * Get the sum of the movements of the parent which should be applied to an object
+ * @param obj       pointer to an object
+ * @param ofs       store the result here
+ */
+static void get_parent_ofs(const lv_obj_t * obj, lv_point_t * ofs)
+{
+    const lv_obj_t * parent = obj->parent;
+    if(parent == NULL || parent->spec_attr == NULL) {
+        ofs->x = 0;
+        ofs->y = 0;
+        return;
+    }
+
+    *ofs = parent->spec_attr->child_ofs;
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_FLOATING)) {
+        ofs->x += parent->spec_attr->child_scroll_ofs.x;
+        ofs->y += parent->spec_attr->child_scroll_ofs.y;
+    }
+}
+#endif
+
 static bool is_transformed(const lv_obj_t * obj)
 {
     while(obj) {
@@ -1088,6 +1204,8 @@ static bool is_transformed(const lv_obj_t * obj)
 
 static int32_t calc_content_width(lv_obj_t * obj)
 {
+    lv_obj_sync_coords(obj);
+
     int32_t scroll_x_tmp = lv_obj_get_scroll_x(obj);
     if(obj->spec_attr) obj->spec_attr->scroll.x = 0;
 
@@ -1106,6 +1224,7 @@ static int32_t calc_content_width(lv_obj_t * obj)
             int32_t child_res_tmp = LV_COORD_MIN;
             lv_obj_t * child = obj->spec_attr->children[i];
             if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+            lv_obj_sync_coords_with_parent(child);
 
             if(!lv_obj_is_layout_positioned(child)) {
                 lv_align_t align = lv_obj_get_style_align(child, LV_PART_MAIN);
@@ -1142,6 +1261,7 @@ static int32_t calc_content_width(lv_obj_t * obj)
             int32_t child_res_tmp = LV_COORD_MIN;
             lv_obj_t * child = obj->spec_attr->children[i];
             if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+            lv_obj_sync_coords_with_parent(child);
 
             if(!lv_obj_is_layout_positioned(child)) {
                 lv_align_t align = lv_obj_get_style_align(child, LV_PART_MAIN);
@@ -1183,6 +1303,8 @@ static int32_t calc_content_width(lv_obj_t * obj)
 
 static int32_t calc_content_height(lv_obj_t * obj)
 {
+    lv_obj_sync_coords(obj);
+
     int32_t scroll_y_tmp = lv_obj_get_scroll_y(obj);
     if(obj->spec_attr) obj->spec_attr->scroll.y = 0;
 
@@ -1199,6 +1321,7 @@ static int32_t calc_content_height(lv_obj_t * obj)
         int32_t child_res_tmp = LV_COORD_MIN;
         lv_obj_t * child = obj->spec_attr->children[i];
         if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        lv_obj_sync_coords_with_parent(child);
 
         if(!lv_obj_is_layout_positioned(child)) {
             lv_align_t align = lv_obj_get_style_align(child, LV_PART_MAIN);
@@ -1235,15 +1358,26 @@ static int32_t calc_content_height(lv_obj_t * obj)
 
 static void layout_update_core(lv_obj_t * obj)
 {
+    layout_visited_cnt++;
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+
+    /*Go only into the children which have something to update in their subtree.
+     *Clear the flag first to see if it's set again while updating the children.*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->child_layout_inv || child->readjust_scroll_after_layout) {
+                layout_update_core(child);
+            }
+        }
     }
 
     if(obj->layout_inv) {
         obj->layout_inv = 0;
+        layout_updated_cnt++;
         lv_obj_refr_size(obj);
         lv_obj_refr_pos(obj);
 
@@ -1258,8 +1392,24 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the ancestors of an object to show that there is something to update in their subtree.
+ * Stop at the first marked ancestor as its ancestors are marked too.
+ * @param obj   pointer to an object which is invalidated
+ */
+static void mark_layout_ancestors(lv_obj_t * obj)
+{
+    lv_obj_t * parent = obj->parent;
+    while(parent && !parent->child_layout_inv) {
+        parent->child_layout_inv = 1;
+        parent = parent->parent;
+    }
+}
+
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
 {
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     const lv_matrix_t * obj_matrix = lv_obj_get_transform(obj);
     if(obj_matrix) {
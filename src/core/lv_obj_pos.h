@@ -357,6 +357,16 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y);
 
 void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, bool ignore_floating);
 
+#if LV_OBJ_LAZY_COORDS
+/**
+ * Apply the scroll offsets and movements of the parents to the coordinates of an object.
+ * With `LV_OBJ_LAZY_COORDS` it should be called before reading `obj->coords` directly.
+ * Otherwise, it does nothing.
+ * @param obj       pointer to an object
+ */
+void lv_obj_sync_coords(lv_obj_t * obj);
+#endif
+
 /**
  * Get the transform matrix of an object
  * @param obj       pointer to an object
@@ -466,6 +476,10 @@ int32_t lv_clamp_height(int32_t height, int32_t min_height, int32_t max_height,
  *      MACROS
  **********************/
 
+#if LV_OBJ_LAZY_COORDS == 0
+#define lv_obj_sync_coords(obj) LV_UNUSED(obj)
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -33,12 +33,19 @@ struct _lv_obj_spec_attr_t {
     lv_group_t * group_p;
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     lv_matrix_t * matrix;           /**< The transform matrix*/
+#endif
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+    lv_obj_child_index_t * child_index; /**< The children sorted by their Y coordinate for refreshing*/
 #endif
     lv_event_list_t event_list;
 #if LV_USE_OBJ_NAME
     const char * name;              /**< Pointer to the name */
 #endif
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
+#if LV_OBJ_LAZY_COORDS
+    lv_point_t child_ofs;           /**< Sum of the movements of all children, applied lazily to them*/
+    lv_point_t child_scroll_ofs;    /**< Sum of the movements of the non-floating children (scrolling)*/
+#endif
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
@@ -60,17 +67,25 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    lv_obj_style_resolved_cache_t * style_resolved_cache;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
     void * id;
 #endif
     lv_area_t coords;
+#if LV_OBJ_LAZY_COORDS
+    lv_point_t coords_ofs;          /**< The offset of the parent already applied to `coords`*/
+    uint32_t coords_epoch;          /**< The coordinates are synced with all the parents if it equals the global epoch*/
+#endif
     lv_obj_flag_t flags;
     uint16_t state;
     uint16_t layout_inv : 1;
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
+    uint16_t child_layout_inv : 1;
     uint16_t skip_trans : 1;
     uint16_t style_cnt  : 6;
     uint16_t h_layout   : 1;
@@ -82,10 +97,31 @@ struct _lv_obj_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_OBJ_LAZY_COORDS
+/**
+ * Apply the movements of the parent to the coordinates of an object which weren't applied yet.
+ * Unlike `lv_obj_sync_coords` the coordinates of the parent need to be up to date already.
+ * @param obj       pointer to an object
+ */
+void lv_obj_sync_coords_with_parent(lv_obj_t * obj);
+
+/**
+ * Consider the current coordinates of an object up to date with its parent.
+ * Should be called when the parent or the FLOATING flag of the object is changed.
+ * @param obj       pointer to an object
+ */
+void lv_obj_reset_coords_ofs(lv_obj_t * obj);
+#endif
+
 /**********************
  *      MACROS
  **********************/
 
+#if LV_OBJ_LAZY_COORDS == 0
+#define lv_obj_sync_coords_with_parent(obj) LV_UNUSED(obj)
+#define lv_obj_reset_coords_ofs(obj)        LV_UNUSED(obj)
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -13,6 +13,13 @@
 #include "../indev/lv_indev_scroll.h"
 #include "../display/lv_display.h"
 #include "../misc/lv_area.h"
+#if LV_OBJ_SCROLL_BLIT
+    #include "lv_refr_private.h"
+    #include "lv_obj_draw_private.h"
+    #include "lv_obj_class_private.h"
+    #include "../misc/lv_area_private.h"
+    #include "../misc/lv_event_private.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -38,6 +45,11 @@ static void scroll_y_anim(void * obj, int32_t v);
 static void scroll_end_cb(lv_anim_t * a);
 static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_point_t * scroll_value,
                                   lv_anim_enable_t anim_en);
+#if LV_OBJ_SCROLL_BLIT
+    static bool get_scroll_blit_area(lv_obj_t * obj, lv_area_t * area);
+    static bool draws_on_area(lv_obj_t * obj, const lv_area_t * area);
+    static bool has_draw_event(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -137,12 +149,15 @@ int32_t lv_obj_get_scroll_bottom(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     int32_t child_res = LV_COORD_MIN;
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
-        const lv_obj_t * child = obj->spec_attr->children[i];
+        lv_obj_t * child = obj->spec_attr->children[i];
         if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        lv_obj_sync_coords_with_parent(child);
 
         int32_t tmp_y = child->coords.y2 + lv_obj_get_style_margin_bottom(child, LV_PART_MAIN);
         child_res = LV_MAX(child_res, tmp_y);
@@ -172,6 +187,8 @@ int32_t lv_obj_get_scroll_left(const lv_obj_t * obj)
         return -obj->spec_attr->scroll.x;
     }
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     /*With RTL base direction scrolling the left is normal so find the left most coordinate*/
     int32_t space_right = lv_obj_get_style_space_right(obj, LV_PART_MAIN);
     int32_t space_left = lv_obj_get_style_space_left(obj, LV_PART_MAIN);
@@ -182,8 +199,9 @@ int32_t lv_obj_get_scroll_left(const lv_obj_t * obj)
     int32_t x1 = LV_COORD_MAX;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
-        const lv_obj_t * child = obj->spec_attr->children[i];
+        lv_obj_t * child = obj->spec_attr->children[i];
         if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        lv_obj_sync_coords_with_parent(child);
 
         int32_t tmp_x = child->coords.x1 - lv_obj_get_style_margin_left(child, LV_PART_MAIN);
         x1 = LV_MIN(x1, tmp_x);
@@ -215,13 +233,16 @@ int32_t lv_obj_get_scroll_right(const lv_obj_t * obj)
         return obj->spec_attr->scroll.x;
     }
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     /*With other base direction (LTR) scrolling to the right is normal so find the right most coordinate*/
     int32_t child_res = LV_COORD_MIN;
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
-        const lv_obj_t * child = obj->spec_attr->children[i];
+        lv_obj_t * child = obj->spec_attr->children[i];
         if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        lv_obj_sync_coords_with_parent(child);
 
         int32_t tmp_x = child->coords.x2 + lv_obj_get_style_margin_right(child, LV_PART_MAIN);
         child_res = LV_MAX(child_res, tmp_x);
@@ -391,6 +412,8 @@ void lv_obj_scroll_to_view(lv_obj_t * obj, lv_anim_enable_t anim_en)
     /*Be sure the screens layout is correct*/
     lv_obj_update_layout(obj);
 
+    lv_obj_sync_coords(obj);
+
     lv_point_t p = {0, 0};
     scroll_area_into_view(&obj->coords, obj, &p, anim_en);
 }
@@ -404,6 +427,8 @@ void lv_obj_scroll_to_view_recursive(lv_obj_t * obj, lv_anim_enable_t anim_en)
     lv_obj_t * child = obj;
     lv_obj_t * parent = lv_obj_get_parent(child);
     while(parent) {
+        /*Scrolling the previous parent has moved the object*/
+        lv_obj_sync_coords(obj);
         scroll_area_into_view(&obj->coords, child, &p, anim_en);
         child = parent;
         parent = lv_obj_get_parent(parent);
@@ -416,12 +441,36 @@ lv_result_t lv_obj_scroll_by_raw(lv_obj_t * obj, int32_t x, int32_t y)
 
     lv_obj_allocate_spec_attr(obj);
 
+#if LV_OBJ_SCROLL_BLIT
+    /*If possible move the already rendered pixels instead of redrawing the whole object.
+     *The scrollbars don't move together with the content so they are redrawn.*/
+    lv_area_t blit_area;
+    bool blit = get_scroll_blit_area(obj, &blit_area);
+    if(blit) lv_obj_scrollbar_invalidate(obj);
+#endif
+
     obj->spec_attr->scroll.x += x;
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
     lv_result_t res = lv_obj_send_event(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RESULT_OK) return res;
+
+#if LV_OBJ_SCROLL_BLIT
+    if(blit && lv_inv_area_scroll(lv_obj_get_display(obj), &blit_area, x, y)) {
+        lv_obj_scrollbar_invalidate(obj);
+
+        /*The children are visible under the border and the corners too*/
+        lv_area_t frame_areas[4];
+        int8_t frame_cnt = lv_area_diff(frame_areas, &obj->coords, &blit_area);
+        int8_t i;
+        for(i = 0; i < frame_cnt; i++) {
+            lv_obj_invalidate_area(obj, &frame_areas[i]);
+        }
+        return LV_RESULT_OK;
+    }
+#endif
+
     lv_obj_invalidate(obj);
     return LV_RESULT_OK;
 }
@@ -465,6 +514,8 @@ void lv_obj_get_scrollbar_area(lv_obj_t * obj, lv_area_t * hor_area, lv_area_t *
 
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLLABLE) == false) return;
 
+    lv_obj_sync_coords(obj);
+
     lv_scrollbar_mode_t sm = lv_obj_get_scrollbar_mode(obj);
     if(sm == LV_SCROLLBAR_MODE_OFF)  return;
 
@@ -705,6 +756,8 @@ static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_p
     lv_obj_t * parent = lv_obj_get_parent(child);
     if(!lv_obj_has_flag(parent, LV_OBJ_FLAG_SCROLLABLE)) return;
 
+    lv_obj_sync_coords(child);
+
     lv_dir_t scroll_dir = lv_obj_get_scroll_dir(parent);
     int32_t snap_goal = 0;
     int32_t act = 0;
@@ -811,3 +864,129 @@ static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_p
     scroll_value->y += anim_en ? y_scroll : 0;
     lv_obj_scroll_by(parent, x_scroll, y_scroll, anim_en);
 }
+
+#if LV_OBJ_SCROLL_BLIT
+/**
+ * Get the area of an object whose pixels only move when the object is scrolled
+ * @param obj       pointer to a scrollable object
+ * @param area      store the area here
+ * @return          true: the pixels can be moved; false: the object needs to be redrawn
+ */
+static bool get_scroll_blit_area(lv_obj_t * obj, lv_area_t * area)
+{
+    /*Only the children should be drawn on the background, so widgets drawing anything else are skipped*/
+    const lv_obj_class_t * class_p = obj->class_p;
+    while(class_p && class_p != &lv_obj_class) {
+        if(class_p->event_cb) return false;
+        class_p = class_p->base_class;
+    }
+
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) return false;
+    if(has_draw_event(obj)) return false;
+
+    /*The background should look the same everywhere*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) != LV_OPA_COVER) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_grad(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(lv_obj_get_screen(obj) != lv_display_get_screen_active(disp)) return false;
+    if(lv_display_get_screen_prev(disp) != NULL) return false;
+
+    /*The object is rendered directly to the display if none of its parents uses a layer*/
+    lv_obj_t * parent;
+    for(parent = obj; parent; parent = lv_obj_get_parent(parent)) {
+        if(lv_obj_get_layer_type(parent) != LV_LAYER_TYPE_NONE) return false;
+        if(lv_obj_get_style_opa(parent, LV_PART_MAIN) != LV_OPA_COVER) return false;
+    }
+
+    /*Skip the border and the rounded corners*/
+    lv_obj_get_coords(obj, area);
+    int32_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t shrink = LV_MAX(radius, border_width);
+    if(shrink * 2 >= lv_area_get_width(area) || shrink * 2 >= lv_area_get_height(area)) return false;
+    lv_area_increase(area, -shrink, -shrink);
+
+    if(!lv_obj_area_is_visible(obj, area)) return false;
+
+    /*Floating children don't move*/
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING) && draws_on_area(child, area)) return false;
+    }
+
+    /*Nothing should be drawn over the area by the parents or the widgets after them*/
+    for(parent = obj; lv_obj_get_parent(parent); parent = lv_obj_get_parent(parent)) {
+        lv_obj_t * grandparent = lv_obj_get_parent(parent);
+        if(has_draw_event(grandparent)) return false;
+        if(lv_obj_get_style_clip_corner(grandparent, LV_PART_MAIN)) return false;
+        if(lv_obj_get_style_border_post(grandparent, LV_PART_MAIN)) return false;
+
+        lv_area_t hor_area;
+        lv_area_t ver_area;
+        lv_obj_get_scrollbar_area(grandparent, &hor_area, &ver_area);
+        if(lv_area_get_size(&hor_area) > 0 && lv_area_is_on(&hor_area, area)) return false;
+        if(lv_area_get_size(&ver_area) > 0 && lv_area_is_on(&ver_area, area)) return false;
+
+        child_cnt = lv_obj_get_child_count(grandparent);
+        for(i = (uint32_t)lv_obj_get_index(parent) + 1; i < child_cnt; i++) {
+            if(draws_on_area(grandparent->spec_attr->children[i], area)) return false;
+        }
+    }
+
+    lv_obj_t * layers[2] = {lv_display_get_layer_top(disp), lv_display_get_layer_sys(disp)};
+    uint32_t l;
+    for(l = 0; l < 2; l++) {
+        if(layers[l] == NULL) continue;
+        child_cnt = lv_obj_get_child_count(layers[l]);
+        for(i = 0; i < child_cnt; i++) {
+            if(draws_on_area(layers[l]->spec_attr->children[i], area)) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Check if an object might draw anything on an area
+ * @param obj       pointer to an object
+ * @param area      the area to check
+ * @return          true: the object might draw on the area
+ */
+static bool draws_on_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_size, ext_size);
+    lv_obj_get_transformed_area(obj, &obj_area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+
+    return lv_area_is_on(&obj_area, area);
+}
+
+/**
+ * Check if an object has any drawing related event handler added by the user
+ * @param obj       pointer to an object
+ * @return          true: the handlers might draw something on the object
+ */
+static bool has_draw_event(lv_obj_t * obj)
+{
+    uint32_t event_cnt = lv_obj_get_event_count(obj);
+    uint32_t i;
+    for(i = 0; i < event_cnt; i++) {
+        lv_event_dsc_t * dsc = lv_obj_get_event_dsc(obj, i);
+        lv_event_code_t filter = dsc->filter & ~(LV_EVENT_PREPROCESS | LV_EVENT_MARKED_DELETING);
+        if(filter == LV_EVENT_ALL) return true;
+        if(filter >= LV_EVENT_DRAW_MAIN_BEGIN && filter <= LV_EVENT_DRAW_TASK_ADDED) return true;
+    }
+
+    return false;
+}
+#endif
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_private.h"
 #include "../misc/lv_anim_private.h"
+#include "../misc/lv_style_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
 #include "../display/lv_display.h"
@@ -23,6 +24,7 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define resolved_cache_epoch LV_GLOBAL_DEFAULT()->style_resolved_cache_epoch
 
 /**********************
  *      TYPEDEFS
@@ -68,6 +70,9 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    static lv_obj_style_resolved_cache_t * get_resolved_cache(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -228,7 +233,7 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
         }
 
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
-            if(obj->styles[i].style) lv_style_reset((lv_style_t *)obj->styles[i].style);
+            if(obj->styles[i].style) lv_style_reset_core((lv_style_t *)obj->styles[i].style);
             lv_free((lv_style_t *)obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
@@ -276,6 +281,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_style_invalidate_resolved_cache(obj, prop);
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -364,10 +371,27 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    /*While a transition is created the state is changed temporarily, so don't use the cache*/
+    lv_obj_style_resolved_cache_t * cache = obj->skip_trans ? NULL : get_resolved_cache((lv_obj_t *)obj);
+    uint32_t key = ((uint32_t)selector << 8) | prop;
+    uint32_t idx = (prop + (part >> 16) * 11) % LV_OBJ_STYLE_RESOLVED_CACHE_SIZE;
+    if(cache) {
+        if(cache->keys[idx] == key) return cache->values[idx];
+    }
+#endif
+
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
 
-    return lv_style_prop_get_default(prop);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    if(cache) {
+        cache->keys[idx] = key;
+        cache->values[idx] = value_act;
+    }
+#endif
+
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -396,7 +420,7 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
         lv_obj_invalidate(obj);
     }
 
-    lv_style_set_prop(style, prop, value);
+    lv_style_set_prop_core(style, prop, value);
 
 #if LV_OBJ_STYLE_CACHE
     uint32_t prop_shifted = STYLE_PROP_SHIFTED(prop);
@@ -442,7 +466,7 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
-    lv_result_t res = lv_style_remove_prop((lv_style_t *)obj->styles[i].style, prop);
+    lv_result_t res = lv_style_remove_prop_core((lv_style_t *)obj->styles[i].style, prop);
     if(res == LV_RESULT_OK) {
         full_cache_refresh(obj, lv_obj_style_get_selector_part(selector));
         lv_obj_refresh_style(obj, selector, prop);
@@ -451,6 +475,36 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     return res;
 }
 
+void lv_obj_style_invalidate_resolved_cache(lv_obj_t * obj, lv_style_prop_t prop)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    /*The values will be dropped when the cache is used next time*/
+    if(obj->style_resolved_cache) obj->style_resolved_cache->epoch = resolved_cache_epoch - 1;
+
+    /*Only the inherited properties of the children depend on this object*/
+    if(prop != LV_STYLE_PROP_ANY && !lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE)) return;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_style_invalidate_resolved_cache(obj->spec_attr->children[i], prop);
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(prop);
+#endif
+}
+
+void lv_obj_style_free_resolved_cache(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    lv_free(obj->style_resolved_cache);
+    obj->style_resolved_cache = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t prev_state, lv_state_t new_state,
                                     const lv_obj_style_transition_dsc_t * tr_dsc)
 {
@@ -470,7 +524,7 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
     obj->state = new_state;
 
     lv_obj_style_t * style_trans = get_trans_style(obj, part);
-    lv_style_set_prop((lv_style_t *)style_trans->style, tr_dsc->prop, v1);  /*Be sure `trans_style` has a valid value*/
+    lv_style_set_prop_core((lv_style_t *)style_trans->style, tr_dsc->prop, v1);  /*Be sure `trans_style` has a valid value*/
     lv_obj_refresh_style(obj, tr_dsc->selector, tr_dsc->prop);
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
@@ -910,9 +964,10 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
             uint32_t i;
             for(i = 0; i < obj->style_cnt; i++) {
                 if(obj->styles[i].is_trans && (part == LV_PART_ANY || obj->styles[i].selector == part)) {
-                    lv_style_remove_prop((lv_style_t *)obj->styles[i].style, tr->prop);
+                    lv_style_remove_prop_core((lv_style_t *)obj->styles[i].style, tr->prop);
                 }
             }
+            lv_obj_style_invalidate_resolved_cache(obj, tr->prop);
 
             /*Free the transition descriptor too*/
             lv_anim_delete(tr, NULL);
@@ -923,6 +978,7 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
         }
         tr = tr_prev;
     }
+
     return removed;
 }
 
@@ -983,7 +1039,7 @@ static void trans_anim_cb(void * _tr, int32_t v)
                 refr = false;
             }
         }
-        lv_style_set_prop((lv_style_t *)obj->styles[i].style, tr->prop, value_final);
+        lv_style_set_prop_core((lv_style_t *)obj->styles[i].style, tr->prop, value_final);
         if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
         break;
 
@@ -1009,7 +1065,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
 
     lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     /*Be sure `trans_style` has a valid value*/
-    lv_style_set_prop((lv_style_t *)style_trans->style, tr->prop, tr->start_value);
+    lv_style_set_prop_core((lv_style_t *)style_trans->style, tr->prop, tr->start_value);
     lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
 
 }
@@ -1040,7 +1096,8 @@ static void trans_anim_completed_cb(lv_anim_t * a)
                 lv_free(tr);
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
-                lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                lv_style_remove_prop_core((lv_style_t *)obj_style->style, prop);
+                lv_obj_style_invalidate_resolved_cache(obj, prop);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -1070,6 +1127,8 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+    lv_obj_style_invalidate_resolved_cache(obj, LV_STYLE_PROP_ANY);
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1154,6 +1213,32 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag)
     return false;
 }
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+/**
+ * Get the resolved style value cache of an object. Allocate it if not exists yet
+ * and drop the stored values if they were invalidated since they were stored.
+ * @param obj       pointer to an object
+ * @return          the cache or `NULL` if it couldn't be allocated
+ */
+static lv_obj_style_resolved_cache_t * get_resolved_cache(lv_obj_t * obj)
+{
+    lv_obj_style_resolved_cache_t * cache = obj->style_resolved_cache;
+    if(cache == NULL) {
+        cache = lv_malloc(sizeof(lv_obj_style_resolved_cache_t));
+        if(cache == NULL) return NULL;
+        cache->epoch = resolved_cache_epoch - 1;
+        obj->style_resolved_cache = cache;
+    }
+
+    if(cache->epoch != resolved_cache_epoch) {
+        lv_memzero(cache->keys, sizeof(cache->keys));
+        cache->epoch = resolved_cache_epoch;
+    }
+
+    return cache;
+}
+#endif
+
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act)
 {
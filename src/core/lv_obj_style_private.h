@@ -41,6 +41,14 @@ struct _lv_obj_style_transition_dsc_t {
     void * user_data;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+struct _lv_obj_style_resolved_cache_t {
+    uint32_t epoch;                                         /**< The global epoch when the values were stored */
+    uint32_t keys[LV_OBJ_STYLE_RESOLVED_CACHE_SIZE];        /**< Selector and property of the values. 0: unused */
+    lv_style_value_t values[LV_OBJ_STYLE_RESOLVED_CACHE_SIZE];
+};
+#endif
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -78,6 +86,23 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
  */
 lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+/**
+ * Invalidate the resolved style property values cached in an object.
+ * If `prop` is inherited the children are invalidated too.
+ * Used internally when the styles, state or parent of an object change.
+ * Does nothing if `LV_OBJ_STYLE_RESOLVED_CACHE_SIZE` is 0.
+ * @param obj   pointer to an object
+ * @param prop  the changed property or `LV_STYLE_PROP_ANY`
+ */
+void lv_obj_style_invalidate_resolved_cache(lv_obj_t * obj, lv_style_prop_t prop);
+
+/**
+ * Free the resolved style property values cached in an object.
+ * Used internally when the object is deleted.
+ * @param obj   pointer to an object
+ */
+void lv_obj_style_free_resolved_cache(lv_obj_t * obj);
+
 /**
  * Update the layer type of a widget bayed on its current styles.
  * The result will be stored in `obj->spec_attr->layer_type`
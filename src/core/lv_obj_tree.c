@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_style_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
@@ -167,6 +168,9 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_allocate_spec_attr(parent);
 
+    /*Apply the movements of the old parent before leaving it*/
+    lv_obj_sync_coords(obj);
+
     lv_obj_t * old_parent = obj->parent;
     /*Remove the object from the old parent's child list*/
     int32_t i;
@@ -190,6 +194,10 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_count(parent) - 1] = obj;
 
     obj->parent = parent;
+    lv_obj_reset_coords_ofs(obj);
+
+    /*The inherited style properties might be different with the new parent*/
+    lv_obj_style_invalidate_resolved_cache(obj, LV_STYLE_PROP_ANY);
 
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
@@ -274,6 +282,9 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+    lv_obj_style_invalidate_resolved_cache(obj1, LV_STYLE_PROP_ANY);
+    lv_obj_style_invalidate_resolved_cache(obj2, LV_STYLE_PROP_ANY);
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
@@ -40,13 +40,28 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void inv_area_add(lv_display_t * disp, const lv_area_t * area_p);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+#if LV_OBJ_SCROLL_BLIT
+    static void refr_scroll_blit(void);
+#endif
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
+static void layer_reshape_draw_buf(lv_layer_t * layer, uint32_t stride);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
+static void refr_obj_children(lv_layer_t * layer, lv_obj_t * obj, uint32_t start);
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+    static lv_obj_child_index_t * child_index_update(lv_obj_t * obj);
+    static bool refr_obj_children_indexed(lv_layer_t * layer, lv_obj_t * obj, uint32_t start);
+#endif
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
+static void refr_stripe(const lv_area_t * area_p, int32_t y_offset);
+static void stripe_flush(lv_display_t * disp);
+static void dispatch_wait_for_request(void);
+static bool layer_is_drawing(const lv_layer_t * layer);
+static void swap_buffers(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
@@ -150,7 +165,6 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     }
 
     if(refr_children) {
-        uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_count(obj);
         if(child_cnt == 0) {
             /*If the object was visible on the clip area call the post draw events too*/
@@ -170,10 +184,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
             }
 
             if(clip_corner == false) {
-                for(i = 0; i < child_cnt; i++) {
-                    lv_obj_t * child = obj->spec_attr->children[i];
-                    lv_obj_refr(layer, child);
-                }
+                refr_obj_children(layer, obj, 0);
 
                 /*If the object was visible on the clip area call the post draw events too*/
                 /*If all the children are redrawn make 'post draw' draw*/
@@ -199,10 +210,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 if(lv_area_intersect(&bottom, &bottom, &layer->_clip_area)) {
                     layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &bottom);
 
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer_children, child);
-                    }
+                    refr_obj_children(layer_children, obj, 0);
 
                     /*If all the children are redrawn send 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer_children);
@@ -220,10 +228,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 if(lv_area_intersect(&top, &top, &layer->_clip_area)) {
                     layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &top);
 
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer_children, child);
-                    }
+                    refr_obj_children(layer_children, obj, 0);
 
                     /*If all the children are redrawn send 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer_children);
@@ -242,10 +247,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 mid.y2 -= rout;
                 if(lv_area_intersect(&mid, &mid, &layer->_clip_area)) {
                     layer->_clip_area = mid;
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer, child);
-                    }
+                    refr_obj_children(layer, obj, 0);
 
                     /*If all the children are redrawn make 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
@@ -284,6 +286,9 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_OBJ_SCROLL_BLIT
+        disp->scroll_blit_pending = 0;
+#endif
         return;
     }
 
@@ -318,21 +323,119 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     if(res != LV_RESULT_OK) return;
 
     /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    disp->inv_px_sum += lv_area_get_size(&com_area);
+    inv_area_add(disp, &com_area);
+
+    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+
+bool lv_inv_area_scroll(lv_display_t * disp, const lv_area_t * area_p, int32_t x, int32_t y)
+{
+#if LV_OBJ_SCROLL_BLIT
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return false;
+    if(!lv_display_is_invalidation_enabled(disp)) return false;
+
+    LV_ASSERT_MSG(!disp->rendering_in_progress, "Invalidate area is not allowed during rendering.");
+
+    /*The draw buffer needs to keep the previous frame in screen coordinates*/
+    if(disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return false;
+    if(lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0) return false;
+    if(lv_color_format_get_bpp(disp->color_format) < 8) return false;
+
+    lv_area_t scr_area;
+    scr_area.x1 = 0;
+    scr_area.y1 = 0;
+    scr_area.x2 = lv_display_get_horizontal_resolution(disp) - 1;
+    scr_area.y2 = lv_display_get_vertical_resolution(disp) - 1;
+
+    lv_area_t area;
+    if(!lv_area_intersect(&area, area_p, &scr_area)) return true; /*Out of the screen*/
+
+    /*If the driver adjusts the invalidated areas (e.g. rounds them) the pixels can't be simply moved*/
+    lv_area_t adjusted_area = area;
+    lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &adjusted_area);
+    if(res != LV_RESULT_OK) return true;
+    if(!lv_area_is_equal(&adjusted_area, &area)) return false;
+
+    /*Only one area can be moved in a refresh*/
+    if(disp->scroll_blit_pending && !lv_area_is_equal(&area, &disp->scroll_blit_area)) return false;
+
+    lv_point_t ofs = {x, y};
+    if(disp->scroll_blit_pending) {
+        ofs.x += disp->scroll_blit_ofs.x;
+        ofs.y += disp->scroll_blit_ofs.y;
+    }
+
+    /*Nothing would remain from the old pixels*/
+    if(LV_ABS(ofs.x) >= lv_area_get_width(&area) || LV_ABS(ofs.y) >= lv_area_get_height(&area)) {
+        disp->scroll_blit_pending = 0;
+        lv_inv_area(disp, &area);
+        return true;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
+
+    /*The pixels of the already invalidated areas are not valid, so they won't be valid after moving either.
+     *Copy the areas as invalidating the moved ones might merge them.*/
+    lv_area_t inv_areas[LV_INV_BUF_SIZE];
+    uint32_t inv_p = disp->inv_p;
+    lv_memcpy(inv_areas, disp->inv_areas, inv_p * sizeof(lv_area_t));
+
+    uint32_t i;
+    for(i = 0; i < inv_p; i++) {
+        lv_area_t moved_area;
+        if(!lv_area_intersect(&moved_area, &inv_areas[i], &area)) continue;
+        lv_area_move(&moved_area, x, y);
+        if(lv_area_intersect(&moved_area, &moved_area, &area)) lv_inv_area(disp, &moved_area);
+    }
+
+    /*Invalidate the uncovered strips*/
+    lv_area_t strip_area;
+    if(x != 0) {
+        strip_area = area;
+        if(x > 0) strip_area.x2 = area.x1 + x - 1;
+        else strip_area.x1 = area.x2 + x + 1;
+        lv_inv_area(disp, &strip_area);
+    }
+
+    if(y != 0) {
+        strip_area = area;
+        if(y > 0) strip_area.y2 = area.y1 + y - 1;
+        else strip_area.y1 = area.y2 + y + 1;
+        lv_inv_area(disp, &strip_area);
+    }
+
+    disp->scroll_blit_area = area;
+    disp->scroll_blit_ofs = ofs;
+    disp->scroll_blit_pending = 1;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+    return true;
+#else
+    LV_UNUSED(disp);
+    LV_UNUSED(area_p);
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+    return false;
+#endif
+}
+
+void lv_obj_free_child_index(lv_obj_t * obj)
+{
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+    if(obj->spec_attr == NULL || obj->spec_attr->child_index == NULL) return;
+
+    lv_free(obj->spec_attr->child_index->items);
+    lv_free(obj->spec_attr->child_index->visible);
+    lv_free(obj->spec_attr->child_index);
+    obj->spec_attr->child_index = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
 }
 
 /**
@@ -388,17 +491,26 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     /*Refresh the screen's layout if required*/
     LV_PROFILER_LAYOUT_BEGIN_TAG("layout");
+#if LV_USE_PERF_MONITOR
+    uint32_t layout_start = lv_tick_get();
+#endif
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
 
     lv_obj_update_layout(disp_refr->bottom_layer);
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+#if LV_USE_PERF_MONITOR
+    disp_refr->perf_sysmon_info.frame.layout_time = lv_tick_elaps(layout_start);
+#endif
     LV_PROFILER_LAYOUT_END_TAG("layout");
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_OBJ_SCROLL_BLIT
+        disp_refr->scroll_blit_pending = 0;
+#endif
         LV_LOG_WARN("there is no active screen");
         goto refr_finish;
     }
@@ -407,6 +519,12 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     refr_sync_areas();
     refr_invalid_areas();
 
+#if LV_DRAW_ARENA_SIZE
+    /*The arena is reused whenever all of its draw tasks are freed, i.e. after each area.
+     *If some draw tasks are still alive now (e.g. a layer wasn't drawn) it's kept as it is with a warning.*/
+    lv_arena_reset(&disp_refr->draw_arena);
+#endif
+
     if(disp_refr->inv_p == 0) goto refr_finish;
     /*In double buffered direct mode save the updated areas.
      *They will be used on the next call to synchronize the buffers.*/
@@ -447,6 +565,7 @@ lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
 {
     lv_obj_t * found_p = NULL;
 
+    lv_obj_sync_coords(obj);
     if(lv_area_is_in(area_p, &obj->coords, 0) == false) return NULL;
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
     if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return NULL;
@@ -486,6 +605,8 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     LV_ASSERT_NULL(obj);
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
 
+    lv_obj_sync_coords(obj);
+
     /*If `opa_layered != LV_OPA_COVER` draw the widget on a new layer and blend that layer with the given opacity.*/
     const lv_opa_t opa_layered = lv_obj_get_style_opa_layered(obj, LV_PART_MAIN);
     if(opa_layered <= LV_OPA_MIN) return;
@@ -598,7 +719,8 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the areas if redrawing their bounding box is cheaper than redrawing them one by one.
+ * Besides its pixels, refreshing an area costs about `LV_INV_AREA_JOIN_OVERHEAD` pixels.
  */
 static void lv_refr_join_area(void)
 {
@@ -606,34 +728,82 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    bool joined;
+    /*A joined area is larger so it might be worth to join it with other areas too*/
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                /*Join two area only if the joined area is cheaper to redraw*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) +
+                                                     LV_INV_AREA_JOIN_OVERHEAD)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
+            }
+        }
+    } while(joined);
+    LV_PROFILER_REFR_END;
+}
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+/**
+ * Save an invalidated area. The saved areas covered by the new area are dropped.
+ * If there is no free slot the new area is merged into the saved area which grows the least,
+ * so the whole screen is redrawn only if it's really invalidated.
+ * @param disp      pointer to a display
+ * @param area_p    the area to save, already clipped to the screen
+ */
+static void inv_area_add(lv_display_t * disp, const lv_area_t * area_p)
+{
+    lv_area_t new_area = *area_p;
+    uint32_t i;
+    while(1) {
+        /*Remove the saved areas which are covered by the new area*/
+        uint32_t cnt = 0;
+        for(i = 0; i < disp->inv_p; i++) {
+            if(lv_area_is_in(&disp->inv_areas[i], &new_area, 0)) continue;
+            disp->inv_areas[cnt] = disp->inv_areas[i];
+            cnt++;
+        }
+        disp->inv_p = cnt;
+
+        if(disp->inv_p < LV_INV_BUF_SIZE) break;
+
+        /*No free slot: merge with the area whose size grows the least.
+         *The merged area covers that area so it will be removed in the next round.*/
+        uint32_t best_i = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for(i = 0; i < disp->inv_p; i++) {
+            lv_area_t joined_area;
+            lv_area_join(&joined_area, &new_area, &disp->inv_areas[i]);
+            uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+            if(growth < best_growth) {
+                best_growth = growth;
+                best_i = i;
             }
         }
+
+        lv_area_t joined_area;
+        lv_area_join(&joined_area, &new_area, &disp->inv_areas[best_i]);
+        new_area = joined_area;
     }
-    LV_PROFILER_REFR_END;
+
+    disp->inv_areas[disp->inv_p] = new_area;
+    disp->inv_p++;
 }
 
 /**
@@ -738,6 +908,95 @@ static void refr_sync_areas(void)
     LV_PROFILER_REFR_END;
 }
 
+#if LV_OBJ_SCROLL_BLIT
+/**
+ * Move the pixels of the scrolled area in the draw buffer and flush them.
+ * The uncovered parts are already invalidated so they will be redrawn after this.
+ */
+static void refr_scroll_blit(void)
+{
+    if(!disp_refr->scroll_blit_pending) return;
+    disp_refr->scroll_blit_pending = 0;
+
+    /*Nothing to do if the area will be redrawn anyway*/
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        if(lv_area_is_in(&disp_refr->scroll_blit_area, &disp_refr->inv_areas[i], 0)) return;
+    }
+
+    LV_PROFILER_REFR_BEGIN;
+
+    /*Prepare the buffer in the same way as for rendering*/
+    lv_layer_t * layer = disp_refr->layer_head;
+    layer->draw_buf = disp_refr->buf_act;
+    layer->buf_area.x1 = 0;
+    layer->buf_area.y1 = 0;
+    layer->buf_area.x2 = lv_display_get_horizontal_resolution(disp_refr) - 1;
+    layer->buf_area.y2 = lv_display_get_vertical_resolution(disp_refr) - 1;
+    layer_reshape_draw_buf(layer, disp_refr->stride_is_auto ? LV_STRIDE_AUTO : layer->draw_buf->header.stride);
+
+    /*Don't modify the buffer while it's being sent to the display*/
+    wait_for_flushing(disp_refr);
+
+    lv_point_t ofs = disp_refr->scroll_blit_ofs;
+    lv_area_t dest_area = disp_refr->scroll_blit_area;
+    lv_area_move(&dest_area, ofs.x, ofs.y);
+    lv_area_intersect(&dest_area, &dest_area, &disp_refr->scroll_blit_area);
+
+    /*With more buffers the active one is not synchronized where it will be redrawn,
+     *so take the pixels from the buffer shown on the display*/
+    lv_draw_buf_t * draw_buf = layer->draw_buf;
+    lv_draw_buf_t * src_buf = draw_buf;
+    if(lv_display_is_double_buffered(disp_refr)) {
+        if(draw_buf == disp_refr->buf_1) src_buf = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_2;
+        else if(draw_buf == disp_refr->buf_2) src_buf = disp_refr->buf_1;
+        else src_buf = disp_refr->buf_2;
+    }
+
+    uint32_t stride = draw_buf->header.stride;
+    uint32_t line_size = lv_area_get_width(&dest_area) * (lv_color_format_get_bpp(draw_buf->header.cf) / 8);
+    int32_t h = lv_area_get_height(&dest_area);
+    uint8_t * dest = lv_draw_buf_goto_xy(draw_buf, dest_area.x1, dest_area.y1);
+    uint8_t * src = lv_draw_buf_goto_xy(src_buf, dest_area.x1 - ofs.x, dest_area.y1 - ofs.y);
+
+    /*Copy the lines in the direction which doesn't overwrite the not yet copied ones*/
+    int32_t y;
+    if(ofs.y > 0) {
+        dest += (h - 1) * stride;
+        src += (h - 1) * stride;
+        for(y = 0; y < h; y++) {
+            lv_memmove(dest, src, line_size);
+            dest -= stride;
+            src -= stride;
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            lv_memmove(dest, src, line_size);
+            dest += stride;
+            src += stride;
+        }
+    }
+
+    /*Flush the moved area. It's never the last area as the uncovered parts are redrawn too.*/
+    disp_refr->refreshed_area = dest_area;
+    disp_refr->last_area = 0;
+    disp_refr->last_part = 1;
+    draw_buf_flush(disp_refr);
+    disp_refr->last_part = 0;
+
+    /*The other buffers don't have the moved pixels yet*/
+    if(lv_display_is_double_buffered(disp_refr)) {
+        lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
+        LV_ASSERT_MALLOC(sync_area);
+        if(sync_area) *sync_area = dest_area;
+    }
+
+    LV_PROFILER_REFR_END;
+}
+#endif
+
 /**
  * Refresh the joined areas
  */
@@ -763,12 +1022,26 @@ static void refr_invalid_areas(void)
     disp_refr->last_part = 0;
     disp_refr->rendering_in_progress = true;
 
+#if LV_OBJ_SCROLL_BLIT
+    refr_scroll_blit();
+#endif
+
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+    /*The objects might have been changed since the last refresh so update the indexes when they are used first*/
+    LV_GLOBAL_DEFAULT()->obj_child_index_epoch++;
+#endif
+
+    /*In pipelined mode a stripe is flushed only when the next one is created,
+     *so a free buffer is required for the next stripe*/
+    bool pipeline = disp_refr->render_pipeline && lv_display_is_double_buffered(disp_refr);
+
     for(i = 0; i < (int32_t)disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
 
         if(i == last_i) disp_refr->last_area = 1;
         disp_refr->last_part = 0;
+        disp_refr->redrawn_px_sum += lv_area_get_size(&disp_refr->inv_areas[i]);
 
         lv_area_t inv_a = disp_refr->inv_areas[i];
         if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
@@ -791,9 +1064,14 @@ static void refr_invalid_areas(void)
                 if(sub_area.y2 > inv_a.y2) sub_area.y2 = inv_a.y2;
                 row_last = sub_area.y2;
                 if(inv_a.y2 == row_last) disp_refr->last_part = 1;
-                refr_area(&sub_area, y_off);
+                if(pipeline) {
+                    refr_stripe(&sub_area, y_off);
+                }
+                else {
+                    refr_area(&sub_area, y_off);
+                    draw_buf_flush(disp_refr);
+                }
                 y_off += lv_area_get_height(&sub_area);
-                draw_buf_flush(disp_refr);
             }
 
             /*If the last y coordinates are not handled yet ...*/
@@ -802,9 +1080,14 @@ static void refr_invalid_areas(void)
                 sub_area.y1 = row;
                 sub_area.y2 = inv_a.y2;
                 disp_refr->last_part = 1;
-                refr_area(&sub_area, y_off);
+                if(pipeline) {
+                    refr_stripe(&sub_area, y_off);
+                }
+                else {
+                    refr_area(&sub_area, y_off);
+                    draw_buf_flush(disp_refr);
+                }
                 y_off += lv_area_get_height(&sub_area);
-                draw_buf_flush(disp_refr);
             }
         }
         else if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_FULL ||
@@ -815,6 +1098,14 @@ static void refr_invalid_areas(void)
         }
     }
 
+    /*Flush the last stripe too*/
+    stripe_flush(disp_refr);
+
+#if LV_USE_PROFILER
+    LV_PROFILER_REFR_COUNTER("draw_tasks", (int32_t)LV_GLOBAL_DEFAULT()->draw_info.task_cnt);
+    LV_GLOBAL_DEFAULT()->draw_info.task_cnt = 0;
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_REFR_END;
@@ -923,7 +1214,7 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         for(i = 0; i < tile_cnt; i++) {
             lv_layer_t * tile_layer = &tile_layers[i];
             while(tile_layer->draw_task_head) {
-                lv_draw_dispatch_wait_for_request();
+                dispatch_wait_for_request();
                 lv_draw_dispatch();
             }
 
@@ -1093,19 +1384,8 @@ static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj)
 
     /*Do until not reach the screen*/
     while(parent != NULL) {
-        bool go = false;
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_count(parent);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = parent->spec_attr->children[i];
-            if(!go) {
-                if(child == border_p) go = true;
-            }
-            else {
-                /*Refresh the objects*/
-                lv_obj_refr(layer, child);
-            }
-        }
+        /*Refresh the objects after the border*/
+        refr_obj_children(layer, parent, lv_obj_get_index(border_p) + 1);
 
         /*Call the post draw function of the parents of the to object*/
         lv_obj_send_event(parent, LV_EVENT_DRAW_POST_BEGIN, (void *)layer);
@@ -1121,6 +1401,161 @@ static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Refresh the children of an object which might be visible on the clip area of the layer
+ * @param layer     pointer to a layer
+ * @param obj       pointer to an object whose children should be refreshed
+ * @param start     refresh the children from this index
+ */
+static void refr_obj_children(lv_layer_t * layer, lv_obj_t * obj, uint32_t start)
+{
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+    /*The index is valid only while rendering as the objects can't change meanwhile*/
+    if(child_cnt >= LV_OBJ_CHILD_INDEX_MIN_CNT && disp_refr && disp_refr->rendering_in_progress) {
+        if(refr_obj_children_indexed(layer, obj, start)) return;
+    }
+#endif
+
+    uint32_t i;
+    for(i = start; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        lv_obj_refr(layer, child);
+    }
+}
+
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+
+/**
+ * Update the index of the children of an object if it was not updated in this refresh yet.
+ * @param obj       pointer to an object
+ * @return          the up-to-date index or NULL if it couldn't be allocated
+ */
+static lv_obj_child_index_t * child_index_update(lv_obj_t * obj)
+{
+    lv_obj_child_index_t * index = obj->spec_attr->child_index;
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    uint32_t epoch = LV_GLOBAL_DEFAULT()->obj_child_index_epoch;
+    if(index && index->epoch == epoch && index->cnt == child_cnt) return index;
+
+    uint32_t i;
+    if(index == NULL || index->cnt != child_cnt) {
+        lv_obj_free_child_index(obj);
+        index = lv_malloc_zeroed(sizeof(lv_obj_child_index_t));
+        if(index == NULL) return NULL;
+        index->items = lv_malloc(child_cnt * sizeof(lv_obj_child_index_item_t));
+        index->visible = lv_malloc_zeroed(child_cnt);
+        if(index->items == NULL || index->visible == NULL) {
+            lv_free(index->items);
+            lv_free(index->visible);
+            lv_free(index);
+            return NULL;
+        }
+
+        index->cnt = child_cnt;
+        for(i = 0; i < child_cnt; i++) {
+            index->items[i].child_id = i;
+        }
+        obj->spec_attr->child_index = index;
+    }
+
+    /*Keep the order of the previous refresh. The children are moved mostly together (e.g. scrolling)
+     *so the items are almost sorted and the insertion sort below is fast.*/
+    lv_obj_child_index_item_t * items = index->items;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[items[i].child_id];
+        lv_obj_sync_coords_with_parent(child);
+        if(lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) {
+            /*It's hard to tell where a transformed child is drawn so always refresh it*/
+            lv_area_set(&items[i].area, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX);
+        }
+        else {
+            int32_t ext_draw_size = lv_obj_get_ext_draw_size(child);
+            items[i].area = child->coords;
+            lv_area_increase(&items[i].area, ext_draw_size, ext_draw_size);
+        }
+    }
+
+    for(i = 1; i < child_cnt; i++) {
+        lv_obj_child_index_item_t item = items[i];
+        uint32_t j = i;
+        while(j > 0 && items[j - 1].area.y1 > item.area.y1) {
+            items[j] = items[j - 1];
+            j--;
+        }
+        items[j] = item;
+    }
+
+    int32_t y2_max = LV_COORD_MIN;
+    for(i = 0; i < child_cnt; i++) {
+        y2_max = LV_MAX(y2_max, items[i].area.y2);
+        items[i].y2_max = y2_max;
+    }
+
+    index->epoch = epoch;
+    return index;
+}
+
+/**
+ * Refresh only the children of an object which are on the clip area of the layer using the index of the children
+ * @param layer     pointer to a layer
+ * @param obj       pointer to an object whose children should be refreshed
+ * @param start     refresh the children from this index
+ * @return          true: the children were refreshed; false: the index couldn't be created
+ */
+static bool refr_obj_children_indexed(lv_layer_t * layer, lv_obj_t * obj, uint32_t start)
+{
+    lv_obj_child_index_t * index = child_index_update(obj);
+    if(index == NULL) return false;
+
+    const lv_area_t * clip = &layer->_clip_area;
+    const lv_obj_child_index_item_t * items = index->items;
+
+    /*Skip the children which start below the clip area*/
+    uint32_t low = 0;
+    uint32_t high = index->cnt;
+    while(low < high) {
+        uint32_t mid = (low + high) / 2;
+        if(items[mid].area.y1 <= clip->y2) low = mid + 1;
+        else high = mid;
+    }
+    uint32_t end = low;
+
+    /*Skip the children at the beginning which all end above the clip area*/
+    low = 0;
+    high = end;
+    while(low < high) {
+        uint32_t mid = (low + high) / 2;
+        if(items[mid].y2_max < clip->y1) low = mid + 1;
+        else high = mid;
+    }
+
+    /*Mark the visible children and draw them in their original order*/
+    uint32_t id_min = UINT32_MAX;
+    uint32_t id_max = 0;
+    uint32_t i;
+    for(i = low; i < end; i++) {
+        const lv_obj_child_index_item_t * item = &items[i];
+        if(item->child_id < start) continue;
+        if(item->area.y2 < clip->y1 || item->area.x2 < clip->x1 || item->area.x1 > clip->x2) continue;
+
+        index->visible[item->child_id] = 1;
+        id_min = LV_MIN(id_min, item->child_id);
+        id_max = LV_MAX(id_max, item->child_id);
+    }
+
+    for(i = id_min; i <= id_max && i < index->cnt; i++) {
+        if(index->visible[i] == 0) continue;
+        index->visible[i] = 0;
+        lv_obj_refr(layer, obj->spec_attr->children[i]);
+    }
+
+    return true;
+}
+
+#endif /*LV_OBJ_CHILD_INDEX_MIN_CNT*/
+
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out)
 {
@@ -1358,7 +1793,7 @@ static void draw_buf_flush(lv_display_t * disp)
     lv_layer_t * layer = disp->layer_head;
 
     while(layer->draw_task_head) {
-        lv_draw_dispatch_wait_for_request();
+        dispatch_wait_for_request();
         lv_draw_dispatch();
     }
 
@@ -1382,15 +1817,148 @@ static void draw_buf_flush(lv_display_t * disp)
     }
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
     if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
-        if(disp->buf_act == disp->buf_1) {
-            disp->buf_act = disp->buf_2;
-        }
-        else if(disp->buf_act == disp->buf_2) {
-            disp->buf_act = disp->buf_3 ? disp->buf_3 : disp->buf_1;
-        }
-        else {
-            disp->buf_act = disp->buf_1;
+        swap_buffers(disp);
+    }
+}
+
+/**
+ * Create the draw tasks of a stripe in pipelined mode and flush the previous stripe.
+ * The draw units can still work on the previous stripe while the tasks of this one are created.
+ * @param area_p    the area of the stripe
+ * @param y_offset  y offset of the stripe in the invalidated area
+ */
+static void refr_stripe(const lv_area_t * area_p, int32_t y_offset)
+{
+    LV_PROFILER_REFR_BEGIN;
+
+    /*With 2 buffers the buffer of this stripe might be flushed right now.
+     *With 3 buffers its flush was already finished before starting to flush the previous stripe.*/
+    if(disp_refr->buf_3 == NULL) {
+        wait_for_flushing(disp_refr);
+    }
+
+    lv_layer_t * stripe = lv_malloc(sizeof(lv_layer_t));
+    LV_ASSERT_MALLOC(stripe);
+    if(stripe == NULL) {
+        /*Render the stripe in the normal way*/
+        stripe_flush(disp_refr);
+        refr_area(area_p, y_offset);
+        draw_buf_flush(disp_refr);
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
+    /*Similarly to tiles, the stripe is a dummy layer which draws directly into the display's buffer*/
+    lv_draw_layer_init(stripe, NULL, disp_refr->layer_head->color_format, area_p);
+    stripe->draw_buf = disp_refr->buf_act;
+    stripe->partial_y_offset = y_offset;
+    layer_reshape_draw_buf(stripe, LV_STRIDE_AUTO);
+
+    bool overlap = disp_refr->stripe_pending && layer_is_drawing(disp_refr->stripe_pending);
+    refr_configured_layer(stripe);
+
+    disp_refr->stripe_cnt++;
+    if(overlap) disp_refr->stripe_overlap_cnt++;
+
+    /*The next stripe can be rendered to the next buffer*/
+    swap_buffers(disp_refr);
+
+    /*Wait for the previous stripe and flush it while this one is being drawn*/
+    stripe_flush(disp_refr);
+
+    disp_refr->stripe_pending = stripe;
+    disp_refr->stripe_pending_last = disp_refr->last_area && disp_refr->last_part;
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Wait until the draw tasks of the pending stripe are finished, flush it and delete its layer.
+ * @param disp      pointer to a display
+ */
+static void stripe_flush(lv_display_t * disp)
+{
+    lv_layer_t * stripe = disp->stripe_pending;
+    if(stripe == NULL) return;
+
+    LV_PROFILER_REFR_BEGIN;
+    disp->stripe_pending = NULL;
+
+    while(stripe->draw_task_head) {
+        dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    /*Only one area can be flushed at a time*/
+    wait_for_flushing(disp);
+
+    disp->flushing = 1;
+    disp->flushing_last = disp->stripe_pending_last;
+    disp->refreshed_area = stripe->buf_area;
+
+    if(disp->flush_cb) {
+        call_flush_cb(disp, &disp->refreshed_area, stripe->draw_buf->data);
+    }
+
+    lv_layer_t * layer_i = disp->layer_head;
+    while(layer_i) {
+        if(layer_i->next == stripe) {
+            layer_i->next = stripe->next;
+            break;
         }
+        layer_i = layer_i->next;
+    }
+
+    if(disp->layer_deinit) disp->layer_deinit(disp, stripe);
+    lv_free(stripe);
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Wait until a draw unit requests a new dispatching.
+ * The time of waiting is measured for the performance monitor.
+ */
+static void dispatch_wait_for_request(void)
+{
+#if LV_USE_PERF_MONITOR
+    uint32_t wait_start = lv_tick_get();
+    lv_draw_dispatch_wait_for_request();
+    disp_refr->perf_sysmon_info.frame.dispatch_wait_time += lv_tick_elaps(wait_start);
+#else
+    lv_draw_dispatch_wait_for_request();
+#endif
+}
+
+/**
+ * Check if a layer has draw tasks which are not finished yet
+ * @param layer     pointer to a layer
+ * @return          true: some draw tasks are still waiting or being drawn
+ */
+static bool layer_is_drawing(const lv_layer_t * layer)
+{
+    const lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        if(t->state != LV_DRAW_TASK_STATE_FINISHED) return true;
+        t = t->next;
+    }
+
+    return false;
+}
+
+/**
+ * Use the next buffer of the display for rendering
+ * @param disp      pointer to a display
+ */
+static void swap_buffers(lv_display_t * disp)
+{
+    if(disp->buf_act == disp->buf_1) {
+        disp->buf_act = disp->buf_2;
+    }
+    else if(disp->buf_act == disp->buf_2) {
+        disp->buf_act = disp->buf_3 ? disp->buf_3 : disp->buf_1;
+    }
+    else {
+        disp->buf_act = disp->buf_1;
     }
 }
 
@@ -24,6 +24,21 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_OBJ_CHILD_INDEX_MIN_CNT
+typedef struct {
+    lv_area_t area;     /**< Coordinates of the child increased by its extra draw size*/
+    int32_t y2_max;     /**< The largest `area.y2` of this and the previous items*/
+    uint32_t child_id;  /**< Index of the child in the parent*/
+} lv_obj_child_index_item_t;
+
+struct _lv_obj_child_index_t {
+    uint32_t epoch;                     /**< Value of the global epoch when the index was updated*/
+    uint32_t cnt;                       /**< Number of items*/
+    lv_obj_child_index_item_t * items;  /**< The children sorted by `area.y1`*/
+    uint8_t * visible;                  /**< Temporary flags per child: 1: visible on the clip area*/
+};
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -46,6 +61,18 @@ void lv_refr_deinit(void);
  */
 void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p);
 
+/**
+ * Invalidate a scrolled area by moving its already rendered pixels in the draw buffer on the next
+ * refresh. Only the uncovered strip and the moved parts of the earlier invalidated areas are redrawn.
+ * Works only in `LV_DISPLAY_RENDER_MODE_DIRECT` without rotation and if `LV_OBJ_SCROLL_BLIT` is enabled.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param area_p    the scrolled area. Its pixels should depend only on the scroll position.
+ * @param x         the pixels are moved by this much horizontally
+ * @param y         the pixels are moved by this much vertically
+ * @return          true: the area is handled; false: the area should be invalidated normally
+ */
+bool lv_inv_area_scroll(lv_display_t * disp, const lv_area_t * area_p, int32_t x, int32_t y);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -73,6 +100,14 @@ lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
  */
 void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj);
 
+/**
+ * Free the index of the children of an object.
+ * Used internally when the object is deleted.
+ * Does nothing if `LV_OBJ_CHILD_INDEX_MIN_CNT` is 0.
+ * @param obj   pointer to an object
+ */
+void lv_obj_free_child_index(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -101,6 +101,10 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
 
     lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
 
+#if LV_DRAW_ARENA_SIZE
+    lv_arena_init(&disp->draw_arena, LV_DRAW_ARENA_SIZE);
+#endif
+
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
                                         new display*/
@@ -219,6 +223,10 @@ void lv_display_delete(lv_display_t * disp)
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
     lv_free(disp->layer_head);
 
+#if LV_DRAW_ARENA_SIZE
+    lv_arena_deinit(&disp->draw_arena);
+#endif
+
     lv_free(disp);
 
     if(was_default) lv_display_set_default(lv_ll_get_head(disp_ll_p));
@@ -590,6 +598,22 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_render_pipeline(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->render_pipeline = en;
+}
+
+bool lv_display_get_render_pipeline(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->render_pipeline;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -1271,6 +1295,9 @@ static void update_resolution(lv_display_t * disp)
     lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+#if LV_OBJ_SCROLL_BLIT
+    disp->scroll_blit_pending = 0;
+#endif
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
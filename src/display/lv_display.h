@@ -357,6 +357,23 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Enable pipelined rendering in `LV_DISPLAY_RENDER_MODE_PARTIAL` with at least 2 buffers.
+ * The draw tasks of the next stripe are created while the draw units are still
+ * drawing the previous one and each stripe is flushed as soon as it's ready.
+ * Each stripe is rendered as a single tile.
+ * @param disp      pointer to a display
+ * @param en        true/false
+ */
+void lv_display_set_render_pipeline(lv_display_t * disp, bool en);
+
+/**
+ * Get whether pipelined rendering is enabled
+ * @param disp      pointer to a display
+ * @return          true: pipelined rendering is enabled
+ */
+bool lv_display_get_render_pipeline(lv_display_t * disp);
+
 /**
  * Enable anti-aliasing for the render engine
  * @param disp      pointer to a display
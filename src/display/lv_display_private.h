@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "../misc/lv_types.h"
+#include "../misc/lv_arena.h"
 #include "../core/lv_obj.h"
 #include "../draw/lv_draw.h"
 #include "lv_display.h"
@@ -29,6 +30,12 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
 #endif
 
+#ifndef LV_INV_AREA_JOIN_OVERHEAD
+/** Refreshing an area separately costs about this many pixels (walking the widget tree, flushing, etc).
+ * Invalid areas are joined if redrawing the bounding box costs less than redrawing them one by one.*/
+#define LV_INV_AREA_JOIN_OVERHEAD 1024
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -94,6 +101,7 @@ struct _lv_display_t {
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t tile_cnt     : 8;       /**< Divide the display buffer into these number of tiles */
     uint32_t stride_is_auto : 1;     /**< 1: The stride of the buffers was not set explicitly. */
+    uint32_t render_pipeline : 1;    /**< 1: Create the tasks of the next stripe while the previous one is drawn */
 
 
     /** 1: The current screen rendering is in progress*/
@@ -106,10 +114,19 @@ struct _lv_display_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p;
     int32_t inv_en_cnt;
+    uint32_t inv_px_sum;            /**< Sum of the size of the invalidated areas, before joining them*/
+    uint32_t redrawn_px_sum;        /**< Sum of the size of the areas which were really redrawn*/
 
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
+#if LV_OBJ_SCROLL_BLIT
+    /** Scrolled area whose pixels are moved in the draw buffer on the next refresh*/
+    lv_area_t scroll_blit_area;
+    lv_point_t scroll_blit_ofs;         /**< Move the pixels by this much*/
+    uint32_t scroll_blit_pending : 1;   /**< 1: `scroll_blit_area` needs to be moved*/
+#endif
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
@@ -119,6 +136,17 @@ struct _lv_display_t {
     void (*layer_init)(lv_display_t * disp, lv_layer_t * layer);
     void (*layer_deinit)(lv_display_t * disp, lv_layer_t * layer);
 
+    /** Pipelined rendering: the stripe whose draw tasks might be still running and which is not flushed yet*/
+    lv_layer_t * stripe_pending;
+    uint32_t stripe_pending_last : 1;   /**< 1: `stripe_pending` is the last part of the last area */
+    uint32_t stripe_cnt;                /**< Number of stripes rendered in the pipeline */
+    uint32_t stripe_overlap_cnt;        /**< Stripes created while the previous one was still being drawn */
+
+#if LV_DRAW_ARENA_SIZE
+    /** Draw tasks created while refreshing this display are allocated from here*/
+    lv_arena_t draw_arena;
+#endif
+
     /*---------------------
      * Screens
      *--------------------*/
@@ -27,6 +27,10 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 255
+    #error "LV_DRAW_TASK_INDEX_GRID_SIZE should be less than 256"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -36,8 +40,17 @@
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
+static void free_task(lv_draw_task_t * t);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+static void remove_task(lv_layer_t * layer, lv_draw_task_t * t);
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+    static void task_index_create(lv_layer_t * layer);
+    static void task_index_delete(lv_layer_t * layer);
+    static bool task_index_add(lv_draw_task_index_t * index, lv_draw_task_t * t);
+    static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t);
+    static bool remove_finished_ready_tasks(lv_display_t * disp, lv_layer_t * layer);
+#endif
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -101,8 +114,18 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    size_t task_size = LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size;
+#if LV_DRAW_ARENA_SIZE
+    /*Draw tasks are created and freed in every refresh so use the arena of the refreshing display*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    lv_arena_t * arena = disp && disp->rendering_in_progress ? &disp->draw_arena : NULL;
+    lv_draw_task_t * new_task = arena ? lv_arena_alloc_zeroed(arena, task_size) : lv_malloc_zeroed(task_size);
+    LV_ASSERT_MALLOC(new_task);
+    new_task->arena = arena;
+#else
+    lv_draw_task_t * new_task = lv_malloc_zeroed(task_size);
     LV_ASSERT_MALLOC(new_task);
+#endif
     new_task->area = *coords;
     new_task->_real_area = *coords;
     new_task->target_layer = layer;
@@ -111,20 +134,26 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->matrix = layer->matrix;
 #endif
     new_task->opa = layer->opa;
+#if LV_USE_PROFILER
+    _draw_info.task_cnt++;
+#endif
     new_task->type = type;
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_WAITING;
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+    new_task->seq = layer->_task_seq;
+#endif
+    layer->_task_seq++;
 
-    /*Find the tail*/
+    /*Add to the tail*/
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
-
-        tail->next = new_task;
+        layer->draw_task_tail->next = new_task;
+        new_task->prev = layer->draw_task_tail;
     }
+    layer->draw_task_tail = new_task;
 
     LV_PROFILER_DRAW_END;
     return new_task;
@@ -136,6 +165,14 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+    /*The final `_real_area` is known only now, so (re)add the task to the index*/
+    if(layer->_task_index) {
+        if(t->indexed) task_index_remove(layer->_task_index, t);
+        if(!task_index_add(layer->_task_index, t)) task_index_delete(layer);
+    }
+#endif
+
     lv_draw_global_info_t * info = &_draw_info;
 
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
@@ -148,6 +185,14 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             info->task_running = true;
             lv_obj_send_event(base_dsc->obj, LV_EVENT_DRAW_TASK_ADDED, t);
             info->task_running = false;
+
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+            /*The area might have been modified in the event*/
+            if(layer->_task_index && t->indexed) {
+                task_index_remove(layer->_task_index, t);
+                if(!task_index_add(layer->_task_index, t)) task_index_delete(layer);
+            }
+#endif
         }
 
         /*Let the draw units set their preference score*/
@@ -234,24 +279,34 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
     /*Remove the finished tasks first*/
-    lv_draw_task_t * t_prev = NULL;
-    lv_draw_task_t * t = layer->draw_task_head;
-    lv_draw_task_t * t_next;
-    bool remove_task = false;
-    while(t) {
-        t_next = t->next;
-        if(t->state == LV_DRAW_TASK_STATE_FINISHED) {
-            cleanup_task(t, disp);
-            remove_task = true;
-            if(t_prev != NULL)
-                t_prev->next = t_next;
-            else
-                layer->draw_task_head = t_next;
-        }
-        else {
-            t_prev = t;
+    bool task_removed = false;
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+    /*Only the draw tasks without dependencies could be drawn, so it's enough to check them*/
+    if(layer->_task_index) {
+        task_removed = remove_finished_ready_tasks(disp, layer);
+    }
+    else
+#endif
+    {
+        lv_draw_task_t * t = layer->draw_task_head;
+        lv_draw_task_t * t_next;
+        while(t) {
+            t_next = t->next;
+            if(t->state == LV_DRAW_TASK_STATE_FINISHED) {
+                remove_task(layer, t);
+                cleanup_task(t, disp);
+                task_removed = true;
+            }
+            t = t_next;
         }
-        t = t_next;
+    }
+
+    /*All tasks are removed, start a new sequence and drop the index as it's empty now*/
+    if(layer->draw_task_head == NULL) {
+        layer->_task_seq = 0;
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+        task_index_delete(layer);
+#endif
     }
 
     bool task_dispatched = false;
@@ -273,7 +328,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         }
     }
     /*Assign draw tasks to the draw_units*/
-    else if(remove_task || layer->draw_task_head) {
+    else if(task_removed || layer->draw_task_head) {
         /*Find a draw unit which is not busy and can take at least one task*/
         /*Let all draw units to pick draw tasks*/
         lv_draw_unit_t * u = _draw_info.unit_head;
@@ -320,6 +375,14 @@ uint32_t lv_draw_get_unit_count(void)
     return _draw_info.unit_cnt;
 }
 
+uint32_t lv_draw_unit_get_busy_time(lv_draw_unit_t * draw_unit)
+{
+    LV_ASSERT_NULL(draw_unit);
+
+    if(draw_unit->get_busy_time_cb) return draw_unit->get_busy_time_cb(draw_unit);
+    else return draw_unit->busy_time;
+}
+
 lv_draw_task_t * lv_draw_get_available_task(lv_layer_t * layer, lv_draw_task_t * t_prev, uint8_t draw_unit_id)
 {
     if(_draw_info.unit_cnt == 1) {
@@ -347,6 +410,33 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
         }
     }
 
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+    /*With many draw tasks it's worth to index them to find the overlapping ones quickly*/
+    if(layer->_task_index == NULL && layer->_task_seq >= LV_DRAW_TASK_INDEX_MIN_TASK_CNT) {
+        task_index_create(layer);
+    }
+
+    /*The draw tasks without dependencies are independent by definition, so just find a waiting one.
+     *If `t_prev` is not in the list, checking them again from the first is still correct.
+     *Unlike `is_independent()` the draw tasks waiting for a QUEUED draw task of the same draw unit
+     *are not available. No draw unit uses the QUEUED state now, and the SW draw unit's threads
+     *steal tasks from each other so they wouldn't be drawn in order anyway.*/
+    if(layer->_task_index) {
+        lv_draw_task_t * t = t_prev && t_prev->ready ? t_prev->ready_next : layer->_task_index->ready_head;
+        while(t) {
+            if((t->preferred_draw_unit_id == draw_unit_id || t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE) &&
+               t->state == LV_DRAW_TASK_STATE_WAITING) {
+                LV_PROFILER_DRAW_END;
+                return t;
+            }
+            t = t->ready_next;
+        }
+
+        LV_PROFILER_DRAW_END;
+        return NULL;
+    }
+#endif
+
     lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
     while(t) {
         /*Find a draw task for this draw unit which is waiting and independent?*/
@@ -587,6 +677,8 @@ static inline size_t get_draw_dsc_size(lv_draw_task_type_t type)
         /* no struct match for LV_DRAW_TASK_TYPE_MASK_BITMAP, set it to zero now */
         case LV_DRAW_TASK_TYPE_MASK_BITMAP:
             return 0;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            return sizeof(lv_draw_polyline_dsc_t);
 #if LV_USE_VECTOR_GRAPHIC
         case LV_DRAW_TASK_TYPE_VECTOR:
             return sizeof(lv_draw_vector_task_dsc_t);
@@ -657,10 +749,50 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    lv_draw_polyline_dsc_t * draw_polyline_dsc = lv_draw_task_get_polyline_dsc(t);
+    if(draw_polyline_dsc) {
+#if LV_DRAW_ARENA_SIZE
+        if(t->arena) lv_arena_free(t->arena, (void *)draw_polyline_dsc->points);
+        else lv_free((void *)draw_polyline_dsc->points);
+#else
+        lv_free((void *)draw_polyline_dsc->points);
+#endif
+        draw_polyline_dsc->points = NULL;
+    }
+
+    free_task(t);
     LV_PROFILER_DRAW_END;
 }
 
+/**
+ * Free the memory of a draw task
+ * @param t         pointer to a draw task
+ */
+static void free_task(lv_draw_task_t * t)
+{
+#if LV_DRAW_ARENA_SIZE
+    if(t->arena) {
+        lv_arena_free(t->arena, t);
+        return;
+    }
+#endif
+    lv_free(t);
+}
+
+/**
+ * Unlink a draw task from the list of draw tasks of a layer
+ * @param layer     pointer to a layer
+ * @param t         pointer to a draw task of the layer
+ */
+static void remove_task(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    if(t->prev) t->prev->next = t->next;
+    else layer->draw_task_head = t->next;
+
+    if(t->next) t->next->prev = t->prev;
+    else layer->draw_task_tail = t->prev;
+}
+
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -689,3 +821,299 @@ static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
     LV_PROFILER_DRAW_END;
     return t;
 }
+
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+
+static inline uint8_t get_bin_idx(int32_t v, int32_t start, int32_t bin_size)
+{
+    /*Clamp to the edge bins. It keeps the mapping monotonic,
+     *so overlapping areas always share at least one bin*/
+    if(v < start) return 0;
+    int32_t i = (v - start) / bin_size;
+    if(i >= LV_DRAW_TASK_INDEX_GRID_SIZE) return LV_DRAW_TASK_INDEX_GRID_SIZE - 1;
+    return (uint8_t)i;
+}
+
+/**
+ * Get a draw task of a bin
+ * @param bin       pointer to a bin
+ * @param i         index of the draw task counted from the oldest one
+ * @return          pointer to the slot of the draw task in the bin's ring buffer
+ */
+static inline lv_draw_task_t ** bin_at(const lv_draw_task_bin_t * bin, uint32_t i)
+{
+    return &bin->tasks[(bin->first + i) & (bin->capacity - 1)];
+}
+
+/**
+ * Double the capacity of a bin
+ * @param bin       pointer to a bin
+ * @return          true: success; false: out of memory
+ */
+static bool bin_grow(lv_draw_task_bin_t * bin)
+{
+    uint32_t new_capacity = bin->capacity ? bin->capacity * 2 : 8;
+    lv_draw_task_t ** new_tasks = lv_malloc(new_capacity * sizeof(lv_draw_task_t *));
+    if(new_tasks == NULL) return false;
+
+    uint32_t i;
+    for(i = 0; i < bin->cnt; i++) {
+        new_tasks[i] = *bin_at(bin, i);
+    }
+
+    lv_free(bin->tasks);
+    bin->tasks = new_tasks;
+    bin->capacity = new_capacity;
+    bin->first = 0;
+    return true;
+}
+
+/**
+ * Find the first draw task in a bin which is not older than a given sequence number
+ * @param bin       pointer to a bin
+ * @param seq       the sequence number to look for
+ * @return          index of the first task with `seq >= seq`, or `bin->cnt` if there is no such task
+ */
+static uint32_t bin_lower_bound(const lv_draw_task_bin_t * bin, uint32_t seq)
+{
+    uint32_t lo = 0;
+    uint32_t hi = bin->cnt;
+    while(lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if((*bin_at(bin, mid))->seq < seq) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * Add a draw task to the end of the list of the draw tasks without dependencies
+ * @param index     pointer to a draw task index
+ * @param t         pointer to a draw task
+ */
+static void ready_list_add(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    t->ready_prev = index->ready_tail;
+    t->ready_next = NULL;
+    if(index->ready_tail) index->ready_tail->ready_next = t;
+    else index->ready_head = t;
+    index->ready_tail = t;
+    t->ready = 1;
+}
+
+/**
+ * Remove a draw task from the list of the draw tasks without dependencies
+ * @param index     pointer to a draw task index
+ * @param t         pointer to a draw task
+ */
+static void ready_list_remove(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    if(t->ready_prev) t->ready_prev->ready_next = t->ready_next;
+    else index->ready_head = t->ready_next;
+
+    if(t->ready_next) t->ready_next->ready_prev = t->ready_prev;
+    else index->ready_tail = t->ready_prev;
+
+    t->ready_prev = NULL;
+    t->ready_next = NULL;
+    t->ready = 0;
+}
+
+/**
+ * Create the spatial index of a layer and add its current draw tasks to it.
+ * If it fails the layer remains without index and the draw tasks are checked linearly.
+ * @param layer     pointer to a layer
+ */
+static void task_index_create(lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_task_index_t * index = lv_malloc_zeroed(sizeof(lv_draw_task_index_t));
+    if(index == NULL) {
+        LV_LOG_WARN("Couldn't allocate the draw task index");
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    /*Only the clipped part of the buffer is rendered (e.g. a tile of the display's buffer)*/
+    if(!lv_area_intersect(&index->area, &layer->buf_area, &layer->phy_clip_area)) {
+        index->area = layer->buf_area;
+    }
+    int32_t w = lv_area_get_width(&index->area);
+    int32_t h = lv_area_get_height(&index->area);
+    index->bin_w = LV_MAX(1, (w + LV_DRAW_TASK_INDEX_GRID_SIZE - 1) / LV_DRAW_TASK_INDEX_GRID_SIZE);
+    index->bin_h = LV_MAX(1, (h + LV_DRAW_TASK_INDEX_GRID_SIZE - 1) / LV_DRAW_TASK_INDEX_GRID_SIZE);
+    layer->_task_index = index;
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        if(!task_index_add(index, t)) {
+            task_index_delete(layer);
+            break;
+        }
+        t = t->next;
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Free the spatial index of a layer
+ * @param layer     pointer to a layer
+ */
+static void task_index_delete(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = layer->_task_index;
+    if(index == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_INDEX_GRID_SIZE * LV_DRAW_TASK_INDEX_GRID_SIZE; i++) {
+        lv_free(index->bins[i].tasks);
+    }
+    lv_free(index);
+    layer->_task_index = NULL;
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        t->indexed = 0;
+        t->ready = 0;
+        t->ready_prev = NULL;
+        t->ready_next = NULL;
+        t->dep_cnt = 0;
+        t = t->next;
+    }
+}
+
+/**
+ * Add a draw task to all the bins touched by its `_real_area`.
+ * In each bin the draw task waits for the previous (older) draw task of the bin. The previous
+ * draw task waits for the ones before it, so only one dependency per bin needs to be tracked.
+ * The draw tasks sharing a bin are drawn in order even if they don't overlap,
+ * but the draw tasks of the other bins can still be drawn in parallel.
+ * @param index     pointer to a draw task index
+ * @param t         the draw task to add
+ * @return          true: success; false: out of memory
+ */
+static bool task_index_add(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    /*Store the bins as `_real_area` might be changed later (e.g. in `LV_EVENT_DRAW_TASK_ADDED`)
+     *but the task needs to be removed from the same bins*/
+    t->bin_x1 = get_bin_idx(t->_real_area.x1, index->area.x1, index->bin_w);
+    t->bin_y1 = get_bin_idx(t->_real_area.y1, index->area.y1, index->bin_h);
+    t->bin_x2 = get_bin_idx(t->_real_area.x2, index->area.x1, index->bin_w);
+    t->bin_y2 = get_bin_idx(t->_real_area.y2, index->area.y1, index->bin_h);
+    t->dep_cnt = 0;
+
+    int32_t x;
+    int32_t y;
+    for(y = t->bin_y1; y <= t->bin_y2; y++) {
+        for(x = t->bin_x1; x <= t->bin_x2; x++) {
+            lv_draw_task_bin_t * bin = &index->bins[y * LV_DRAW_TASK_INDEX_GRID_SIZE + x];
+            if(bin->cnt == bin->capacity && !bin_grow(bin)) {
+                LV_LOG_WARN("Couldn't allocate memory for the draw task index");
+                return false;
+            }
+
+            /*Usually the task is the newest, but the tasks added in `LV_EVENT_DRAW_TASK_ADDED`
+             *are finalized earlier than the task which triggered the event.*/
+            uint32_t pos = bin->cnt;
+            while(pos > 0 && (*bin_at(bin, pos - 1))->seq > t->seq) {
+                *bin_at(bin, pos) = *bin_at(bin, pos - 1);
+                pos--;
+            }
+            *bin_at(bin, pos) = t;
+            bin->cnt++;
+
+            if(pos > 0) {
+                t->dep_cnt++;
+            }
+            else if(bin->cnt > 1) {
+                /*The previously oldest draw task needs to wait for this one now*/
+                lv_draw_task_t * t_next = *bin_at(bin, 1);
+                if(t_next->ready) ready_list_remove(index, t_next);
+                t_next->dep_cnt++;
+            }
+        }
+    }
+
+    t->indexed = 1;
+    if(t->dep_cnt == 0) ready_list_add(index, t);
+    return true;
+}
+
+/**
+ * Remove a draw task from the bins where it was added.
+ * The next draw task of each bin doesn't need to wait for it anymore.
+ * @param index     pointer to a draw task index
+ * @param t         the draw task to remove
+ */
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    if(t->ready) ready_list_remove(index, t);
+
+    int32_t x;
+    int32_t y;
+    for(y = t->bin_y1; y <= t->bin_y2; y++) {
+        for(x = t->bin_x1; x <= t->bin_x2; x++) {
+            lv_draw_task_bin_t * bin = &index->bins[y * LV_DRAW_TASK_INDEX_GRID_SIZE + x];
+            if(bin->cnt == 0) continue;
+
+            /*A finished draw task has no dependencies, so it's the oldest in all of its bins*/
+            if(*bin_at(bin, 0) == t) {
+                bin->first = (bin->first + 1) & (bin->capacity - 1);
+                bin->cnt--;
+                if(bin->cnt) {
+                    lv_draw_task_t * t_next = *bin_at(bin, 0);
+                    t_next->dep_cnt--;
+                    if(t_next->dep_cnt == 0) ready_list_add(index, t_next);
+                }
+                continue;
+            }
+
+            /*Removed to be added again. The next draw task still waits for the previous one.*/
+            uint32_t i = bin_lower_bound(bin, t->seq);
+            if(i >= bin->cnt || *bin_at(bin, i) != t) continue;
+            for(; i + 1 < bin->cnt; i++) {
+                *bin_at(bin, i) = *bin_at(bin, i + 1);
+            }
+            bin->cnt--;
+        }
+    }
+
+    t->indexed = 0;
+    t->dep_cnt = 0;
+}
+
+/**
+ * Remove the finished draw tasks of an indexed layer.
+ * A draw task can be drawn only when it has no dependencies so only those are checked.
+ * @param disp      pointer to the display on which the draw tasks are drawn
+ * @param layer     pointer to a layer with `_task_index`
+ * @return          true: at least one draw task was removed
+ */
+static bool remove_finished_ready_tasks(lv_display_t * disp, lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = layer->_task_index;
+    bool task_removed = false;
+
+    lv_draw_task_t * t = index->ready_head;
+    while(t) {
+        if(t->state != LV_DRAW_TASK_STATE_FINISHED) {
+            t = t->ready_next;
+            continue;
+        }
+
+        /*If `t` was the last, continue with the draw tasks which became ready by removing it*/
+        lv_draw_task_t * t_next = t->ready_next;
+        lv_draw_task_t * t_ready_prev = t->ready_prev;
+        task_index_remove(index, t);
+        if(t_next == NULL) t_next = t_ready_prev ? t_ready_prev->ready_next : index->ready_head;
+
+        remove_task(layer, t);
+        cleanup_task(t, disp);
+        task_removed = true;
+        t = t_next;
+    }
+
+    return task_removed;
+}
+
+#endif /*LV_DRAW_TASK_INDEX_GRID_SIZE > 0*/
@@ -63,6 +63,7 @@ typedef enum {
 #if LV_USE_3DTEXTURE
     LV_DRAW_TASK_TYPE_3D,
 #endif
+    LV_DRAW_TASK_TYPE_POLYLINE,
 } lv_draw_task_type_t;
 
 typedef enum {
@@ -78,7 +79,9 @@ typedef enum {
      * As the queued task are executed in order it's possible to queue multiple draw task
      * (for the same draw unit) even if they are depending on each other.
      * Therefore `lv_draw_get_available_task` and `lv_draw_get_next_available_task` can return
-     * draw task for the same draw unit even if a dependent draw task is not finished ready yet.*/
+     * draw task for the same draw unit even if a dependent draw task is not finished ready yet.
+     * It's not applied on layers having a draw task index (see `LV_DRAW_TASK_INDEX_GRID_SIZE`),
+     * where only the draw tasks without any unfinished dependencies are returned.*/
     LV_DRAW_TASK_STATE_QUEUED,
 
     /** The draw task is being rendered. This draw task needs to be finished before
@@ -98,6 +101,15 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** The last draw task of the linked list to add new draw tasks quickly */
+    lv_draw_task_t * draw_task_tail;
+
+    /** Spatial index of the draw tasks to speed up the dependency checks. Used internally. */
+    lv_draw_task_index_t * _task_index;
+
+    /** Counts the draw tasks added since the layer became empty. Used internally to order the draw tasks. */
+    uint32_t _task_seq;
+
     /** Parent layer */
     lv_layer_t * parent;
 
@@ -242,6 +254,13 @@ void lv_draw_dispatch_request(void);
   */
 uint32_t lv_draw_get_unit_count(void);
 
+/**
+ * Get the time spent with drawing by a draw unit
+ * @param draw_unit     pointer to a draw unit
+ * @return              the busy time [ms], or 0 if the draw unit doesn't measure it
+ */
+uint32_t lv_draw_unit_get_busy_time(lv_draw_unit_t * draw_unit);
+
 /**
  * If there is only one draw unit check the first draw task if it's available.
  * If there are multiple draw units call `lv_draw_get_next_available_task` to find a task.
@@ -34,6 +34,8 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
+static bool get_clipped_img_area(lv_area_t * clipped_img_area, const lv_draw_task_t * t,
+                                 const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords);
 
 /**********************
  *  STATIC VARIABLES
@@ -212,25 +214,8 @@ void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
-    lv_area_t draw_area;
-    lv_area_copy(&draw_area, coords);
-    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) {
-        int32_t w = lv_area_get_width(coords);
-        int32_t h = lv_area_get_height(coords);
-
-        lv_image_buf_get_transformed_area(&draw_area, w, h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
-                                          &draw_dsc->pivot);
-
-        draw_area.x1 += coords->x1;
-        draw_area.y1 += coords->y1;
-        draw_area.x2 += coords->x1;
-        draw_area.y2 += coords->y1;
-    }
-
     lv_area_t clipped_img_area;
-    if(!lv_area_intersect(&clipped_img_area, &draw_area, &t->clip_area)) {
-        return;
-    }
+    if(!get_clipped_img_area(&clipped_img_area, t, draw_dsc, coords)) return;
 
     lv_image_decoder_dsc_t decoder_dsc;
     lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
@@ -244,6 +229,21 @@ void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
     lv_image_decoder_close(&decoder_dsc);
 }
 
+void lv_draw_image_opened_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
+                                 lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                                 lv_draw_image_core_cb draw_core_cb)
+{
+    if(draw_core_cb == NULL) {
+        LV_LOG_WARN("draw_core_cb is NULL");
+        return;
+    }
+
+    lv_area_t clipped_img_area;
+    if(!get_clipped_img_area(&clipped_img_area, t, draw_dsc, coords)) return;
+
+    img_decode_and_draw(t, draw_dsc, decoder_dsc, NULL, coords, &clipped_img_area, draw_core_cb);
+}
+
 void lv_draw_image_tiled_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
                                 const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb)
 {
@@ -376,3 +376,32 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         }
     }
 }
+
+/**
+ * Get the area of an image (also considering its transformation) which is inside the clip area
+ * @param clipped_img_area  store the result here
+ * @param t                 pointer to a draw task
+ * @param draw_dsc          the draw descriptor of the image
+ * @param coords            the absolute coordinates of the image
+ * @return                  true: the image is visible; false: the image is out of the clip area
+ */
+static bool get_clipped_img_area(lv_area_t * clipped_img_area, const lv_draw_task_t * t,
+                                 const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords)
+{
+    lv_area_t draw_area;
+    lv_area_copy(&draw_area, coords);
+    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) {
+        int32_t w = lv_area_get_width(coords);
+        int32_t h = lv_area_get_height(coords);
+
+        lv_image_buf_get_transformed_area(&draw_area, w, h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
+                                          &draw_dsc->pivot);
+
+        draw_area.x1 += coords->x1;
+        draw_area.y1 += coords->y1;
+        draw_area.x2 += coords->x1;
+        draw_area.y2 += coords->y1;
+    }
+
+    return lv_area_intersect(clipped_img_area, &draw_area, &t->clip_area);
+}
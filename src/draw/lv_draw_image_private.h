@@ -50,6 +50,19 @@ struct _lv_draw_image_sup_t {
 void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
                                  const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb);
 
+/**
+ * Same as `lv_draw_image_normal_helper` but draw an image which is already opened.
+ * Useful to draw the same image in more steps without decoding it again.
+ * @param t             pointer to a draw task
+ * @param draw_dsc      the draw descriptor of the image
+ * @param decoder_dsc   the opened image
+ * @param coords        the absolute coordinates of the image
+ * @param draw_core_cb  a callback to perform the actual rendering
+ */
+void lv_draw_image_opened_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
+                                 lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                                 lv_draw_image_core_cb draw_core_cb);
+
 /**
  * Can be used by draw units for TILED images to handle the decoding and
  * prepare everything for the actual image rendering
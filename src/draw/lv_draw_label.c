@@ -253,58 +253,82 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_end;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
-        /*If the label changed too much recalculate the hint.*/
-        if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
-            dsc->hint->line_start = -1;
-        }
-        last_line_start = dsc->hint->line_start;
-    }
-
-    /*Use the hint if it's valid*/
-    if(dsc->hint && last_line_start >= 0) {
-        line_start = last_line_start;
-        pos.y += dsc->hint->y;
-    }
-
     uint32_t remaining_len = dsc->text_length;
     lv_text_attributes_t attributes = {0};
     attributes.letter_space = dsc->letter_space;
     attributes.text_flags = dsc->flag;
     attributes.max_width = w;
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+    /*Use the pre-calculated lines if they were calculated with the same parameters*/
+    const lv_draw_label_lines_t * lines = NULL;
+    uint32_t line_idx = 0;
+    if(dsc->lines && line_height > 0 && remaining_len == LV_TEXT_LEN_MAX &&
+       lv_draw_label_lines_is_valid(dsc->lines, dsc->text, font, &attributes)) {
+        lines = dsc->lines;
+    }
 
-    /*Go the first visible line*/
-    while(pos.y + line_height_font < t->clip_area.y1) {
-        /*Go to next line*/
-        remaining_len -= line_end - line_start;
-        line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
-        pos.y += line_height;
+    if(lines) {
+        /*Jump to the first visible line*/
+        int32_t dist = t->clip_area.y1 - (pos.y + line_height_font);
+        if(dist > 0) line_idx = (dist + line_height - 1) / line_height;
+        if(line_idx >= lines->line_cnt) return;
 
-        /*Save at the threshold coordinate*/
-        if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
-            dsc->hint->line_start = line_start;
-            dsc->hint->y          = pos.y - coords->y1;
-            dsc->hint->coord_y    = coords->y1;
+        pos.y += (int32_t)line_idx * line_height;
+        line_start = lines->lines[line_idx].start;
+        line_end = lines->lines[line_idx + 1].start;
+        remaining_len -= line_start;
+    }
+    else {
+        /*Check the hint to use the cached info*/
+        if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+            /*If the label changed too much recalculate the hint.*/
+            if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
+                dsc->hint->line_start = -1;
+            }
+            last_line_start = dsc->hint->line_start;
+        }
+
+        /*Use the hint if it's valid*/
+        if(dsc->hint && last_line_start >= 0) {
+            line_start = last_line_start;
+            pos.y += dsc->hint->y;
         }
 
-        if(dsc->text[line_start] == '\0') return;
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+
+        /*Go the first visible line*/
+        while(pos.y + line_height_font < t->clip_area.y1) {
+            /*Go to next line*/
+            remaining_len -= line_end - line_start;
+            line_start = line_end;
+            line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+            pos.y += line_height;
+
+            /*Save at the threshold coordinate*/
+            if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
+                dsc->hint->line_start = line_start;
+                dsc->hint->y          = pos.y - coords->y1;
+                dsc->hint->coord_y    = coords->y1;
+            }
+
+            if(dsc->text[line_start] == '\0') return;
+        }
     }
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
+        if(lines) line_width = lines->lines[line_idx].width;
+        else line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
+        if(lines) line_width = lines->lines[line_idx].width;
+        else line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -532,22 +556,26 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         /*Go to next line*/
         remaining_len -= line_end - line_start;
         line_start = line_end;
-        if(remaining_len) {
+        if(lines) {
+            line_idx++;
+            if(line_idx < lines->line_cnt) line_end = lines->lines[line_idx + 1].start;
+        }
+        else if(remaining_len) {
             line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &text_attributes);
         }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
+            if(lines) line_width = lines->lines[line_idx].width;
+            else line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
+            if(lines) line_width = lines->lines[line_idx].width;
+            else line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -562,6 +590,93 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                const lv_text_attributes_t * attributes)
+{
+    LV_ASSERT_NULL(lines);
+    LV_ASSERT_NULL(text);
+    LV_ASSERT_NULL(font);
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    lines->text = NULL;
+    lines->line_cnt = 0;
+
+    /*`lv_text_get_next_line` might modify it*/
+    lv_text_attributes_t attr = *attributes;
+
+    uint32_t line_start = 0;
+    while(1) {
+        /*Keep space for the closing line too*/
+        if(lines->line_cnt + 1 >= lines->size) {
+            uint32_t new_size = lines->size ? lines->size * 2 : 8;
+            lv_draw_label_line_t * new_lines = lv_realloc(lines->lines, new_size * sizeof(lv_draw_label_line_t));
+            if(new_lines == NULL) {
+                LV_PROFILER_DRAW_END;
+                return false;
+            }
+            lines->lines = new_lines;
+            lines->size = new_size;
+        }
+
+        lv_draw_label_line_t * line = &lines->lines[lines->line_cnt];
+        line->start = line_start;
+        if(text[line_start] == '\0') {
+            line->width = 0;
+            break;
+        }
+
+        uint32_t line_end = line_start + lv_text_get_next_line(&text[line_start], LV_TEXT_LEN_MAX, font, NULL, &attr);
+        line->width = lv_text_get_width(&text[line_start], line_end - line_start, font, &attr);
+        lines->line_cnt++;
+        line_start = line_end;
+    }
+
+    lines->text = text;
+    lines->font = font;
+    lines->letter_space = attributes->letter_space;
+    lines->max_width = attributes->max_width;
+    lines->flag = attributes->text_flags;
+
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+bool lv_draw_label_lines_is_valid(const lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                  const lv_text_attributes_t * attributes)
+{
+    if(lines->text == NULL || lines->text != text) return false;
+    if(lines->font != font) return false;
+    if(lines->letter_space != attributes->letter_space) return false;
+    if(lines->flag != attributes->text_flags) return false;
+
+    /*The width doesn't matter if only the new line characters break the lines*/
+    if(lines->flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) return true;
+    return lines->max_width == attributes->max_width;
+}
+
+uint32_t lv_draw_label_lines_find(const lv_draw_label_lines_t * lines, uint32_t byte_id)
+{
+    LV_ASSERT(lines->line_cnt > 0);
+
+    /*Find the first line which ends after `byte_id`*/
+    uint32_t min = 0;
+    uint32_t max = lines->line_cnt - 1;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if(lines->lines[mid + 1].start > byte_id) max = mid;
+        else min = mid + 1;
+    }
+
+    return min;
+}
+
+void lv_draw_label_lines_reset(lv_draw_label_lines_t * lines)
+{
+    lv_free(lines->lines);
+    lv_memzero(lines, sizeof(lv_draw_label_lines_t));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -107,6 +107,10 @@ typedef struct {
     /**Pointer to an externally stored struct where some data can be cached to speed up rendering*/
     lv_draw_label_hint_t * hint;
 
+    /**Pointer to the pre-calculated line breaks of `text`.
+     * Used only if they were calculated with the same font, width and flags.*/
+    const lv_draw_label_lines_t * lines;
+
     /* Properties of the letter outlines */
     lv_color_t outline_stroke_color;
     int32_t outline_stroke_width;
@@ -41,6 +41,35 @@ struct _lv_draw_label_hint_t {
     int32_t coord_y;
 };
 
+/** Start and width of a line of a text*/
+typedef struct {
+    /** Byte index of the first character of the line*/
+    uint32_t start;
+
+    /** Width of the line in pixels*/
+    int32_t width;
+} lv_draw_label_line_t;
+
+/** Store where the lines of a text begin to avoid wrapping the text again and again on every draw.
+ * The `y` coordinate of a line is simply `line index * (line height + line space)`.*/
+struct _lv_draw_label_lines_t {
+    /** `line_cnt + 1` lines. The last one is at the terminating `\0` and has 0 width*/
+    lv_draw_label_line_t * lines;
+
+    /** Number of lines in the text*/
+    uint32_t line_cnt;
+
+    /** Number of allocated elements in `lines`*/
+    uint32_t size;
+
+    /** The text and the parameters used to calculate the lines. `text == NULL` means invalid lines.*/
+    const char * text;
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;
+    lv_text_flag_t flag;
+};
+
 struct _lv_draw_glyph_dsc_t {
     /** Depends on `format` field, it could be image source or draw buf of bitmap or vector data. */
     const void * glyph_data;
@@ -63,6 +92,42 @@ struct _lv_draw_glyph_dsc_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Calculate where the lines of a text begin and store them with the parameters used for the calculation.
+ * @param lines         pointer to a line table. The already allocated memory will be reused.
+ * @param text          the text to process
+ * @param font          the font of the text
+ * @param attributes    letter space, max width and flags are used
+ * @return              true: success; false: out of memory, `lines` is invalid
+ */
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                const lv_text_attributes_t * attributes);
+
+/**
+ * Check if a line table can be used to type set a text with the given parameters.
+ * @param lines         pointer to a line table
+ * @param text          the text to process
+ * @param font          the font of the text
+ * @param attributes    letter space, max width and flags are used
+ * @return              true: the table is valid for the given parameters
+ */
+bool lv_draw_label_lines_is_valid(const lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                  const lv_text_attributes_t * attributes);
+
+/**
+ * Find the line which contains a byte of the text
+ * @param lines         pointer to a valid line table with at least one line
+ * @param byte_id       byte index in the text
+ * @return              index of the line. The last line if `byte_id` is the end of the text.
+ */
+uint32_t lv_draw_label_lines_find(const lv_draw_label_lines_t * lines, uint32_t byte_id);
+
+/**
+ * Free the memory allocated for a line table
+ * @param lines         pointer to a line table
+ */
+void lv_draw_label_lines_reset(lv_draw_label_lines_t * lines);
+
 /**********************
  *      MACROS
  **********************/
@@ -7,9 +7,11 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_private.h"
+#include "lv_draw_rect.h"
 #include "../core/lv_refr.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_types.h"
+#include "../misc/lv_arena.h"
 #include "../stdlib/lv_string.h"
 
 /*********************
@@ -23,6 +25,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void draw_polyline_fallback(lv_layer_t * layer, const lv_draw_polyline_dsc_t * dsc, bool has_line,
+                                   bool has_marker);
 
 /**********************
  *  STATIC VARIABLES
@@ -71,6 +75,143 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_line(lv_layer_t * layer, const lv_draw_line_d
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_polyline_dsc_init(lv_draw_polyline_dsc_t * dsc)
+{
+    lv_memzero(dsc, sizeof(lv_draw_polyline_dsc_t));
+    dsc->width = 1;
+    dsc->opa = LV_OPA_COVER;
+    dsc->color = lv_color_black();
+    dsc->marker_opa = LV_OPA_COVER;
+    dsc->marker_color = lv_color_black();
+    dsc->base.dsc_size = sizeof(lv_draw_polyline_dsc_t);
+}
+
+lv_draw_polyline_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task)
+{
+    return task->type == LV_DRAW_TASK_TYPE_POLYLINE ? (lv_draw_polyline_dsc_t *)task->draw_dsc : NULL;
+}
+
+bool lv_draw_polyline_is_supported(void)
+{
+#if LV_USE_DRAW_SW
+    /*Only the SW draw unit can draw polylines (with any number of threads). Other draw units
+     *might take all the draw tasks (e.g. SDL) or draw the lines in a faster way (e.g. VG-Lite)*/
+    return lv_draw_get_unit_count() == 1;
+#else
+    return false;
+#endif
+}
+
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_polyline_dsc_t * dsc)
+{
+    if(dsc->point_cnt == 0 || dsc->points == NULL) return;
+
+    bool has_line = dsc->point_cnt >= 2 && dsc->width > 0 && dsc->opa > LV_OPA_MIN;
+    bool has_marker = dsc->marker_w > 0 && dsc->marker_h > 0 && dsc->marker_opa > LV_OPA_MIN;
+    if(!has_line && !has_marker) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    if(!lv_draw_polyline_is_supported()) {
+        draw_polyline_fallback(layer, dsc, has_line, has_marker);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    int32_t ext_x = LV_MAX(has_line ? dsc->width : 0, has_marker ? dsc->marker_w : 0);
+    int32_t ext_y = LV_MAX(has_line ? dsc->width : 0, has_marker ? dsc->marker_h : 0);
+
+    lv_area_t a;
+    a.x1 = (int32_t)dsc->points[0].x;
+    a.x2 = a.x1;
+    a.y1 = (int32_t)dsc->points[0].y;
+    a.y2 = a.y1;
+    uint32_t i;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        int32_t x = (int32_t)dsc->points[i].x;
+        int32_t y = (int32_t)dsc->points[i].y;
+        if(x < a.x1) a.x1 = x;
+        if(x > a.x2) a.x2 = x;
+        if(y < a.y1) a.y1 = y;
+        if(y > a.y2) a.y2 = y;
+    }
+    lv_area_increase(&a, ext_x, ext_y);
+
+    lv_draw_task_t * t = lv_draw_add_task(layer, &a, LV_DRAW_TASK_TYPE_POLYLINE);
+
+    lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
+
+    /*The points are needed until the task is drawn so keep a local copy.
+     *It's allocated like the task and freed when the task is cleaned up.*/
+    lv_draw_polyline_dsc_t * new_dsc = t->draw_dsc;
+    size_t points_size = dsc->point_cnt * sizeof(lv_point_precise_t);
+#if LV_DRAW_ARENA_SIZE
+    lv_point_precise_t * points = t->arena ? lv_arena_alloc_zeroed(t->arena, points_size) : lv_malloc(points_size);
+#else
+    lv_point_precise_t * points = lv_malloc(points_size);
+#endif
+    LV_ASSERT_MALLOC(points);
+    if(points) lv_memcpy(points, dsc->points, points_size);
+    else new_dsc->point_cnt = 0;
+    new_dsc->points = points;
+
+    lv_draw_finalize_task_creation(layer, t);
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Draw a polyline with a line draw task per segment and a fill draw task per marker
+ * for the draw units which can't draw polylines
+ * @param layer         pointer to a layer
+ * @param dsc           pointer to a polyline draw descriptor
+ * @param has_line      true: draw the segments
+ * @param has_marker    true: draw the markers
+ */
+static void draw_polyline_fallback(lv_layer_t * layer, const lv_draw_polyline_dsc_t * dsc, bool has_line,
+                                   bool has_marker)
+{
+    uint32_t i;
+    if(has_line) {
+        lv_draw_line_dsc_t line_dsc;
+        lv_draw_line_dsc_init(&line_dsc);
+        line_dsc.base = dsc->base;
+        line_dsc.base.dsc_size = sizeof(lv_draw_line_dsc_t);
+        line_dsc.color = dsc->color;
+        line_dsc.width = dsc->width;
+        line_dsc.dash_width = dsc->dash_width;
+        line_dsc.dash_gap = dsc->dash_gap;
+        line_dsc.opa = dsc->opa;
+        line_dsc.round_start = dsc->round_start;
+        line_dsc.round_end = dsc->round_end;
+        line_dsc.raw_end = dsc->raw_end;
+
+        for(i = 1; i < dsc->point_cnt; i++) {
+            line_dsc.p1 = dsc->points[i - 1];
+            line_dsc.p2 = dsc->points[i];
+            lv_draw_line(layer, &line_dsc);
+        }
+    }
+
+    if(has_marker) {
+        lv_draw_fill_dsc_t fill_dsc;
+        lv_draw_fill_dsc_init(&fill_dsc);
+        fill_dsc.base = dsc->base;
+        fill_dsc.base.dsc_size = sizeof(lv_draw_fill_dsc_t);
+        fill_dsc.color = dsc->marker_color;
+        fill_dsc.opa = dsc->marker_opa;
+        fill_dsc.radius = dsc->marker_radius;
+
+        for(i = 0; i < dsc->point_cnt; i++) {
+            lv_area_t marker_area;
+            marker_area.x1 = (int32_t)dsc->points[i].x - dsc->marker_w;
+            marker_area.x2 = (int32_t)dsc->points[i].x + dsc->marker_w;
+            marker_area.y1 = (int32_t)dsc->points[i].y - dsc->marker_h;
+            marker_area.y2 = (int32_t)dsc->points[i].y + dsc->marker_h;
+            lv_draw_fill(layer, &fill_dsc, &marker_area);
+        }
+    }
+}
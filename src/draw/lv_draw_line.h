@@ -60,6 +60,57 @@ typedef struct {
     uint8_t raw_end     : 1;
 } lv_draw_line_dsc_t;
 
+typedef struct {
+    lv_draw_dsc_base_t base;
+
+    /**The points of the polyline. They are copied when the draw task is created.
+     * If `LV_USE_FLOAT` is enabled float numbers can be also used*/
+    const lv_point_precise_t * points;
+
+    /**Number of points in `points`*/
+    uint32_t point_cnt;
+
+    /**The color of the segments*/
+    lv_color_t color;
+
+    /**The width (thickness) of the segments (0: draw only the markers)*/
+    int32_t width;
+
+    /** The length of a dash (0: don't dash)*/
+    int32_t dash_width;
+
+    /** The length of the gaps between dashes (0: don't dash)*/
+    int32_t dash_gap;
+
+    /**Opacity of the segments in 0...255 range.*/
+    lv_opa_t opa;
+
+    /**Make the start of each segment rounded*/
+    uint8_t round_start : 1;
+
+    /**Make the end of each segment rounded*/
+    uint8_t round_end   : 1;
+
+    /**1: Do not bother with the segment endings (if they are not visible for any reason) */
+    uint8_t raw_end     : 1;
+
+    /**Half width of the markers drawn on the points. The marker spans `x - marker_w ... x + marker_w`.
+     * 0: don't draw markers*/
+    int32_t marker_w;
+
+    /**Half height of the markers drawn on the points. 0: don't draw markers*/
+    int32_t marker_h;
+
+    /**Radius of the markers*/
+    int32_t marker_radius;
+
+    /**Color of the markers*/
+    lv_color_t marker_color;
+
+    /**Opacity of the markers*/
+    lv_opa_t marker_opa;
+} lv_draw_polyline_dsc_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -84,6 +135,37 @@ lv_draw_line_dsc_t * lv_draw_task_get_line_dsc(lv_draw_task_t * task);
  */
 void lv_draw_line(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Initialize a polyline draw descriptor
+ * @param dsc       pointer to a draw descriptor
+ */
+void lv_draw_polyline_dsc_init(lv_draw_polyline_dsc_t * dsc);
+
+/**
+ * Try to get a polyline draw descriptor from a draw task.
+ * @param task      draw task
+ * @return          the task's draw descriptor or NULL if the task is not of type LV_DRAW_TASK_TYPE_POLYLINE
+ */
+lv_draw_polyline_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task);
+
+/**
+ * Check if polylines are drawn with a single draw task by the draw units in use.
+ * Only the software renderer supports this task type.
+ * @return          true: the SW draw unit is the only draw unit
+ */
+bool lv_draw_polyline_is_supported(void);
+
+/**
+ * Create a single draw task which draws the segments between the consecutive points
+ * and optionally a marker on each point.
+ * It's much cheaper than drawing the segments one by one with `lv_draw_line`.
+ * If other draw units are used too (see `lv_draw_polyline_is_supported`)
+ * a line draw task is created for each segment and a fill draw task for each marker instead.
+ * @param layer     pointer to a layer
+ * @param dsc       pointer to an initialized `lv_draw_polyline_dsc_t` variable
+ */
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_polyline_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
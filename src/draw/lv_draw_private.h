@@ -32,6 +32,7 @@ extern "C" {
 
 struct _lv_draw_task_t {
     lv_draw_task_t * next;
+    lv_draw_task_t * prev;
 
     lv_draw_task_type_t type;
 
@@ -84,6 +85,34 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+    /** Creation order of the draw task in its layer. Used to find the older draw tasks in the bins.*/
+    uint32_t seq;
+
+    /** The range of bins in which the draw task is stored in the layer's `_task_index` */
+    uint8_t bin_x1;
+    uint8_t bin_y1;
+    uint8_t bin_x2;
+    uint8_t bin_y2;
+
+    /** Number of bins of the layer's `_task_index` in which this draw task waits for an older draw task*/
+    uint32_t dep_cnt;
+
+    /** Links in the list of the draw tasks without dependencies (`dep_cnt == 0`) */
+    lv_draw_task_t * ready_prev;
+    lv_draw_task_t * ready_next;
+
+    /** 1: the draw task is stored in the layer's `_task_index`*/
+    uint8_t indexed : 1;
+
+    /** 1: the draw task is in the list of the draw tasks without dependencies*/
+    uint8_t ready : 1;
+#endif
+
+#if LV_DRAW_ARENA_SIZE
+    /** The arena from which the draw task and its temporary data were allocated or NULL if `lv_malloc` was used*/
+    lv_arena_t * arena;
+#endif
 };
 
 struct _lv_draw_mask_t {
@@ -99,6 +128,13 @@ struct _lv_draw_unit_t {
     const char * name;
     int32_t idx;
 
+    /**
+     * Time spent with drawing [ms]. Updated by the draw unit (optional) if `LV_USE_SYSMON` is enabled,
+     * used by the performance monitor to measure the load of the draw units.
+     * If it's measured in multiple threads use `get_busy_time_cb` instead.
+     */
+    volatile uint32_t busy_time;
+
     /**
      * Called to try to assign a draw task to itself.
      * `lv_draw_get_next_available_task` can be used to get an independent draw task.
@@ -174,7 +210,38 @@ struct _lv_draw_unit_t {
      * @return
      */
     int32_t (*delete_cb)(lv_draw_unit_t * draw_unit);
+
+    /**
+     * Get the time spent with drawing (optional). If not set `busy_time` is used.
+     * @param draw_unit     pointer to the draw unit
+     * @return              the time spent with drawing so far [ms]
+     */
+    uint32_t (*get_busy_time_cb)(lv_draw_unit_t * draw_unit);
+};
+
+#if LV_DRAW_TASK_INDEX_GRID_SIZE > 0
+typedef struct {
+    /** Ring buffer of the draw tasks touching the bin ordered by their creation.
+     * Only the first (oldest) one can be drawn.*/
+    lv_draw_task_t ** tasks;
+    uint32_t first;     /**< Index of the oldest draw task in `tasks`*/
+    uint32_t cnt;
+    uint32_t capacity;  /**< Size of `tasks`. Always a power of 2.*/
+} lv_draw_task_bin_t;
+
+struct _lv_draw_task_index_t {
+    /** The area of the layer covered by the bins. Draw tasks outside of it are stored in the edge bins.*/
+    lv_area_t area;
+    int32_t bin_w;
+    int32_t bin_h;
+    lv_draw_task_bin_t bins[LV_DRAW_TASK_INDEX_GRID_SIZE * LV_DRAW_TASK_INDEX_GRID_SIZE];
+
+    /** The indexed draw tasks which don't overlap with any older indexed draw tasks.
+     * Only these can be available, so the draw units need to check only them.*/
+    lv_draw_task_t * ready_head;
+    lv_draw_task_t * ready_tail;
 };
+#endif
 
 typedef struct {
     lv_draw_unit_t * unit_head;
@@ -187,6 +254,9 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_USE_PROFILER
+    uint32_t task_cnt;  /**< Draw tasks added since the last refresh, reported as a profiler counter*/
+#endif
 } lv_draw_global_info_t;
 
 /**********************
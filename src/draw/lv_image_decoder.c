@@ -19,6 +19,7 @@
 #define img_decoder_ll_p &(LV_GLOBAL_DEFAULT()->img_decoder_ll)
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
+#define img_decoder_lock_p &(LV_GLOBAL_DEFAULT()->img_decoder_lock)
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
 /**********************
@@ -41,6 +42,8 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 
+static lv_result_t decode(lv_image_decoder_dsc_t * dsc, const lv_image_decoder_args_t * args);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -60,6 +63,10 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
 {
     lv_ll_init(img_decoder_ll_p, sizeof(lv_image_decoder_t));
 
+#if LV_USE_OS
+    lv_mutex_init(img_decoder_lock_p);
+#endif
+
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
@@ -74,6 +81,10 @@ void lv_image_decoder_deinit(void)
     lv_cache_destroy(img_header_cache_p, NULL);
 
     lv_ll_clear(img_decoder_ll_p);
+
+#if LV_USE_OS
+    lv_mutex_delete(img_decoder_lock_p);
+#endif
 }
 
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header)
@@ -105,46 +116,21 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
             * Check the cache first
             * If the image is found in the cache, just return it.*/
             if(try_cache(dsc) == LV_RESULT_OK) return LV_RESULT_OK;
-        }
-    }
-
-    /*Find the decoder that can open the image source, and get the header info in the same time.*/
-    dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
-    if(dsc->decoder == NULL) return LV_RESULT_INVALID;
-
-    /*Make a copy of args*/
-    dsc->args = args ? *args : (lv_image_decoder_args_t) {
-        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
-        .premultiply = false,
-        .no_cache = false,
-        .use_indexed = false,
-        .flush_cache = false,
-    };
 
-    /*
-     * We assume that if a decoder can get the info, it can open the image.
-     * If decoder open failed, free the source and return error.
-     * If decoder open succeed, add the image to cache if enabled.
-     * */
-    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
-
-    if(res == LV_RESULT_OK && dsc->decoded != NULL) {
-        LV_ASSERT_MSG(dsc->decoded->unaligned_data && dsc->decoded->handlers, "Invalid draw buffer");
-
-        /* Flush the D-Cache if enabled and the image was successfully opened */
-        if(dsc->args.flush_cache) {
-            lv_draw_buf_flush_cache(dsc->decoded, NULL);
-            LV_LOG_INFO("Flushed D-cache: src %p (%s) (W%d x H%d, data: %p cf: %d)",
-                        src,
-                        dsc->src_type == LV_IMAGE_SRC_FILE ? (const char *)src : "c-array",
-                        dsc->decoded->header.w,
-                        dsc->decoded->header.h,
-                        (void *)dsc->decoded->data,
-                        dsc->decoded->header.cf);
+#if LV_USE_OS
+            /*An other draw thread might be decoding the same image right now.
+             *Adding it to the cache again would overwrite the other thread's entry,
+             *so decode the images not found in the cache one by one.*/
+            lv_mutex_lock(img_decoder_lock_p);
+            lv_result_t res = try_cache(dsc);
+            if(res != LV_RESULT_OK) res = decode(dsc, args);
+            lv_mutex_unlock(img_decoder_lock_p);
+            return res;
+#endif
         }
     }
 
-    return res;
+    return decode(dsc, args);
 }
 
 lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
@@ -416,3 +402,50 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 
     return LV_RESULT_INVALID;
 }
+
+/**
+ * Find the decoder of an image and open the image with it.
+ * @param dsc       the descriptor with the source of the image
+ * @param args      the decoder arguments or NULL to use the defaults
+ * @return          LV_RESULT_OK: the image was opened; LV_RESULT_INVALID: it can't be opened
+ */
+static lv_result_t decode(lv_image_decoder_dsc_t * dsc, const lv_image_decoder_args_t * args)
+{
+    /*Find the decoder that can open the image source, and get the header info in the same time.*/
+    dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
+    if(dsc->decoder == NULL) return LV_RESULT_INVALID;
+
+    /*Make a copy of args*/
+    dsc->args = args ? *args : (lv_image_decoder_args_t) {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = false,
+        .no_cache = false,
+        .use_indexed = false,
+        .flush_cache = false,
+    };
+
+    /*
+     * We assume that if a decoder can get the info, it can open the image.
+     * If decoder open failed, free the source and return error.
+     * If decoder open succeed, add the image to cache if enabled.
+     * */
+    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+
+    if(res == LV_RESULT_OK && dsc->decoded != NULL) {
+        LV_ASSERT_MSG(dsc->decoded->unaligned_data && dsc->decoded->handlers, "Invalid draw buffer");
+
+        /* Flush the D-Cache if enabled and the image was successfully opened */
+        if(dsc->args.flush_cache) {
+            lv_draw_buf_flush_cache(dsc->decoded, NULL);
+            LV_LOG_INFO("Flushed D-cache: src %p (%s) (W%d x H%d, data: %p cf: %d)",
+                        dsc->src,
+                        dsc->src_type == LV_IMAGE_SRC_FILE ? (const char *)dsc->src : "c-array",
+                        dsc->decoded->header.w,
+                        dsc->decoded->header.h,
+                        (void *)dsc->decoded->data,
+                        dsc->decoded->header.cf);
+        }
+    }
+
+    return res;
+}
@@ -837,11 +837,11 @@ static void _draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const l
     dsc->g = &g;
     _draw_nema_gfx_letter(t, dsc, NULL, NULL);
 
-    if(g.resolved_font && font->release_glyph) {
+    if(g.resolved_font && g.entry) {
         lv_draw_nema_gfx_unit_t * draw_nema_gfx_unit = (lv_draw_nema_gfx_unit_t *)t->draw_unit;
         nema_cl_submit(&(draw_nema_gfx_unit->cl));
         nema_cl_wait(&(draw_nema_gfx_unit->cl));
-        font->release_glyph(font, &g);
+        lv_font_glyph_release_draw_data(&g);
     }
 
     LV_PROFILER_DRAW_END;
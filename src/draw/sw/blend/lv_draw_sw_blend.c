@@ -40,6 +40,12 @@
  *      DEFINES
  *********************/
 
+/*Shorter masked lines are blended without looking for spans*/
+#define SPAN_BLEND_MIN_WIDTH    32
+
+/*Enough for the rounded edges of two radius masks on a line*/
+#define SPAN_MAX                8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,6 +54,14 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ blend_part(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                                                   const lv_area_t * blend_area, lv_opa_t opa, bool masked);
+
+#if LV_DRAW_SW_COMPLEX
+static void /* LV_ATTRIBUTE_FAST_MEM */ blend_spans(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                                                    const lv_area_t * blend_area);
+#endif
+
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color(lv_color_format_t layer_cf,
                                                                       lv_draw_sw_blend_fill_dsc_t * fill_dsc);
 
@@ -78,7 +92,6 @@ void lv_draw_sw_blend(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_d
 
     LV_PROFILER_DRAW_BEGIN;
     lv_layer_t * layer = t->target_layer;
-    uint32_t layer_stride_byte = layer->draw_buf->header.stride;
 
     lv_draw_sw_blend_handler_t handler = lv_draw_sw_get_blend_handler(layer->color_format);
     if(handler) {
@@ -87,89 +100,157 @@ void lv_draw_sw_blend(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_d
         return;
     }
 
+    if(blend_dsc->src_buf) {
+        if(!lv_area_intersect(&blend_area, &blend_area, blend_dsc->src_area)) {
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+
+        if(blend_dsc->mask_area && !lv_area_intersect(&blend_area, &blend_area, blend_dsc->mask_area)) {
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+    }
+
+    bool masked = blend_dsc->mask_buf && blend_dsc->mask_res != LV_DRAW_SW_MASK_RES_FULL_COVER;
+
+#if LV_DRAW_SW_COMPLEX
+    /*Lines are masked e.g. only at the rounded edges, so draw the rest without the mask.
+     *Images are always blended with the mask, as the image blenders mix it with the source's alpha.*/
+    if(masked && blend_dsc->src_buf == NULL && blend_dsc->opa >= LV_OPA_MAX &&
+       lv_area_get_height(&blend_area) == 1 && lv_area_get_width(&blend_area) >= SPAN_BLEND_MIN_WIDTH) {
+        blend_spans(t, blend_dsc, &blend_area);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
+    blend_part(t, blend_dsc, &blend_area, blend_dsc->opa, masked);
+    LV_PROFILER_DRAW_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Blend an area of the blend descriptor
+ * @param t             pointer to a draw task
+ * @param blend_dsc     pointer to the blend descriptor
+ * @param blend_area    the area to blend. Already clipped to the layer, source and mask area.
+ * @param opa           opacity to use instead of `blend_dsc->opa`
+ * @param masked        true: apply `blend_dsc->mask_buf`; false: ignore the mask
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_part(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                                             const lv_area_t * blend_area, lv_opa_t opa, bool masked)
+{
+    lv_layer_t * layer = t->target_layer;
+    uint32_t layer_stride_byte = layer->draw_buf->header.stride;
+
     if(blend_dsc->src_buf == NULL) {
         lv_draw_sw_blend_fill_dsc_t fill_dsc;
-        fill_dsc.dest_w = lv_area_get_width(&blend_area);
-        fill_dsc.dest_h = lv_area_get_height(&blend_area);
+        fill_dsc.dest_w = lv_area_get_width(blend_area);
+        fill_dsc.dest_h = lv_area_get_height(blend_area);
         fill_dsc.dest_stride = layer_stride_byte;
-        fill_dsc.opa = blend_dsc->opa;
+        fill_dsc.opa = opa;
         fill_dsc.color = blend_dsc->color;
         fill_dsc.mask_stride = 0;
+        fill_dsc.mask_buf = masked ? blend_dsc->mask_buf : NULL;
 
-        if(blend_dsc->mask_buf == NULL) fill_dsc.mask_buf = NULL;
-        else if(blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) fill_dsc.mask_buf = NULL;
-        else fill_dsc.mask_buf = blend_dsc->mask_buf;
-
-
-        fill_dsc.relative_area  = blend_area;
+        fill_dsc.relative_area  = *blend_area;
         lv_area_move(&fill_dsc.relative_area, -layer->buf_area.x1, -layer->buf_area.y1);
-        fill_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
-                                                   blend_area.y1 - layer->buf_area.y1);
+        fill_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area->x1 - layer->buf_area.x1,
+                                                   blend_area->y1 - layer->buf_area.y1);
         if(fill_dsc.mask_buf) {
             fill_dsc.mask_stride = blend_dsc->mask_stride == 0  ? lv_area_get_width(blend_dsc->mask_area) : blend_dsc->mask_stride;
-            fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
-                                 (blend_area.x1 - blend_dsc->mask_area->x1);
+            fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area->y1 - blend_dsc->mask_area->y1) +
+                                 (blend_area->x1 - blend_dsc->mask_area->x1);
         }
 
         lv_draw_sw_blend_color(layer->color_format, &fill_dsc);
     }
     else {
-        if(!lv_area_intersect(&blend_area, &blend_area, blend_dsc->src_area)) {
-            LV_PROFILER_DRAW_END;
-            return;
-        }
-
-        if(blend_dsc->mask_area && !lv_area_intersect(&blend_area, &blend_area, blend_dsc->mask_area)) {
-            LV_PROFILER_DRAW_END;
-            return;
-        }
-
         lv_draw_sw_blend_image_dsc_t image_dsc;
-        image_dsc.dest_w = lv_area_get_width(&blend_area);
-        image_dsc.dest_h = lv_area_get_height(&blend_area);
+        image_dsc.dest_w = lv_area_get_width(blend_area);
+        image_dsc.dest_h = lv_area_get_height(blend_area);
         image_dsc.dest_stride = layer_stride_byte;
 
-        image_dsc.opa = blend_dsc->opa;
+        image_dsc.opa = opa;
         image_dsc.blend_mode = blend_dsc->blend_mode;
         image_dsc.src_stride = blend_dsc->src_stride;
         image_dsc.src_color_format = blend_dsc->src_color_format;
 
         const uint8_t * src_buf = blend_dsc->src_buf;
         uint32_t src_px_size = lv_color_format_get_bpp(blend_dsc->src_color_format);
-        src_buf += image_dsc.src_stride * (blend_area.y1 - blend_dsc->src_area->y1);
-        src_buf += ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
+        src_buf += image_dsc.src_stride * (blend_area->y1 - blend_dsc->src_area->y1);
+        src_buf += ((blend_area->x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
         image_dsc.src_buf = src_buf;
         image_dsc.mask_stride = 0;
-
-        if(blend_dsc->mask_buf == NULL) image_dsc.mask_buf = NULL;
-        else if(blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) image_dsc.mask_buf = NULL;
-        else image_dsc.mask_buf = blend_dsc->mask_buf;
+        image_dsc.mask_buf = masked ? blend_dsc->mask_buf : NULL;
 
         if(image_dsc.mask_buf) {
             LV_ASSERT_NULL(blend_dsc->mask_area);
-            image_dsc.mask_buf = blend_dsc->mask_buf;
             image_dsc.mask_stride = blend_dsc->mask_stride ? blend_dsc->mask_stride : lv_area_get_width(blend_dsc->mask_area);
-            image_dsc.mask_buf += image_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
-                                  (blend_area.x1 - blend_dsc->mask_area->x1);
+            image_dsc.mask_buf += image_dsc.mask_stride * (blend_area->y1 - blend_dsc->mask_area->y1) +
+                                  (blend_area->x1 - blend_dsc->mask_area->x1);
         }
 
-        image_dsc.relative_area  = blend_area;
+        image_dsc.relative_area  = *blend_area;
         lv_area_move(&image_dsc.relative_area, -layer->buf_area.x1, -layer->buf_area.y1);
 
         image_dsc.src_area  = *blend_dsc->src_area;
         lv_area_move(&image_dsc.src_area, -layer->buf_area.x1, -layer->buf_area.y1);
 
-        image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
-                                                    blend_area.y1 - layer->buf_area.y1);
+        image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area->x1 - layer->buf_area.x1,
+                                                    blend_area->y1 - layer->buf_area.y1);
 
         lv_draw_sw_blend_image(layer->color_format, &image_dsc);
     }
-    LV_PROFILER_DRAW_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+#if LV_DRAW_SW_COMPLEX
+/**
+ * Blend a single masked line span by span: skip the transparent spans,
+ * blend the fully covered spans without the mask and apply the mask only on the rest.
+ * @param t             pointer to a draw task
+ * @param blend_dsc     pointer to the blend descriptor
+ * @param blend_area    the line to blend. Already clipped to the layer, source and mask area.
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_spans(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                                              const lv_area_t * blend_area)
+{
+    int32_t mask_stride = blend_dsc->mask_stride ? blend_dsc->mask_stride : lv_area_get_width(blend_dsc->mask_area);
+    const lv_opa_t * mask_line = blend_dsc->mask_buf;
+    mask_line += mask_stride * (blend_area->y1 - blend_dsc->mask_area->y1) + (blend_area->x1 - blend_dsc->mask_area->x1);
+
+    lv_draw_sw_mask_span_t spans[SPAN_MAX];
+    uint32_t span_cnt = lv_draw_sw_mask_get_spans(mask_line, lv_area_get_width(blend_area), spans, SPAN_MAX);
+
+    /*Transparent pixels of layers with alpha channel still get the color of the fill, which matters
+     *when the layer is transformed. So the transparent spans can be skipped only without alpha.
+     *Spans with a lower but constant opacity are blended with the mask too,
+     *as the blenders round the mask and the opacity a little differently.*/
+    bool skip_transp = !lv_color_format_has_alpha(t->target_layer->color_format);
+    lv_area_t span_area = *blend_area;
+    lv_area_t masked_area = *blend_area;
+    uint32_t i;
+    for(i = 0; i < span_cnt; i++) {
+        span_area.x2 = span_area.x1 + spans[i].len - 1;
+        bool transp = skip_transp && spans[i].type == LV_DRAW_SW_MASK_SPAN_TRANSP;
+        bool cover = spans[i].type == LV_DRAW_SW_MASK_SPAN_FULL_COVER && spans[i].opa == LV_OPA_COVER;
+        if(transp || cover) {
+            masked_area.x2 = span_area.x1 - 1;
+            if(masked_area.x1 <= masked_area.x2) blend_part(t, blend_dsc, &masked_area, blend_dsc->opa, true);
+            if(cover) blend_part(t, blend_dsc, &span_area, blend_dsc->opa, false);
+            masked_area.x1 = span_area.x2 + 1;
+        }
+        span_area.x1 = span_area.x2 + 1;
+    }
+
+    masked_area.x2 = blend_area->x2;
+    if(masked_area.x1 <= masked_area.x2) blend_part(t, blend_dsc, &masked_area, blend_dsc->opa, true);
+}
+#endif /*LV_DRAW_SW_COMPLEX*/
 
 static inline void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color(lv_color_format_t layer_cf,
                                                                 lv_draw_sw_blend_fill_dsc_t * fill_dsc)
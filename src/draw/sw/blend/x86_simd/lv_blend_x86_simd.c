@@ -0,0 +1,186 @@
+/**
+ * @file lv_blend_x86_simd.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_simd_private.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void LV_X86_SIMD_SSE41 fill_u32_sse41(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                             uint32_t value);
+static void LV_X86_SIMD_AVX2 fill_u32_avx2(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                           uint32_t value);
+static void LV_X86_SIMD_SSE41 fill_u16_sse41(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                             uint16_t value);
+static void LV_X86_SIMD_AVX2 fill_u16_avx2(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                           uint16_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*The CPU features can't change at run time so it's safe to share it between threads
+ *even if multiple threads run the detection at the same time*/
+static volatile int8_t simd_level = -1;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_draw_sw_x86_simd_level_t lv_draw_sw_blend_x86_simd_get_level(void)
+{
+    if(simd_level < 0) {
+        /*Might be called before the constructors of the C library have run*/
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")) simd_level = LV_DRAW_SW_X86_SIMD_LEVEL_AVX2;
+        else if(__builtin_cpu_supports("sse4.1")) simd_level = LV_DRAW_SW_X86_SIMD_LEVEL_SSE41;
+        else simd_level = LV_DRAW_SW_X86_SIMD_LEVEL_NONE;
+    }
+
+    return (lv_draw_sw_x86_simd_level_t)simd_level;
+}
+
+void lv_draw_sw_blend_x86_simd_fill_u32(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h, uint32_t value)
+{
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_AVX2) {
+        fill_u32_avx2(dest_buf, dest_stride, w, h, value);
+    }
+    else {
+        fill_u32_sse41(dest_buf, dest_stride, w, h, value);
+    }
+}
+
+void lv_draw_sw_blend_x86_simd_fill_u16(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h, uint16_t value)
+{
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_AVX2) {
+        fill_u16_avx2(dest_buf, dest_stride, w, h, value);
+    }
+    else {
+        fill_u16_sse41(dest_buf, dest_stride, w, h, value);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_X86_SIMD_SSE41 fill_u32_sse41(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                             uint32_t value)
+{
+    const __m128i value_v = _mm_set1_epi32((int32_t)value);
+    uint8_t * row = dest_buf;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)row;
+        int32_t x;
+        for(x = 0; x <= w - 16; x += 16) {
+            _mm_storeu_si128((__m128i *)&dest[x + 0], value_v);
+            _mm_storeu_si128((__m128i *)&dest[x + 4], value_v);
+            _mm_storeu_si128((__m128i *)&dest[x + 8], value_v);
+            _mm_storeu_si128((__m128i *)&dest[x + 12], value_v);
+        }
+        for(; x <= w - 4; x += 4) {
+            _mm_storeu_si128((__m128i *)&dest[x], value_v);
+        }
+        for(; x < w; x++) {
+            dest[x] = value;
+        }
+        row += dest_stride;
+    }
+}
+
+static void LV_X86_SIMD_AVX2 fill_u32_avx2(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                           uint32_t value)
+{
+    const __m256i value_v = _mm256_set1_epi32((int32_t)value);
+    uint8_t * row = dest_buf;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)row;
+        int32_t x;
+        for(x = 0; x <= w - 32; x += 32) {
+            _mm256_storeu_si256((__m256i *)&dest[x + 0], value_v);
+            _mm256_storeu_si256((__m256i *)&dest[x + 8], value_v);
+            _mm256_storeu_si256((__m256i *)&dest[x + 16], value_v);
+            _mm256_storeu_si256((__m256i *)&dest[x + 24], value_v);
+        }
+        for(; x <= w - 8; x += 8) {
+            _mm256_storeu_si256((__m256i *)&dest[x], value_v);
+        }
+        for(; x < w; x++) {
+            dest[x] = value;
+        }
+        row += dest_stride;
+    }
+}
+
+static void LV_X86_SIMD_SSE41 fill_u16_sse41(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                             uint16_t value)
+{
+    const __m128i value_v = _mm_set1_epi16((int16_t)value);
+    uint8_t * row = dest_buf;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)row;
+        int32_t x;
+        for(x = 0; x <= w - 32; x += 32) {
+            _mm_storeu_si128((__m128i *)&dest[x + 0], value_v);
+            _mm_storeu_si128((__m128i *)&dest[x + 8], value_v);
+            _mm_storeu_si128((__m128i *)&dest[x + 16], value_v);
+            _mm_storeu_si128((__m128i *)&dest[x + 24], value_v);
+        }
+        for(; x <= w - 8; x += 8) {
+            _mm_storeu_si128((__m128i *)&dest[x], value_v);
+        }
+        for(; x < w; x++) {
+            dest[x] = value;
+        }
+        row += dest_stride;
+    }
+}
+
+static void LV_X86_SIMD_AVX2 fill_u16_avx2(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                           uint16_t value)
+{
+    const __m256i value_v = _mm256_set1_epi16((int16_t)value);
+    uint8_t * row = dest_buf;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)row;
+        int32_t x;
+        for(x = 0; x <= w - 64; x += 64) {
+            _mm256_storeu_si256((__m256i *)&dest[x + 0], value_v);
+            _mm256_storeu_si256((__m256i *)&dest[x + 16], value_v);
+            _mm256_storeu_si256((__m256i *)&dest[x + 32], value_v);
+            _mm256_storeu_si256((__m256i *)&dest[x + 48], value_v);
+        }
+        for(; x <= w - 16; x += 16) {
+            _mm256_storeu_si256((__m256i *)&dest[x], value_v);
+        }
+        for(; x < w; x++) {
+            dest[x] = value;
+        }
+        row += dest_stride;
+    }
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
@@ -0,0 +1,55 @@
+/**
+ * @file lv_blend_x86_simd.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_SIMD_H
+#define LV_BLEND_X86_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#if !(defined(__x86_64__) || defined(__i386__)) || !defined(__GNUC__)
+#error "LV_DRAW_SW_ASM_X86_SIMD requires GCC or Clang targeting x86 or x86-64"
+#endif
+
+#ifdef LV_DRAW_SW_X86_SIMD_CUSTOM_INCLUDE
+#include LV_DRAW_SW_X86_SIMD_CUSTOM_INCLUDE
+#endif
+
+#include "lv_draw_sw_blend_x86_simd_to_argb8888.h"
+#include "lv_draw_sw_blend_x86_simd_to_rgb888.h"
+#include "lv_draw_sw_blend_x86_simd_to_rgb565.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_SIMD_H*/
@@ -0,0 +1,211 @@
+/**
+ * @file lv_draw_sw_blend_x86_simd_private.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_X86_SIMD_PRIVATE_H
+#define LV_DRAW_SW_BLEND_X86_SIMD_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "../../../../misc/lv_types.h"
+#include <immintrin.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The functions are compiled for the given instruction set regardless of the global compiler flags.
+ *They are called only if `lv_draw_sw_blend_x86_simd_get_level()` reports that the CPU supports them.*/
+#define LV_X86_SIMD_SSE41   __attribute__((target("sse4.1")))
+#define LV_X86_SIMD_AVX2    __attribute__((target("avx2")))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_DRAW_SW_X86_SIMD_LEVEL_NONE = 0,
+    LV_DRAW_SW_X86_SIMD_LEVEL_SSE41,
+    LV_DRAW_SW_X86_SIMD_LEVEL_AVX2,
+} lv_draw_sw_x86_simd_level_t;
+
+/**
+ * How the mix (opacity) of a pixel is calculated.
+ * The results are the same as `LV_OPA_MIX2` and `LV_OPA_MIX3` in the non-SIMD blend functions.
+ */
+typedef enum {
+    LV_DRAW_SW_X86_SIMD_MIX_OPA,             /**< opa*/
+    LV_DRAW_SW_X86_SIMD_MIX_MASK,            /**< mask*/
+    LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA,        /**< mask * opa*/
+    LV_DRAW_SW_X86_SIMD_MIX_ALPHA,           /**< alpha of the source pixel*/
+    LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA,       /**< alpha * opa*/
+    LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK,      /**< alpha * mask*/
+    LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA,  /**< alpha * mask * opa*/
+} lv_draw_sw_x86_simd_mix_t;
+
+typedef int32_t __attribute__((aligned(1), may_alias)) lv_draw_sw_x86_simd_unaligned_i32_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the best instruction set supported by the CPU.
+ * The CPU is queried only on the first call.
+ * @return      the highest supported `LV_DRAW_SW_X86_SIMD_LEVEL_...`
+ */
+lv_draw_sw_x86_simd_level_t lv_draw_sw_blend_x86_simd_get_level(void);
+
+/**
+ * Fill an area of a buffer with 32 bit pixels with a value.
+ * The CPU must support at least SSE4.1.
+ * @param dest_buf      pointer to the first pixel to fill
+ * @param dest_stride   stride of `dest_buf` in bytes
+ * @param w             width of the area in pixels
+ * @param h             height of the area in pixels
+ * @param value         the value to write to every pixel
+ */
+void lv_draw_sw_blend_x86_simd_fill_u32(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h, uint32_t value);
+
+/**
+ * Fill an area of a buffer with 16 bit pixels with a value.
+ * The CPU must support at least SSE4.1.
+ * @param dest_buf      pointer to the first pixel to fill
+ * @param dest_stride   stride of `dest_buf` in bytes
+ * @param w             width of the area in pixels
+ * @param h             height of the area in pixels
+ * @param value         the value to write to every pixel
+ */
+void lv_draw_sw_blend_x86_simd_fill_u16(void * dest_buf, int32_t dest_stride, int32_t w, int32_t h, uint16_t value);
+
+/**
+ * Calculate the mix of 4 pixels in 32 bit lanes.
+ * @param mode      how to calculate the mix
+ * @param alpha     alpha of the source pixels in 32 bit lanes (ignored without `ALPHA`)
+ * @param mask      pointer to 4 mask values (ignored without `MASK`)
+ * @param opa       the opacity in 32 bit lanes (ignored without `OPA`)
+ * @return          the mix values in 32 bit lanes
+ */
+static inline __m128i LV_X86_SIMD_SSE41 lv_draw_sw_x86_simd_mix_4(lv_draw_sw_x86_simd_mix_t mode, __m128i alpha,
+                                                                   const uint8_t * mask, __m128i opa)
+{
+    __m128i mask_v = _mm_setzero_si128();
+    if(mode == LV_DRAW_SW_X86_SIMD_MIX_MASK || mode == LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA ||
+       mode == LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK || mode == LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA) {
+        mask_v = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const lv_draw_sw_x86_simd_unaligned_i32_t *)mask));
+    }
+
+    switch(mode) {
+        case LV_DRAW_SW_X86_SIMD_MIX_OPA:
+            return opa;
+        case LV_DRAW_SW_X86_SIMD_MIX_MASK:
+            return mask_v;
+        case LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA:
+            return _mm_srli_epi32(_mm_mullo_epi32(mask_v, opa), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA:
+            return alpha;
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA:
+            return _mm_srli_epi32(_mm_mullo_epi32(alpha, opa), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK:
+            return _mm_srli_epi32(_mm_mullo_epi32(alpha, mask_v), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA:
+        default:
+            return _mm_srli_epi32(_mm_mullo_epi32(_mm_mullo_epi32(alpha, mask_v), opa), 16);
+    }
+}
+
+/**
+ * Calculate the mix of 8 pixels in 32 bit lanes.
+ * @param mode      how to calculate the mix
+ * @param alpha     alpha of the source pixels in 32 bit lanes (ignored without `ALPHA`)
+ * @param mask      pointer to 8 mask values (ignored without `MASK`)
+ * @param opa       the opacity in 32 bit lanes (ignored without `OPA`)
+ * @return          the mix values in 32 bit lanes
+ */
+static inline __m256i LV_X86_SIMD_AVX2 lv_draw_sw_x86_simd_mix_8(lv_draw_sw_x86_simd_mix_t mode, __m256i alpha,
+                                                                  const uint8_t * mask, __m256i opa)
+{
+    __m256i mask_v = _mm256_setzero_si256();
+    if(mode == LV_DRAW_SW_X86_SIMD_MIX_MASK || mode == LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA ||
+       mode == LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK || mode == LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA) {
+        mask_v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+    }
+
+    switch(mode) {
+        case LV_DRAW_SW_X86_SIMD_MIX_OPA:
+            return opa;
+        case LV_DRAW_SW_X86_SIMD_MIX_MASK:
+            return mask_v;
+        case LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA:
+            return _mm256_srli_epi32(_mm256_mullo_epi32(mask_v, opa), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA:
+            return alpha;
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA:
+            return _mm256_srli_epi32(_mm256_mullo_epi32(alpha, opa), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK:
+            return _mm256_srli_epi32(_mm256_mullo_epi32(alpha, mask_v), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA:
+        default:
+            return _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_mullo_epi32(alpha, mask_v), opa), 16);
+    }
+}
+
+/**
+ * Calculate the mix of 8 pixels in 16 bit lanes.
+ * @param mode      how to calculate the mix
+ * @param alpha     alpha of the source pixels in 16 bit lanes (ignored without `ALPHA`)
+ * @param mask      pointer to 8 mask values (ignored without `MASK`)
+ * @param opa       the opacity in 16 bit lanes (ignored without `OPA`)
+ * @return          the mix values in 16 bit lanes
+ */
+static inline __m128i LV_X86_SIMD_SSE41 lv_draw_sw_x86_simd_mix_8_u16(lv_draw_sw_x86_simd_mix_t mode, __m128i alpha,
+                                                                       const uint8_t * mask, __m128i opa)
+{
+    __m128i mask_v = _mm_setzero_si128();
+    if(mode == LV_DRAW_SW_X86_SIMD_MIX_MASK || mode == LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA ||
+       mode == LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK || mode == LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA) {
+        mask_v = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)mask));
+    }
+
+    /*The product of two 8 bit values fits into 16 bits and the high half of the
+     *product with the third value is the same as `>> 16` of `LV_OPA_MIX3`*/
+    switch(mode) {
+        case LV_DRAW_SW_X86_SIMD_MIX_OPA:
+            return opa;
+        case LV_DRAW_SW_X86_SIMD_MIX_MASK:
+            return mask_v;
+        case LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA:
+            return _mm_srli_epi16(_mm_mullo_epi16(mask_v, opa), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA:
+            return alpha;
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA:
+            return _mm_srli_epi16(_mm_mullo_epi16(alpha, opa), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK:
+            return _mm_srli_epi16(_mm_mullo_epi16(alpha, mask_v), 8);
+        case LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA:
+        default:
+            return _mm_mulhi_epu16(_mm_mullo_epi16(alpha, mask_v), opa);
+    }
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_X86_SIMD_PRIVATE_H*/
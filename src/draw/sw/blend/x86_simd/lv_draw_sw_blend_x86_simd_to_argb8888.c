@@ -0,0 +1,421 @@
+/**
+ * @file lv_draw_sw_blend_x86_simd_to_argb8888.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_simd_to_argb8888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "lv_draw_sw_blend_x86_simd_private.h"
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint8_t * dest_buf;
+    int32_t dest_stride;
+    const uint8_t * src_buf;        /**< ARGB8888 image or NULL to use `color`*/
+    int32_t src_stride;
+    const lv_opa_t * mask_buf;
+    int32_t mask_stride;
+    int32_t w;
+    int32_t h;
+    uint32_t color;                 /**< The fill color as 0x00RRGGBB*/
+    lv_opa_t opa;
+    lv_draw_sw_x86_simd_mix_t mode;
+} blend_args_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t run(const blend_args_t * args);
+static lv_result_t blend_color(lv_draw_sw_blend_fill_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode);
+static lv_result_t blend_image(lv_draw_sw_blend_image_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode);
+static void LV_X86_SIMD_SSE41 blend_sse41(const blend_args_t * args);
+static void LV_X86_SIMD_AVX2 blend_avx2(const blend_args_t * args);
+
+static inline void LV_X86_SIMD_SSE41 blend_4(uint32_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                             __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode);
+static inline void LV_X86_SIMD_SSE41 blend_tail(uint32_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                                int32_t len, __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode);
+static inline __m128i LV_X86_SIMD_SSE41 mix_u8_4(__m128i fg, __m128i bg, __m128i mix);
+static inline __m256i LV_X86_SIMD_AVX2 mix_u8_8(__m256i fg, __m256i bg, __m256i mix);
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_32_32_mix_4(__m128i fg, __m128i bg);
+static inline __m256i LV_X86_SIMD_AVX2 lv_color_32_32_mix_8(__m256i fg, __m256i bg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    lv_draw_sw_blend_x86_simd_fill_u32(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h,
+                                       lv_color_to_u32(dsc->color));
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_color(dsc, LV_DRAW_SW_X86_SIMD_MIX_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_color(dsc, LV_DRAW_SW_X86_SIMD_MIX_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_color(dsc, LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t run(const blend_args_t * args)
+{
+    lv_draw_sw_x86_simd_level_t level = lv_draw_sw_blend_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_LEVEL_AVX2) blend_avx2(args);
+    else if(level == LV_DRAW_SW_X86_SIMD_LEVEL_SSE41) blend_sse41(args);
+    else return LV_RESULT_INVALID;
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t blend_color(lv_draw_sw_blend_fill_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode)
+{
+    blend_args_t args;
+    args.dest_buf = dsc->dest_buf;
+    args.dest_stride = dsc->dest_stride;
+    args.src_buf = NULL;
+    args.src_stride = 0;
+    args.mask_buf = dsc->mask_buf;
+    args.mask_stride = dsc->mask_stride;
+    args.w = dsc->dest_w;
+    args.h = dsc->dest_h;
+    args.color = lv_color_to_u32(dsc->color) & 0x00FFFFFF;
+    args.opa = dsc->opa;
+    args.mode = mode;
+
+    return run(&args);
+}
+
+static lv_result_t blend_image(lv_draw_sw_blend_image_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode)
+{
+    blend_args_t args;
+    args.dest_buf = dsc->dest_buf;
+    args.dest_stride = dsc->dest_stride;
+    args.src_buf = dsc->src_buf;
+    args.src_stride = dsc->src_stride;
+    args.mask_buf = dsc->mask_buf;
+    args.mask_stride = dsc->mask_stride;
+    args.w = dsc->dest_w;
+    args.h = dsc->dest_h;
+    args.color = 0;
+    args.opa = dsc->opa;
+    args.mode = mode;
+
+    return run(&args);
+}
+
+static void LV_X86_SIMD_SSE41 blend_sse41(const blend_args_t * args)
+{
+    const __m128i color = _mm_set1_epi32((int32_t)args->color);
+    const __m128i opa = _mm_set1_epi32(args->opa);
+    uint8_t * dest_row = args->dest_buf;
+    const uint8_t * src_row = args->src_buf;
+    const lv_opa_t * mask_row = args->mask_buf;
+    int32_t w = args->w;
+    int32_t y;
+
+    for(y = 0; y < args->h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        int32_t x;
+        for(x = 0; x <= w - 4; x += 4) {
+            blend_4(&dest[x], src ? &src[x] : NULL, mask_row ? &mask_row[x] : NULL, color, opa, args->mode);
+        }
+        if(x < w) {
+            blend_tail(&dest[x], src ? &src[x] : NULL, mask_row ? &mask_row[x] : NULL, w - x, color, opa, args->mode);
+        }
+
+        dest_row += args->dest_stride;
+        if(src_row) src_row += args->src_stride;
+        if(mask_row) mask_row += args->mask_stride;
+    }
+}
+
+static void LV_X86_SIMD_AVX2 blend_avx2(const blend_args_t * args)
+{
+    const __m256i color = _mm256_set1_epi32((int32_t)args->color);
+    const __m256i opa = _mm256_set1_epi32(args->opa);
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+    const lv_draw_sw_x86_simd_mix_t mode = args->mode;
+    uint8_t * dest_row = args->dest_buf;
+    const uint8_t * src_row = args->src_buf;
+    const lv_opa_t * mask_row = args->mask_buf;
+    int32_t w = args->w;
+    int32_t y;
+
+    for(y = 0; y < args->h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        int32_t x;
+        for(x = 0; x <= w - 8; x += 8) {
+            __m256i fg;
+            if(src) {
+                fg = _mm256_loadu_si256((const __m256i *)&src[x]);
+                if(mode != LV_DRAW_SW_X86_SIMD_MIX_ALPHA) {
+                    __m256i alpha = lv_draw_sw_x86_simd_mix_8(mode, _mm256_srli_epi32(fg, 24),
+                                                              mask_row ? &mask_row[x] : NULL, opa);
+                    fg = _mm256_or_si256(_mm256_and_si256(fg, rgb_mask), _mm256_slli_epi32(alpha, 24));
+                }
+            }
+            else {
+                __m256i alpha = lv_draw_sw_x86_simd_mix_8(mode, _mm256_setzero_si256(),
+                                                          mask_row ? &mask_row[x] : NULL, opa);
+                fg = _mm256_or_si256(color, _mm256_slli_epi32(alpha, 24));
+            }
+
+            __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+            _mm256_storeu_si256((__m256i *)&dest[x], lv_color_32_32_mix_8(fg, bg));
+        }
+
+        /*Blend the remaining pixels with the SSE4.1 functions*/
+        if(x <= w - 4) {
+            blend_4(&dest[x], src ? &src[x] : NULL, mask_row ? &mask_row[x] : NULL,
+                    _mm256_castsi256_si128(color), _mm256_castsi256_si128(opa), mode);
+            x += 4;
+        }
+        if(x < w) {
+            blend_tail(&dest[x], src ? &src[x] : NULL, mask_row ? &mask_row[x] : NULL, w - x,
+                       _mm256_castsi256_si128(color), _mm256_castsi256_si128(opa), mode);
+        }
+
+        dest_row += args->dest_stride;
+        if(src_row) src_row += args->src_stride;
+        if(mask_row) mask_row += args->mask_stride;
+    }
+}
+
+/**
+ * Blend 4 pixels
+ * @param dest      pointer to 4 destination pixels
+ * @param src       pointer to 4 source pixels or NULL to use `color`
+ * @param mask      pointer to 4 mask values (can be NULL if not used by `mode`)
+ * @param color     the fill color as 0x00RRGGBB in 32 bit lanes
+ * @param opa       the opacity in 32 bit lanes
+ * @param mode      how to calculate the alpha of the foreground
+ */
+static inline void LV_X86_SIMD_SSE41 blend_4(uint32_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                             __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode)
+{
+    __m128i fg;
+    if(src) {
+        fg = _mm_loadu_si128((const __m128i *)src);
+        if(mode != LV_DRAW_SW_X86_SIMD_MIX_ALPHA) {
+            __m128i alpha = lv_draw_sw_x86_simd_mix_4(mode, _mm_srli_epi32(fg, 24), mask, opa);
+            fg = _mm_or_si128(_mm_and_si128(fg, _mm_set1_epi32(0x00FFFFFF)), _mm_slli_epi32(alpha, 24));
+        }
+    }
+    else {
+        __m128i alpha = lv_draw_sw_x86_simd_mix_4(mode, _mm_setzero_si128(), mask, opa);
+        fg = _mm_or_si128(color, _mm_slli_epi32(alpha, 24));
+    }
+
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    _mm_storeu_si128((__m128i *)dest, lv_color_32_32_mix_4(fg, bg));
+}
+
+/**
+ * Blend less than 4 pixels through a temporary buffer to not access memory after the end of the row
+ */
+static inline void LV_X86_SIMD_SSE41 blend_tail(uint32_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                                int32_t len, __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode)
+{
+    uint32_t dest_tmp[4] = {0};
+    uint32_t src_tmp[4] = {0};
+    lv_opa_t mask_tmp[4] = {0};
+
+    lv_memcpy(dest_tmp, dest, len * sizeof(uint32_t));
+    if(src) lv_memcpy(src_tmp, src, len * sizeof(uint32_t));
+    if(mask) lv_memcpy(mask_tmp, mask, len);
+
+    blend_4(dest_tmp, src ? src_tmp : NULL, mask_tmp, color, opa, mode);
+    lv_memcpy(dest, dest_tmp, len * sizeof(uint32_t));
+}
+
+/**
+ * Mix 8 bit values with 8 bit ratios, the same way as `lv_color_mix32`: LV_UDIV255(fg * mix + bg * (255 - mix))
+ */
+static inline __m128i LV_X86_SIMD_SSE41 mix_u8_4(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v255 = _mm_set1_epi16(255);
+    const __m128i div255 = _mm_set1_epi16((int16_t)0x8081);
+
+    __m128i mix_lo = _mm_unpacklo_epi8(mix, zero);
+    __m128i mix_hi = _mm_unpackhi_epi8(mix, zero);
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), mix_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(v255, mix_lo)));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), mix_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(v255, mix_hi)));
+
+    /*(x * 0x8081) >> 23 as the high half of the product shifted by 7*/
+    lo = _mm_srli_epi16(_mm_mulhi_epu16(lo, div255), 7);
+    hi = _mm_srli_epi16(_mm_mulhi_epu16(hi, div255), 7);
+    return _mm_packus_epi16(lo, hi);
+}
+
+static inline __m256i LV_X86_SIMD_AVX2 mix_u8_8(__m256i fg, __m256i bg, __m256i mix)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v255 = _mm256_set1_epi16(255);
+    const __m256i div255 = _mm256_set1_epi16((int16_t)0x8081);
+
+    __m256i mix_lo = _mm256_unpacklo_epi8(mix, zero);
+    __m256i mix_hi = _mm256_unpackhi_epi8(mix, zero);
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), mix_lo),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), _mm256_sub_epi16(v255, mix_lo)));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), mix_hi),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), _mm256_sub_epi16(v255, mix_hi)));
+
+    lo = _mm256_srli_epi16(_mm256_mulhi_epu16(lo, div255), 7);
+    hi = _mm256_srli_epi16(_mm256_mulhi_epu16(hi, div255), 7);
+    return _mm256_packus_epi16(lo, hi);
+}
+
+/**
+ * The same as `lv_color_32_32_mix` of the non-SIMD blend functions for 4 pixels
+ */
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_32_32_mix_4(__m128i fg, __m128i bg)
+{
+    const __m128i v255 = _mm_set1_epi32(255);
+    const __m128i opa_max = _mm_set1_epi32(LV_OPA_MAX - 1);
+    const __m128i opa_min = _mm_set1_epi32(LV_OPA_MIN + 1);
+    __m128i fg_a = _mm_srli_epi32(fg, 24);
+    __m128i bg_a = _mm_srli_epi32(bg, 24);
+
+    /*Pick the foreground if it's fully opaque or the background is fully transparent*/
+    __m128i pick_fg = _mm_or_si128(_mm_cmpgt_epi32(fg_a, opa_max), _mm_cmplt_epi32(bg_a, opa_min));
+    /*Transparent foreground: use the background*/
+    __m128i pick_bg = _mm_cmplt_epi32(fg_a, opa_min);
+
+    int32_t pick_fg_bits = _mm_movemask_ps(_mm_castsi128_ps(pick_fg));
+    if(pick_fg_bits == 0xF) return fg;
+    if(pick_fg_bits == 0 && _mm_movemask_ps(_mm_castsi128_ps(pick_bg)) == 0xF) return bg;
+
+    /*The result alpha and the ratio of the foreground.
+     *With an opaque background it gives alpha = 255 and ratio = fg_a, i.e. the simple mix*/
+    __m128i res_a = _mm_sub_epi32(v255, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(v255, fg_a),
+                                                                       _mm_sub_epi32(v255, bg_a)), 8));
+    /*The quotient is either an integer or at least 1/255 away from the next one,
+     *so the truncated float division is the same as the integer division*/
+    __m128i ratio = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(_mm_mullo_epi32(fg_a, v255)),
+                                                _mm_cvtepi32_ps(res_a)));
+
+    __m128i ratio_u8 = _mm_shuffle_epi8(ratio, _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+    __m128i res = mix_u8_4(fg, bg, ratio_u8);
+    res = _mm_blendv_epi8(res, fg, _mm_cmpgt_epi32(ratio, opa_max));
+    res = _mm_blendv_epi8(res, bg, _mm_cmplt_epi32(ratio, opa_min));
+    res = _mm_or_si128(_mm_and_si128(res, _mm_set1_epi32(0x00FFFFFF)), _mm_slli_epi32(res_a, 24));
+
+    res = _mm_blendv_epi8(res, bg, pick_bg);
+    return _mm_blendv_epi8(res, fg, pick_fg);
+}
+
+/**
+ * The same as `lv_color_32_32_mix` of the non-SIMD blend functions for 8 pixels
+ */
+static inline __m256i LV_X86_SIMD_AVX2 lv_color_32_32_mix_8(__m256i fg, __m256i bg)
+{
+    const __m256i v255 = _mm256_set1_epi32(255);
+    const __m256i opa_max = _mm256_set1_epi32(LV_OPA_MAX - 1);
+    const __m256i opa_min = _mm256_set1_epi32(LV_OPA_MIN + 1);
+    __m256i fg_a = _mm256_srli_epi32(fg, 24);
+    __m256i bg_a = _mm256_srli_epi32(bg, 24);
+
+    __m256i pick_fg = _mm256_or_si256(_mm256_cmpgt_epi32(fg_a, opa_max), _mm256_cmpgt_epi32(opa_min, bg_a));
+    __m256i pick_bg = _mm256_cmpgt_epi32(opa_min, fg_a);
+
+    int32_t pick_fg_bits = _mm256_movemask_ps(_mm256_castsi256_ps(pick_fg));
+    if(pick_fg_bits == 0xFF) return fg;
+    if(pick_fg_bits == 0 && _mm256_movemask_ps(_mm256_castsi256_ps(pick_bg)) == 0xFF) return bg;
+
+    __m256i res_a = _mm256_sub_epi32(v255, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(v255, fg_a),
+                                                                                _mm256_sub_epi32(v255, bg_a)), 8));
+    __m256i ratio = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_mullo_epi32(fg_a, v255)),
+                                                      _mm256_cvtepi32_ps(res_a)));
+
+    __m256i ratio_u8 = _mm256_shuffle_epi8(ratio, _mm256_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12,
+                                                                   0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+    __m256i res = mix_u8_8(fg, bg, ratio_u8);
+    res = _mm256_blendv_epi8(res, fg, _mm256_cmpgt_epi32(ratio, opa_max));
+    res = _mm256_blendv_epi8(res, bg, _mm256_cmpgt_epi32(opa_min, ratio));
+    res = _mm256_or_si256(_mm256_and_si256(res, _mm256_set1_epi32(0x00FFFFFF)), _mm256_slli_epi32(res_a, 24));
+
+    res = _mm256_blendv_epi8(res, bg, pick_bg);
+    return _mm256_blendv_epi8(res, fg, pick_fg);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
@@ -0,0 +1,297 @@
+/**
+ * @file lv_draw_sw_blend_x86_simd_to_rgb565.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_simd_to_rgb565.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "lv_draw_sw_blend_x86_simd_private.h"
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint8_t * dest_buf;
+    int32_t dest_stride;
+    const uint8_t * src_buf;        /**< ARGB8888 image or NULL to use `color`*/
+    int32_t src_stride;
+    const lv_opa_t * mask_buf;
+    int32_t mask_stride;
+    int32_t w;
+    int32_t h;
+    uint16_t color;                 /**< The fill color in RGB565*/
+    lv_opa_t opa;
+    lv_draw_sw_x86_simd_mix_t mode;
+} blend_args_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend_color(lv_draw_sw_blend_fill_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode);
+static lv_result_t blend_image(lv_draw_sw_blend_image_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode);
+static void LV_X86_SIMD_SSE41 blend_sse41(const blend_args_t * args);
+
+static inline void LV_X86_SIMD_SSE41 blend_8(uint16_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                             __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode);
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_16_16_mix_4(__m128i c1, __m128i c2, __m128i mix);
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_24_16_mix_8(const uint32_t * src, __m128i c2, __m128i mix);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    lv_draw_sw_blend_x86_simd_fill_u16(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h,
+                                       lv_color_to_u16(dsc->color));
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_color(dsc, LV_DRAW_SW_X86_SIMD_MIX_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_color(dsc, LV_DRAW_SW_X86_SIMD_MIX_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_color(dsc, LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_image(dsc, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t blend_color(lv_draw_sw_blend_fill_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode)
+{
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    blend_args_t args;
+    args.dest_buf = dsc->dest_buf;
+    args.dest_stride = dsc->dest_stride;
+    args.src_buf = NULL;
+    args.src_stride = 0;
+    args.mask_buf = dsc->mask_buf;
+    args.mask_stride = dsc->mask_stride;
+    args.w = dsc->dest_w;
+    args.h = dsc->dest_h;
+    args.color = lv_color_to_u16(dsc->color);
+    args.opa = dsc->opa;
+    args.mode = mode;
+
+    blend_sse41(&args);
+    return LV_RESULT_OK;
+}
+
+static lv_result_t blend_image(lv_draw_sw_blend_image_dsc_t * dsc, lv_draw_sw_x86_simd_mix_t mode)
+{
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    blend_args_t args;
+    args.dest_buf = dsc->dest_buf;
+    args.dest_stride = dsc->dest_stride;
+    args.src_buf = dsc->src_buf;
+    args.src_stride = dsc->src_stride;
+    args.mask_buf = dsc->mask_buf;
+    args.mask_stride = dsc->mask_stride;
+    args.w = dsc->dest_w;
+    args.h = dsc->dest_h;
+    args.color = 0;
+    args.opa = dsc->opa;
+    args.mode = mode;
+
+    blend_sse41(&args);
+    return LV_RESULT_OK;
+}
+
+static void LV_X86_SIMD_SSE41 blend_sse41(const blend_args_t * args)
+{
+    const __m128i color = _mm_set1_epi32(args->color);
+    const __m128i opa = _mm_set1_epi16(args->opa);
+    uint8_t * dest_row = args->dest_buf;
+    const uint8_t * src_row = args->src_buf;
+    const lv_opa_t * mask_row = args->mask_buf;
+    int32_t w = args->w;
+    int32_t y;
+
+    for(y = 0; y < args->h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        int32_t x;
+        for(x = 0; x <= w - 8; x += 8) {
+            blend_8(&dest[x], src ? &src[x] : NULL, mask_row ? &mask_row[x] : NULL, color, opa, args->mode);
+        }
+
+        if(x < w) {
+            /*Blend the last pixels through a temporary buffer to not access memory after the end of the row*/
+            uint16_t dest_tmp[8] = {0};
+            uint32_t src_tmp[8] = {0};
+            lv_opa_t mask_tmp[8] = {0};
+            int32_t len = w - x;
+
+            lv_memcpy(dest_tmp, &dest[x], len * sizeof(uint16_t));
+            if(src) lv_memcpy(src_tmp, &src[x], len * sizeof(uint32_t));
+            if(mask_row) lv_memcpy(mask_tmp, &mask_row[x], len);
+
+            blend_8(dest_tmp, src ? src_tmp : NULL, mask_tmp, color, opa, args->mode);
+            lv_memcpy(&dest[x], dest_tmp, len * sizeof(uint16_t));
+        }
+
+        dest_row += args->dest_stride;
+        if(src_row) src_row += args->src_stride;
+        if(mask_row) mask_row += args->mask_stride;
+    }
+}
+
+/**
+ * Blend 8 pixels
+ * @param dest      pointer to 8 destination pixels
+ * @param src       pointer to 8 ARGB8888 source pixels or NULL to use `color`
+ * @param mask      pointer to 8 mask values (can be NULL if not used by `mode`)
+ * @param color     the RGB565 fill color in 32 bit lanes
+ * @param opa       the opacity in 16 bit lanes
+ * @param mode      how to calculate the mix
+ */
+static inline void LV_X86_SIMD_SSE41 blend_8(uint16_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                             __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode)
+{
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    __m128i res;
+
+    if(src) {
+        __m128i alpha = _mm_packus_epi32(_mm_srli_epi32(_mm_loadu_si128((const __m128i *)&src[0]), 24),
+                                         _mm_srli_epi32(_mm_loadu_si128((const __m128i *)&src[4]), 24));
+        __m128i mix = lv_draw_sw_x86_simd_mix_8_u16(mode, alpha, mask, opa);
+        res = lv_color_24_16_mix_8(src, bg, mix);
+    }
+    else {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i mix = lv_draw_sw_x86_simd_mix_8_u16(mode, zero, mask, opa);
+        __m128i res_lo = lv_color_16_16_mix_4(color, _mm_unpacklo_epi16(bg, zero), _mm_unpacklo_epi16(mix, zero));
+        __m128i res_hi = lv_color_16_16_mix_4(color, _mm_unpackhi_epi16(bg, zero), _mm_unpackhi_epi16(mix, zero));
+        res = _mm_packus_epi32(res_lo, res_hi);
+    }
+
+    _mm_storeu_si128((__m128i *)dest, res);
+}
+
+/**
+ * The same as `lv_color_16_16_mix` for 4 pixels in 32 bit lanes
+ */
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_16_16_mix_4(__m128i c1, __m128i c2, __m128i mix)
+{
+    /*0x7E0F81F = 0b00000111111000001111100000011111*/
+    const __m128i spread_mask = _mm_set1_epi32(0x7E0F81F);
+
+    __m128i mix5 = _mm_srli_epi32(_mm_add_epi32(mix, _mm_set1_epi32(4)), 3);
+    __m128i fg = _mm_and_si128(_mm_or_si128(c1, _mm_slli_epi32(c1, 16)), spread_mask);
+    __m128i bg = _mm_and_si128(_mm_or_si128(c2, _mm_slli_epi32(c2, 16)), spread_mask);
+    __m128i res = _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(fg, bg), mix5), 5);
+    res = _mm_and_si128(_mm_add_epi32(res, bg), spread_mask);
+    res = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(res, 16), res), _mm_set1_epi32(0xFFFF));
+
+    res = _mm_blendv_epi8(res, c1, _mm_cmpeq_epi32(mix, _mm_set1_epi32(255)));
+    return _mm_blendv_epi8(res, c2, _mm_cmpeq_epi32(mix, _mm_setzero_si128()));
+}
+
+/**
+ * The same as `lv_color_24_16_mix` of the non-SIMD blend functions for 8 pixels in 16 bit lanes
+ */
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_24_16_mix_8(const uint32_t * src, __m128i c2, __m128i mix)
+{
+    const __m128i ch_mask = _mm_set1_epi32(0xFF);
+    __m128i src_lo = _mm_loadu_si128((const __m128i *)&src[0]);
+    __m128i src_hi = _mm_loadu_si128((const __m128i *)&src[4]);
+
+    __m128i b = _mm_packus_epi32(_mm_and_si128(src_lo, ch_mask), _mm_and_si128(src_hi, ch_mask));
+    __m128i g = _mm_packus_epi32(_mm_and_si128(_mm_srli_epi32(src_lo, 8), ch_mask),
+                                 _mm_and_si128(_mm_srli_epi32(src_hi, 8), ch_mask));
+    __m128i r = _mm_packus_epi32(_mm_and_si128(_mm_srli_epi32(src_lo, 16), ch_mask),
+                                 _mm_and_si128(_mm_srli_epi32(src_hi, 16), ch_mask));
+
+    /*All the intermediate values fit into 16 bits*/
+    __m128i mix_inv = _mm_sub_epi16(_mm_set1_epi16(255), mix);
+    __m128i r_res = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(r, 3), mix),
+                                  _mm_mullo_epi16(_mm_srli_epi16(c2, 11), mix_inv));
+    __m128i g_res = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(g, 2), mix),
+                                  _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(c2, 5), _mm_set1_epi16(0x3F)), mix_inv));
+    __m128i b_res = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(b, 3), mix),
+                                  _mm_mullo_epi16(_mm_and_si128(c2, _mm_set1_epi16(0x1F)), mix_inv));
+
+    __m128i res = _mm_and_si128(_mm_slli_epi16(r_res, 3), _mm_set1_epi16((int16_t)0xF800));
+    res = _mm_or_si128(res, _mm_and_si128(_mm_srli_epi16(g_res, 3), _mm_set1_epi16(0x07E0)));
+    res = _mm_or_si128(res, _mm_srli_epi16(b_res, 8));
+
+    __m128i opaque = _mm_and_si128(_mm_slli_epi16(r, 8), _mm_set1_epi16((int16_t)0xF800));
+    opaque = _mm_or_si128(opaque, _mm_and_si128(_mm_slli_epi16(g, 3), _mm_set1_epi16(0x07E0)));
+    opaque = _mm_or_si128(opaque, _mm_srli_epi16(b, 3));
+
+    res = _mm_blendv_epi8(res, opaque, _mm_cmpeq_epi16(mix, _mm_set1_epi16(255)));
+    return _mm_blendv_epi8(res, c2, _mm_cmpeq_epi16(mix, _mm_setzero_si128()));
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
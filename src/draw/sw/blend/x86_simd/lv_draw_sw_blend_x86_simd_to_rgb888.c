@@ -0,0 +1,324 @@
+/**
+ * @file lv_draw_sw_blend_x86_simd_to_rgb888.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_simd_to_rgb888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "lv_draw_sw_blend_x86_simd_private.h"
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint8_t * dest_buf;
+    int32_t dest_stride;
+    uint32_t dest_px_size;          /**< 3 for RGB888, 4 for XRGB8888*/
+    const uint8_t * src_buf;        /**< ARGB8888 image or NULL to use `color`*/
+    int32_t src_stride;
+    const lv_opa_t * mask_buf;
+    int32_t mask_stride;
+    int32_t w;
+    int32_t h;
+    uint32_t color;                 /**< The fill color as 0x00RRGGBB*/
+    lv_opa_t opa;
+    lv_draw_sw_x86_simd_mix_t mode;
+} blend_args_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend_color(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size,
+                               lv_draw_sw_x86_simd_mix_t mode);
+static lv_result_t blend_image(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size,
+                               lv_draw_sw_x86_simd_mix_t mode);
+static void LV_X86_SIMD_SSE41 fill_rgb888(uint8_t * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                          lv_color_t color);
+static void LV_X86_SIMD_SSE41 blend_sse41(const blend_args_t * args);
+
+static inline void LV_X86_SIMD_SSE41 blend_4(uint8_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                             uint32_t dest_px_size, __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode);
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_24_24_mix_4(__m128i fg, __m128i bg, __m128i mix);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    if(dest_px_size == 4) {
+        lv_draw_sw_blend_x86_simd_fill_u32(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h,
+                                           lv_color_to_u32(dsc->color));
+    }
+    else {
+        fill_rgb888(dsc->dest_buf, dsc->dest_stride, dsc->dest_w, dsc->dest_h, dsc->color);
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_color(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_color(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                    uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_color(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_MASK_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_image(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_ALPHA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    return blend_image(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                   uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_image(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                       uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    return blend_image(dsc, dest_px_size, LV_DRAW_SW_X86_SIMD_MIX_ALPHA_MASK_OPA);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t blend_color(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size,
+                               lv_draw_sw_x86_simd_mix_t mode)
+{
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    blend_args_t args;
+    args.dest_buf = dsc->dest_buf;
+    args.dest_stride = dsc->dest_stride;
+    args.dest_px_size = dest_px_size;
+    args.src_buf = NULL;
+    args.src_stride = 0;
+    args.mask_buf = dsc->mask_buf;
+    args.mask_stride = dsc->mask_stride;
+    args.w = dsc->dest_w;
+    args.h = dsc->dest_h;
+    args.color = lv_color_to_u32(dsc->color) & 0x00FFFFFF;
+    args.opa = dsc->opa;
+    args.mode = mode;
+
+    blend_sse41(&args);
+    return LV_RESULT_OK;
+}
+
+static lv_result_t blend_image(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size,
+                               lv_draw_sw_x86_simd_mix_t mode)
+{
+    if(lv_draw_sw_blend_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    blend_args_t args;
+    args.dest_buf = dsc->dest_buf;
+    args.dest_stride = dsc->dest_stride;
+    args.dest_px_size = dest_px_size;
+    args.src_buf = dsc->src_buf;
+    args.src_stride = dsc->src_stride;
+    args.mask_buf = dsc->mask_buf;
+    args.mask_stride = dsc->mask_stride;
+    args.w = dsc->dest_w;
+    args.h = dsc->dest_h;
+    args.color = 0;
+    args.opa = dsc->opa;
+    args.mode = mode;
+
+    blend_sse41(&args);
+    return LV_RESULT_OK;
+}
+
+static void LV_X86_SIMD_SSE41 fill_rgb888(uint8_t * dest_buf, int32_t dest_stride, int32_t w, int32_t h,
+                                          lv_color_t color)
+{
+    /*16 pixels are 48 bytes, i.e. 3 full registers with the same pattern*/
+    uint8_t pattern[48];
+    int32_t i;
+    for(i = 0; i < 48; i += 3) {
+        pattern[i + 0] = color.blue;
+        pattern[i + 1] = color.green;
+        pattern[i + 2] = color.red;
+    }
+
+    const __m128i p0 = _mm_loadu_si128((const __m128i *)&pattern[0]);
+    const __m128i p1 = _mm_loadu_si128((const __m128i *)&pattern[16]);
+    const __m128i p2 = _mm_loadu_si128((const __m128i *)&pattern[32]);
+    int32_t w_bytes = w * 3;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        for(x = 0; x <= w_bytes - 48; x += 48) {
+            _mm_storeu_si128((__m128i *)&dest_buf[x + 0], p0);
+            _mm_storeu_si128((__m128i *)&dest_buf[x + 16], p1);
+            _mm_storeu_si128((__m128i *)&dest_buf[x + 32], p2);
+        }
+        lv_memcpy(&dest_buf[x], pattern, w_bytes - x);
+
+        dest_buf += dest_stride;
+    }
+}
+
+static void LV_X86_SIMD_SSE41 blend_sse41(const blend_args_t * args)
+{
+    const __m128i color = _mm_set1_epi32((int32_t)args->color);
+    const __m128i opa = _mm_set1_epi32(args->opa);
+    const uint32_t px_size = args->dest_px_size;
+    uint8_t * dest_row = args->dest_buf;
+    const uint8_t * src_row = args->src_buf;
+    const lv_opa_t * mask_row = args->mask_buf;
+    int32_t w = args->w;
+    int32_t y;
+
+    for(y = 0; y < args->h; y++) {
+        const uint32_t * src = (const uint32_t *)src_row;
+        int32_t x;
+        for(x = 0; x <= w - 4; x += 4) {
+            blend_4(&dest_row[x * px_size], src ? &src[x] : NULL, mask_row ? &mask_row[x] : NULL,
+                    px_size, color, opa, args->mode);
+        }
+
+        if(x < w) {
+            /*Blend the last pixels through a temporary buffer to not access memory after the end of the row*/
+            uint8_t dest_tmp[16] = {0};
+            uint32_t src_tmp[4] = {0};
+            lv_opa_t mask_tmp[4] = {0};
+            int32_t len = w - x;
+
+            lv_memcpy(dest_tmp, &dest_row[x * px_size], len * px_size);
+            if(src) lv_memcpy(src_tmp, &src[x], len * sizeof(uint32_t));
+            if(mask_row) lv_memcpy(mask_tmp, &mask_row[x], len);
+
+            blend_4(dest_tmp, src ? src_tmp : NULL, mask_tmp, px_size, color, opa, args->mode);
+            lv_memcpy(&dest_row[x * px_size], dest_tmp, len * px_size);
+        }
+
+        dest_row += args->dest_stride;
+        if(src_row) src_row += args->src_stride;
+        if(mask_row) mask_row += args->mask_stride;
+    }
+}
+
+/**
+ * Blend 4 pixels
+ * @param dest          pointer to 4 destination pixels
+ * @param src           pointer to 4 ARGB8888 source pixels or NULL to use `color`
+ * @param mask          pointer to 4 mask values (can be NULL if not used by `mode`)
+ * @param dest_px_size  3 for RGB888, 4 for XRGB8888
+ * @param color         the fill color as 0x00RRGGBB in 32 bit lanes
+ * @param opa           the opacity in 32 bit lanes
+ * @param mode          how to calculate the mix
+ */
+static inline void LV_X86_SIMD_SSE41 blend_4(uint8_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                             uint32_t dest_px_size, __m128i color, __m128i opa, lv_draw_sw_x86_simd_mix_t mode)
+{
+    __m128i fg;
+    __m128i mix;
+    if(src) {
+        fg = _mm_loadu_si128((const __m128i *)src);
+        mix = lv_draw_sw_x86_simd_mix_4(mode, _mm_srli_epi32(fg, 24), mask, opa);
+    }
+    else {
+        fg = color;
+        mix = lv_draw_sw_x86_simd_mix_4(mode, _mm_setzero_si128(), mask, opa);
+    }
+
+    if(dest_px_size == 4) {
+        __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+        _mm_storeu_si128((__m128i *)dest, lv_color_24_24_mix_4(fg, bg, mix));
+    }
+    else {
+        /*Spread the 12 bytes of 4 RGB888 pixels to 32 bit lanes and pack them back after blending.
+         *Only 12 bytes are read and written.*/
+        __m128i bg = _mm_loadl_epi64((const __m128i *)dest);
+        bg = _mm_insert_epi32(bg, *(const lv_draw_sw_x86_simd_unaligned_i32_t *)&dest[8], 2);
+        bg = _mm_shuffle_epi8(bg, _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+
+        __m128i res = lv_color_24_24_mix_4(fg, bg, mix);
+        res = _mm_shuffle_epi8(res, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+        _mm_storel_epi64((__m128i *)dest, res);
+        *(lv_draw_sw_x86_simd_unaligned_i32_t *)&dest[8] = _mm_extract_epi32(res, 2);
+    }
+}
+
+/**
+ * The same as `lv_color_24_24_mix` of the non-SIMD blend functions for 4 pixels in 32 bit lanes.
+ * The 4th byte of the background is kept.
+ */
+static inline __m128i LV_X86_SIMD_SSE41 lv_color_24_24_mix_4(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v255 = _mm_set1_epi16(255);
+
+    __m128i mix_u8 = _mm_shuffle_epi8(mix, _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+    __m128i mix_lo = _mm_unpacklo_epi8(mix_u8, zero);
+    __m128i mix_hi = _mm_unpackhi_epi8(mix_u8, zero);
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), mix_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(v255, mix_lo)));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), mix_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(v255, mix_hi)));
+    __m128i res = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+    res = _mm_blendv_epi8(res, fg, _mm_cmpgt_epi32(mix, _mm_set1_epi32(LV_OPA_MAX - 1)));
+    res = _mm_blendv_epi8(res, bg, _mm_cmpeq_epi32(mix, zero));
+    return _mm_blendv_epi8(res, bg, _mm_set1_epi32((int32_t)0xFF000000));
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_draw_sw_private.h"
 #include "../lv_draw_private.h"
+#include "../lv_image_decoder_private.h"
 #if LV_USE_DRAW_SW
 
 #include "../../core/lv_refr.h"
@@ -39,6 +40,9 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*Don't split the draw tasks into thinner bands than this*/
+#define SPLIT_MIN_BAND_H    16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,6 +52,15 @@
  **********************/
 #if LV_USE_OS
     static void render_thread_cb(void * ptr);
+    static lv_draw_task_t * queue_take(lv_draw_sw_thread_dsc_t * thread_dsc, lv_draw_sw_thread_dsc_t * taker);
+    static lv_draw_task_t * steal_task(lv_draw_sw_thread_dsc_t * thread_dsc);
+    static bool has_idle_thread(lv_draw_sw_unit_t * draw_sw_unit);
+    #if LV_USE_SYSMON
+        static void add_busy_time(lv_draw_sw_thread_dsc_t * thread_dsc, uint32_t * busy_start);
+        static uint32_t get_busy_time(lv_draw_unit_t * draw_unit);
+    #endif
+    static bool split_task(lv_draw_sw_thread_dsc_t * thread_dsc, lv_draw_task_t * t);
+    static bool split_render_band(lv_draw_sw_thread_dsc_t * thread_dsc);
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
@@ -79,10 +92,17 @@ void lv_draw_sw_init(void)
     lv_draw_sw_mask_init();
 #endif
 
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    lv_draw_sw_shadow_cache_init();
+#endif
+
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
     draw_sw_unit->base_unit.dispatch_cb = dispatch;
     draw_sw_unit->base_unit.evaluate_cb = evaluate;
     draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
+#if LV_USE_OS && LV_USE_SYSMON
+    draw_sw_unit->base_unit.get_busy_time_cb = get_busy_time;
+#endif
 #if LV_USE_DRAW_ARM2D_SYNC
     draw_sw_unit->base_unit.name = "SW_ARM2D";
 #else
@@ -95,9 +115,12 @@ void lv_draw_sw_init(void)
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
         thread_dsc->idx = i;
         thread_dsc->draw_unit = (void *) draw_sw_unit;
+        lv_mutex_init(&thread_dsc->queue_lock);
         lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_THREAD_PRIO, render_thread_cb,
                        LV_DRAW_THREAD_STACK_SIZE, thread_dsc);
     }
+    lv_mutex_init(&draw_sw_unit->split.lock);
+    draw_sw_unit->queue_size = LV_DRAW_SW_THREAD_QUEUE_SIZE;
 #endif
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
@@ -121,6 +144,10 @@ void lv_draw_sw_deinit(void)
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
 #endif
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    lv_draw_sw_shadow_cache_deinit();
+#endif
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
@@ -139,7 +166,9 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
             lv_thread_sync_signal(&thread_dsc->sync);
         }
         lv_thread_delete(&thread_dsc->thread);
+        lv_mutex_delete(&thread_dsc->queue_lock);
     }
+    lv_mutex_delete(&draw_sw_unit->split.lock);
 
     return 0;
 #else
@@ -260,48 +289,65 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
      * Otherwise return taken_cnt;
      */
 
-    /*If at least one is busy, it's not all idle*/
+    /*Number of draw tasks each thread is working on or has in its queue.
+     *If at least one is busy, it's not all idle.
+     *`queue_cnt` and `task_act` are read without locking so they might be stale.
+     *It's harmless: the load is used only to balance the work, and as only the dispatcher
+     *adds to the queues, a stale `queue_cnt` can only be larger than the real value.
+     *So a queue is never overfilled, at worst a task is queued only in the next dispatch.*/
+    uint32_t load[LV_DRAW_SW_DRAW_UNIT_CNT];
     bool all_idle = true;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
-        if(draw_sw_unit->thread_dscs[i].task_act) {
-            all_idle = false;
-            break;
-        }
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        load[i] = thread_dsc->queue_cnt + (thread_dsc->task_act ? 1 : 0);
+        if(load[i]) all_idle = false;
     }
 
+    /*Queue as many independent tasks as possible so that the threads can work on them
+     *without waiting for the next dispatch. The available tasks don't depend on each other
+     *so the threads can render them in any order.*/
     lv_draw_task_t * t = NULL;
-    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
-        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+    while(1) {
+        /*Give the task to the thread with the least work*/
+        uint32_t thread_i = 0;
+        for(i = 1; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            if(load[i] < load[thread_i]) thread_i = i;
+        }
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[thread_i];
 
-        /*Do nothing if busy*/
-        if(thread_dsc->task_act) continue;
+        /*Do nothing if all the queues are full*/
+        if(thread_dsc->queue_cnt >= draw_sw_unit->queue_size) break;
 
         /*Find an available task. Start from the previously taken task.*/
         t = lv_draw_get_next_available_task(layer, t, DRAW_UNIT_ID_SW);
-
-        /*If there is not available task don't try other threads as there won't be available
-         *tasks for then either*/
-        if(t == NULL) {
-            LV_PROFILER_DRAW_END;
-            if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
-            else return taken_cnt;
-        }
+        if(t == NULL) break;
 
         /*Allocate a buffer if not done yet.*/
         void * buf = lv_draw_layer_alloc_buf(layer);
-        /*Do not return is failed. The other thread might already have a buffer can do something. */
-        if(buf == NULL) continue;
+        if(buf == NULL) break;
 
         /*Take the task*/
         all_idle = false;
         taken_cnt++;
+        load[thread_i]++;
         t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
-        thread_dsc->task_act = t;
 
-        /*Let the render thread work*/
-        if(thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
+        lv_mutex_lock(&thread_dsc->queue_lock);
+        uint32_t tail = (thread_dsc->queue_head + thread_dsc->queue_cnt) % LV_DRAW_SW_THREAD_QUEUE_SIZE;
+        thread_dsc->queue[tail] = t;
+        thread_dsc->queue_cnt++;
+        lv_mutex_unlock(&thread_dsc->queue_lock);
     }
 
+    /*Let the render threads work. Wake up all of them as the idle ones can steal tasks from the others.*/
+    if(taken_cnt) {
+        for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+            if(thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
+        }
+    }
+
+    LV_PROFILER_DRAW_END;
     if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
     else return taken_cnt;
 
@@ -328,7 +374,13 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->task_act = t;
 
+#if LV_USE_SYSMON
+    uint32_t busy_start = lv_tick_get();
     execute_drawing(t);
+    draw_unit->busy_time += lv_tick_elaps(busy_start);
+#else
+    execute_drawing(t);
+#endif
     draw_sw_unit->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
     draw_sw_unit->task_act = NULL;
 
@@ -345,39 +397,343 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
 static void render_thread_cb(void * ptr)
 {
     lv_draw_sw_thread_dsc_t * thread_dsc = ptr;
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) thread_dsc->draw_unit;
 
     lv_thread_sync_init(&thread_dsc->sync);
     thread_dsc->inited = true;
 
+    bool busy = false;
+#if LV_USE_SYSMON
+    uint32_t busy_start = 0;
+#endif
     while(1) {
-        while(thread_dsc->task_act == NULL) {
+        /*If a large draw task is split, its thread waits for the bands so help it first.
+         *Else take the oldest task from the own queue or steal one from an other thread.*/
+        lv_draw_task_t * t = NULL;
+        lv_draw_sw_split_t * split = &draw_sw_unit->split;
+        bool has_band = split->task && split->y_next <= split->y_end;
+        if(!has_band) {
+            t = queue_take(thread_dsc, thread_dsc);
+            if(t == NULL) t = steal_task(thread_dsc);
+        }
+
+        if(!has_band && t == NULL) {
+            /*There is nothing to do. Request a new dispatching to get new tasks.*/
+            if(busy) {
+                busy = false;
+                lv_draw_dispatch_request();
+            }
+
             if(thread_dsc->exit_status) {
+                LV_LOG_INFO("ready to exit software rendering thread");
                 break;
             }
+
             lv_thread_sync_wait(&thread_dsc->sync);
+            continue;
         }
 
-        if(thread_dsc->exit_status) {
-            LV_LOG_INFO("ready to exit software rendering thread");
-            break;
+        if(!busy) {
+            busy = true;
+#if LV_USE_SYSMON
+            busy_start = lv_tick_get();
+#endif
         }
 
-        execute_drawing(thread_dsc->task_act);
+        if(has_band) {
+            split_render_band(thread_dsc);
+#if LV_USE_SYSMON
+            add_busy_time(thread_dsc, &busy_start);
+#endif
+            continue;
+        }
+
+        if(!split_task(thread_dsc, t)) {
+            execute_drawing(t);
 #if LV_USE_PARALLEL_DRAW_DEBUG
-        parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
+            parallel_debug_draw(t, thread_dsc->idx);
+#endif
+        }
+#if LV_USE_SYSMON
+        /*Account the time before finishing the task so that it's counted in the current refresh*/
+        add_busy_time(thread_dsc, &busy_start);
 #endif
-        thread_dsc->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
         thread_dsc->task_act = NULL;
+        thread_dsc->task_cnt++;
 
-        /*The draw unit is free now. Request a new dispatching as it can get a new task*/
-        lv_draw_dispatch_request();
-
+        /*The finished task might have blocked other tasks. If a thread is idle
+         *request a new dispatching so that it can get the unblocked tasks.*/
+        if(has_idle_thread(draw_sw_unit)) lv_draw_dispatch_request();
     }
 
     thread_dsc->inited = false;
     lv_thread_sync_delete(&thread_dsc->sync);
     LV_LOG_INFO("exit software rendering thread");
 }
+
+/**
+ * Remove a draw task from the queue of a render thread and make it the active task of `taker`
+ * @param thread_dsc    pointer to the render thread descriptor whose queue should be used
+ * @param taker         pointer to the render thread which will render the task.
+ *                      If it's not `thread_dsc` the newest task is stolen, else the oldest is taken.
+ * @return              the removed draw task or NULL if the queue was empty
+ */
+static lv_draw_task_t * queue_take(lv_draw_sw_thread_dsc_t * thread_dsc, lv_draw_sw_thread_dsc_t * taker)
+{
+    if(thread_dsc->queue_cnt == 0) return NULL;
+
+    lv_draw_task_t * t = NULL;
+    lv_mutex_lock(&thread_dsc->queue_lock);
+    if(thread_dsc->queue_cnt) {
+        if(taker != thread_dsc) {
+            uint32_t tail = (thread_dsc->queue_head + thread_dsc->queue_cnt - 1) % LV_DRAW_SW_THREAD_QUEUE_SIZE;
+            t = thread_dsc->queue[tail];
+        }
+        else {
+            t = thread_dsc->queue[thread_dsc->queue_head];
+            thread_dsc->queue_head = (thread_dsc->queue_head + 1) % LV_DRAW_SW_THREAD_QUEUE_SIZE;
+        }
+
+        /*Set the active task first so that the task is always visible for `dispatch` as work in progress*/
+        taker->task_act = t;
+        thread_dsc->queue_cnt--;
+    }
+    lv_mutex_unlock(&thread_dsc->queue_lock);
+
+    return t;
+}
+
+/**
+ * Take a draw task from the queue of an other render thread
+ * @param thread_dsc    pointer to the descriptor of the idle render thread
+ * @return              the stolen draw task or NULL if all the queues are empty
+ */
+static lv_draw_task_t * steal_task(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) thread_dsc->draw_unit;
+
+    uint32_t i;
+    for(i = 1; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * victim = &draw_sw_unit->thread_dscs[(thread_dsc->idx + i) % LV_DRAW_SW_DRAW_UNIT_CNT];
+        lv_draw_task_t * t = queue_take(victim, thread_dsc);
+        if(t) {
+            thread_dsc->steal_cnt++;
+            return t;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Check if there is a render thread without any work
+ * @param draw_sw_unit  pointer to the software draw unit
+ * @return              true: at least one thread is idle
+ */
+static bool has_idle_thread(lv_draw_sw_unit_t * draw_sw_unit)
+{
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        if(thread_dsc->task_act == NULL && thread_dsc->queue_cnt == 0) return true;
+    }
+
+    return false;
+}
+
+#if LV_USE_SYSMON
+/**
+ * Add the time elapsed since `busy_start` to the busy time of a render thread.
+ * Only the thread itself writes its busy time so no locking is needed.
+ * @param thread_dsc    pointer to the render thread descriptor
+ * @param busy_start    pointer to the start of the measurement. It's set to the current tick.
+ */
+static void add_busy_time(lv_draw_sw_thread_dsc_t * thread_dsc, uint32_t * busy_start)
+{
+    uint32_t tick = lv_tick_get();
+    thread_dsc->busy_time += lv_tick_diff(tick, *busy_start);
+    *busy_start = tick;
+}
+
+/**
+ * Sum the busy time of the render threads
+ * @param draw_unit     pointer to the software draw unit
+ * @return              the time spent with rendering by all the threads [ms]
+ */
+static uint32_t get_busy_time(lv_draw_unit_t * draw_unit)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+
+    uint32_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        sum += draw_sw_unit->thread_dscs[i].busy_time;
+    }
+
+    return sum;
+}
+#endif /*LV_USE_SYSMON*/
+
+/**
+ * Render a large draw task in horizontal bands together with the other render threads.
+ * Returns only when all the bands are rendered.
+ * @param thread_dsc    pointer to the descriptor of the render thread which took the draw task
+ * @param t             pointer to a draw task
+ * @return              true: the draw task was rendered; false: the draw task shouldn't be split
+ */
+static bool split_task(lv_draw_sw_thread_dsc_t * thread_dsc, lv_draw_task_t * t)
+{
+    if(LV_DRAW_SW_DRAW_UNIT_CNT < 2 || LV_DRAW_SW_SPLIT_MIN_AREA == 0) return false;
+
+    /*Only these draw tasks can be rendered in bands without any side effects*/
+    if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_BOX_SHADOW &&
+       t->type != LV_DRAW_TASK_TYPE_IMAGE && t->type != LV_DRAW_TASK_TYPE_LAYER) {
+        return false;
+    }
+
+#if !LV_DRAW_SW_COMPLEX || !LV_DRAW_SW_SHADOW_CACHE_BYTES
+    /*Without the cache each band would blur the shadow corner again*/
+    if(t->type == LV_DRAW_TASK_TYPE_BOX_SHADOW) return false;
+#endif
+
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE || t->type == LV_DRAW_TASK_TYPE_LAYER) {
+        const lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+        /*The bitmap mask is applied on the whole layer buffer, so it can't be done band by band*/
+        if(draw_dsc->bitmap_mask_src) return false;
+        /*The tiles are opened one by one*/
+        if(t->type == LV_DRAW_TASK_TYPE_IMAGE && draw_dsc->tile) return false;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return false;
+    if(lv_area_get_size(&draw_area) < LV_DRAW_SW_SPLIT_MIN_AREA) return false;
+
+    /*Use more bands than threads so that the threads can share the work more evenly*/
+    int32_t h = lv_area_get_height(&draw_area);
+    int32_t band_h = LV_MAX(h / (LV_DRAW_SW_DRAW_UNIT_CNT * 2), SPLIT_MIN_BAND_H);
+    if(band_h >= h) return false;
+
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) thread_dsc->draw_unit;
+    lv_draw_sw_split_t * split = &draw_sw_unit->split;
+
+    /*Only one draw task can be split at a time.
+     *Don't offer any bands until the shared resources are prepared.*/
+    lv_mutex_lock(&split->lock);
+    if(split->task) {
+        lv_mutex_unlock(&split->lock);
+        return false;
+    }
+
+    split->task = t;
+    split->owner = thread_dsc;
+    split->y_next = 1;
+    split->y_end = 0;
+    split->decoder_dsc = NULL;
+    lv_mutex_unlock(&split->lock);
+
+    /*Decode the image or blur the shadow corner only once and let all the bands use it*/
+    lv_image_decoder_dsc_t decoder_dsc;
+    bool prepared = true;
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+        prepared = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL) == LV_RESULT_OK;
+        /*The images decoded area by area can't be shared by the bands*/
+        if(prepared && decoder_dsc.decoded == NULL) {
+            lv_image_decoder_close(&decoder_dsc);
+            prepared = false;
+        }
+    }
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_BYTES
+    lv_cache_entry_t * shadow_corner = NULL;
+    if(t->type == LV_DRAW_TASK_TYPE_BOX_SHADOW) {
+        shadow_corner = lv_draw_sw_shadow_cache_acquire_corner(t->draw_dsc, &t->area);
+        prepared = shadow_corner != NULL;
+    }
+#endif
+
+    lv_mutex_lock(&split->lock);
+    if(!prepared) {
+        split->task = NULL;
+        lv_mutex_unlock(&split->lock);
+        return false;
+    }
+
+    split->y_next = draw_area.y1;
+    split->y_end = draw_area.y2;
+    split->band_h = band_h;
+    split->remaining = (h + band_h - 1) / band_h;
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE) split->decoder_dsc = &decoder_dsc;
+    lv_mutex_unlock(&split->lock);
+
+    /*Wake up the other threads to help*/
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * other = &draw_sw_unit->thread_dscs[i];
+        if(other != thread_dsc && other->inited) lv_thread_sync_signal(&other->sync);
+    }
+
+    while(split_render_band(thread_dsc));
+
+    /*Wait until the other threads finish their bands too*/
+    while(split->remaining) {
+        lv_thread_sync_wait(&thread_dsc->sync);
+    }
+
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE) lv_image_decoder_close(&decoder_dsc);
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_BYTES
+    if(shadow_corner) lv_draw_sw_shadow_cache_release_corner(shadow_corner);
+#endif
+
+    lv_mutex_lock(&split->lock);
+    split->task = NULL;
+    split->decoder_dsc = NULL;
+    lv_mutex_unlock(&split->lock);
+
+    return true;
+}
+
+/**
+ * Render the next band of the split draw task
+ * @param thread_dsc    pointer to the descriptor of the render thread
+ * @return              true: a band was rendered; false: there are no more bands to render
+ */
+static bool split_render_band(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) thread_dsc->draw_unit;
+    lv_draw_sw_split_t * split = &draw_sw_unit->split;
+
+    lv_mutex_lock(&split->lock);
+    if(split->task == NULL || split->y_next > split->y_end) {
+        lv_mutex_unlock(&split->lock);
+        return false;
+    }
+
+    /*Render a copy of the draw task whose clip area is limited to the band*/
+    lv_draw_task_t band_task = *split->task;
+    band_task.clip_area.y1 = split->y_next;
+    band_task.clip_area.y2 = LV_MIN(split->y_next + split->band_h - 1, split->y_end);
+    split->y_next = band_task.clip_area.y2 + 1;
+    lv_image_decoder_dsc_t * decoder_dsc = split->decoder_dsc;
+    lv_mutex_unlock(&split->lock);
+
+    if(decoder_dsc) lv_draw_sw_image_opened(&band_task, band_task.draw_dsc, decoder_dsc, &band_task.area);
+    else execute_drawing(&band_task);
+#if LV_USE_PARALLEL_DRAW_DEBUG
+    parallel_debug_draw(&band_task, thread_dsc->idx);
+#endif
+
+    lv_mutex_lock(&split->lock);
+    split->remaining--;
+    bool last = split->remaining == 0;
+    lv_draw_sw_thread_dsc_t * owner = split->owner;
+    lv_mutex_unlock(&split->lock);
+
+    /*Let the owner know that all the bands are ready*/
+    if(last && owner != thread_dsc) lv_thread_sync_signal(&owner->sync);
+
+    return true;
+}
 #endif
 
 static void execute_drawing(lv_draw_task_t * t)
@@ -409,6 +765,9 @@ static void execute_drawing(lv_draw_task_t * t)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_sw_line(t, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_sw_polyline(t, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_TRIANGLE:
             lv_draw_sw_triangle(t, t->draw_dsc);
             break;
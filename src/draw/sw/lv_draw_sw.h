@@ -34,6 +34,18 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+/** Statistics of the cache of the blurred shadow corners*/
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of shadow corners found in the cache*/
+    uint32_t miss_cnt;      /**< Number of shadow corners blurred and added to the cache*/
+} lv_draw_sw_shadow_cache_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -107,6 +119,13 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
  */
 void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw a polyline and its markers with SW render.
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor
+ */
+void lv_draw_sw_polyline(lv_draw_task_t * t, const lv_draw_polyline_dsc_t * dsc);
+
 /**
  * Blend a layer with SW render
  * @param t             pointer to a draw task
@@ -181,6 +200,19 @@ bool lv_draw_sw_unregister_blend_handler(lv_color_format_t dest_cf);
  */
 lv_draw_sw_blend_handler_t lv_draw_sw_get_blend_handler(lv_color_format_t dest_cf);
 
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+/**
+ * Get the hit and miss statistics of the cache of the blurred shadow corners.
+ * @param stat      store the statistics here
+ */
+void lv_draw_sw_shadow_cache_get_stat(lv_draw_sw_shadow_cache_stat_t * stat);
+
+/**
+ * Reset the hit and miss statistics of the cache of the blurred shadow corners.
+ */
+void lv_draw_sw_shadow_cache_reset_stat(void);
+#endif
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
@@ -9,7 +9,7 @@
 #include "../../misc/lv_area_private.h"
 #include "lv_draw_sw_mask_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 #if LV_USE_DRAW_SW
 
 #if LV_DRAW_SW_COMPLEX
@@ -21,6 +21,7 @@
 #include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_string.h"
 #include "../lv_draw_mask.h"
+#include "../../misc/cache/lv_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -28,13 +29,24 @@
 #define SHADOW_UPSCALE_SHIFT    6
 #define SHADOW_ENHANCE          1
 
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
     #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
+    #define CACHE_NAME "SW_SHADOW"
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t sw;         /**< Shadow width*/
+    int32_t r;          /**< Radius of the shadow*/
+    int32_t w;          /**< Width of the blurred rectangle. Clamped as larger widths result in the same corner.*/
+    int32_t h;          /**< Height of the blurred rectangle. Clamped as larger heights result in the same corner.*/
+    lv_opa_t * buf;     /**< The blurred corner followed by its horizontally mirrored copy*/
+} shadow_cache_data_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -42,6 +54,16 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static void shadow_mirror_corner_buf(lv_opa_t * sh_buf, int32_t size);
+static int32_t shadow_get_core_area(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords,
+                                    lv_area_t * core_area);
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    static lv_cache_entry_t * shadow_cache_acquire(int32_t sw, int32_t r, const lv_area_t * core_area);
+    static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs, const shadow_cache_data_t * rhs);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,14 +77,70 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+void lv_draw_sw_shadow_cache_init(void)
+{
+    lv_mutex_init(&shadow_cache.lock);
+
+    shadow_cache.cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(shadow_cache_data_t),
+    LV_DRAW_SW_SHADOW_CACHE_BYTES, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb,
+    });
+    lv_cache_set_name(shadow_cache.cache, CACHE_NAME);
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+    if(shadow_cache.cache) {
+        lv_cache_destroy(shadow_cache.cache, NULL);
+        shadow_cache.cache = NULL;
+    }
+
+    lv_mutex_delete(&shadow_cache.lock);
+}
+
+void lv_draw_sw_shadow_cache_get_stat(lv_draw_sw_shadow_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    lv_mutex_lock(&shadow_cache.lock);
+    *stat = shadow_cache.stat;
+    lv_mutex_unlock(&shadow_cache.lock);
+}
+
+void lv_draw_sw_shadow_cache_reset_stat(void)
+{
+    lv_mutex_lock(&shadow_cache.lock);
+    lv_memzero(&shadow_cache.stat, sizeof(shadow_cache.stat));
+    lv_mutex_unlock(&shadow_cache.lock);
+}
+
+lv_cache_entry_t * lv_draw_sw_shadow_cache_acquire_corner(const lv_draw_box_shadow_dsc_t * dsc,
+                                                          const lv_area_t * coords)
+{
+    lv_area_t core_area;
+    int32_t r_sh = shadow_get_core_area(dsc, coords, &core_area);
+
+    /*Don't count a miss here if the corner can't be cached as the shadow won't be drawn with it*/
+    int32_t corner_size = dsc->width + r_sh;
+    if((uint32_t)corner_size * corner_size * 2 > LV_DRAW_SW_SHADOW_CACHE_BYTES) return NULL;
+
+    return shadow_cache_acquire(dsc->width, r_sh, &core_area);
+}
+
+void lv_draw_sw_shadow_cache_release_corner(lv_cache_entry_t * entry)
+{
+    lv_cache_release(shadow_cache.cache, entry, NULL);
+}
+#endif /*LV_DRAW_SW_SHADOW_CACHE_BYTES*/
+
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
     lv_area_t core_area;
-    core_area.x1 = coords->x1  + dsc->ofs_x - dsc->spread;
-    core_area.x2 = coords->x2  + dsc->ofs_x + dsc->spread;
-    core_area.y1 = coords->y1  + dsc->ofs_y - dsc->spread;
-    core_area.y2 = coords->y2  + dsc->ofs_y + dsc->spread;
+    int32_t r_sh = shadow_get_core_area(dsc, coords, &core_area);
 
     /*Calculate the bounding box of the shadow*/
     lv_area_t shadow_area;
@@ -89,42 +167,26 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     int32_t short_side = LV_MIN(lv_area_get_width(&bg_area), lv_area_get_height(&bg_area));
     if(r_bg > short_side >> 1) r_bg = short_side >> 1;
 
-    /*Get the clamped radius*/
-    int32_t r_sh = dsc->radius;
-    short_side = LV_MIN(lv_area_get_width(&core_area), lv_area_get_height(&core_area));
-    if(r_sh > short_side >> 1) r_sh = short_side >> 1;
-
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
+    lv_opa_t * sh_buf = NULL;
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    /*Use the cached corner if available. It's shared with the other draw tasks so it must not be modified.*/
+    lv_cache_entry_t * cache_entry = shadow_cache_acquire(dsc->width, r_sh, &core_area);
+    if(cache_entry) {
+        shadow_cache_data_t * cached = lv_cache_entry_get_data(cache_entry);
+        sh_buf = cached->buf;
     }
-    else {
+#endif /*LV_DRAW_SW_SHADOW_CACHE_BYTES*/
+
+    if(sh_buf == NULL) {
         /*A larger buffer is required for calculation*/
         sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
         LV_ASSERT_MALLOC(sh_buf);
         shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
     }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -382,22 +444,13 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         }
     }
 
-    /*Mirror the shadow corner buffer horizontally*/
-    sh_buf_tmp = sh_buf ;
-    for(y = 0; y < corner_size; y++) {
-        int32_t x;
-        lv_opa_t * start = sh_buf_tmp;
-        lv_opa_t * end = sh_buf_tmp + corner_size - 1;
-        for(x = 0; x < corner_size / 2; x++) {
-            lv_opa_t tmp = *start;
-            *start = *end;
-            *end = tmp;
-
-            start++;
-            end--;
-        }
-        sh_buf_tmp += corner_size;
-    }
+    /*Mirror the shadow corner buffer horizontally. The cached corner has a mirrored copy after it.*/
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    if(cache_entry) sh_buf += corner_size * corner_size;
+    else shadow_mirror_corner_buf(sh_buf, corner_size);
+#else
+    shadow_mirror_corner_buf(sh_buf, corner_size);
+#endif
 
     /*Left side*/
     blend_area.x1 = shadow_area.x1;
@@ -555,7 +608,12 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    if(cache_entry) lv_cache_release(shadow_cache.cache, cache_entry, NULL);
+    else lv_free(sh_buf);
+#else
     lv_free(sh_buf);
+#endif
     lv_free(mask_buf);
 }
 
@@ -563,6 +621,28 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the rectangle which is blurred to get the shadow
+ * @param dsc           the shadow's draw descriptor
+ * @param coords        the coordinates of the object casting the shadow
+ * @param core_area     store the rectangle here
+ * @return              the radius of the shadow clamped to the size of `core_area`
+ */
+static int32_t shadow_get_core_area(const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords,
+                                    lv_area_t * core_area)
+{
+    core_area->x1 = coords->x1  + dsc->ofs_x - dsc->spread;
+    core_area->x2 = coords->x2  + dsc->ofs_x + dsc->spread;
+    core_area->y1 = coords->y1  + dsc->ofs_y - dsc->spread;
+    core_area->y2 = coords->y2  + dsc->ofs_y + dsc->spread;
+
+    int32_t r_sh = dsc->radius;
+    int32_t short_side = LV_MIN(lv_area_get_width(core_area), lv_area_get_height(core_area));
+    if(r_sh > short_side >> 1) r_sh = short_side >> 1;
+
+    return r_sh;
+}
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
@@ -730,6 +810,111 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     lv_free(sh_ups_blur_buf);
 }
 
+/**
+ * Mirror a shadow corner horizontally in place
+ * @param sh_buf    the corner buffer
+ * @param size      width and height of the corner
+ */
+static void shadow_mirror_corner_buf(lv_opa_t * sh_buf, int32_t size)
+{
+    int32_t y;
+    for(y = 0; y < size; y++) {
+        int32_t x;
+        lv_opa_t * start = sh_buf;
+        lv_opa_t * end = sh_buf + size - 1;
+        for(x = 0; x < size / 2; x++) {
+            lv_opa_t tmp = *start;
+            *start = *end;
+            *end = tmp;
+
+            start++;
+            end--;
+        }
+        sh_buf += size;
+    }
+}
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+/**
+ * Get the blurred corner of a shadow from the cache, add it to the cache if not there yet.
+ * @param sw            shadow width
+ * @param r             clamped radius of the shadow
+ * @param core_area     the rectangle which is blurred
+ * @return              the cache entry or NULL if the corner couldn't be cached (e.g. it's too large)
+ */
+static lv_cache_entry_t * shadow_cache_acquire(int32_t sw, int32_t r, const lv_area_t * core_area)
+{
+    if(shadow_cache.cache == NULL) return NULL;
+
+    /*The far edges and corners of a larger rectangle are outside of the corner buffer
+     *so such rectangles result in the same corner*/
+    int32_t corner_size = sw + r;
+    int32_t side_max = corner_size + r;
+    shadow_cache_data_t search_key = {
+        .slot.size = (uint32_t)corner_size * corner_size * 2,
+        .sw = sw,
+        .r = r,
+        .w = LV_MIN(lv_area_get_width(core_area), side_max),
+        .h = LV_MIN(lv_area_get_height(core_area), side_max),
+    };
+
+    /*Don't evict the whole cache for a corner which doesn't fit in it anyway*/
+    if(search_key.slot.size > LV_DRAW_SW_SHADOW_CACHE_BYTES) {
+        lv_mutex_lock(&shadow_cache.lock);
+        shadow_cache.stat.miss_cnt++;
+        lv_mutex_unlock(&shadow_cache.lock);
+        return NULL;
+    }
+
+    bool created = false;
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(shadow_cache.cache, &search_key, &created);
+    if(entry == NULL) return NULL;
+
+    lv_mutex_lock(&shadow_cache.lock);
+    if(created) shadow_cache.stat.miss_cnt++;
+    else shadow_cache.stat.hit_cnt++;
+    lv_mutex_unlock(&shadow_cache.lock);
+
+    return entry;
+}
+
+static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data)
+{
+    int32_t corner_size = data->sw + data->r;
+    uint32_t px_cnt = (uint32_t)corner_size * corner_size;
+
+    /*The calculation needs 2 bytes per pixel which is just enough for the corner and its mirrored copy*/
+    data->buf = lv_malloc(px_cnt * sizeof(uint16_t));
+    if(data->buf == NULL) return false;
+
+    lv_area_t core_area;
+    lv_area_set(&core_area, 0, 0, data->w - 1, data->h - 1);
+    shadow_draw_corner_buf(&core_area, (uint16_t *)data->buf, data->sw, data->r);
+
+    lv_memcpy(data->buf + px_cnt, data->buf, px_cnt);
+    shadow_mirror_corner_buf(data->buf + px_cnt, corner_size);
+
+    bool * created = user_data;
+    *created = true;
+    return true;
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->buf);
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs, const shadow_cache_data_t * rhs)
+{
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+    return 0;
+}
+#endif /*LV_DRAW_SW_SHADOW_CACHE_BYTES*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
@@ -12,6 +12,7 @@
 #include "../lv_draw_image_private.h"
 #include "../lv_draw_private.h"
 #include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 #if LV_USE_DRAW_SW
 
 #include "../../display/lv_display.h"
@@ -209,6 +210,12 @@ void lv_draw_sw_image(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
     }
 }
 
+void lv_draw_sw_image_opened(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
+                             lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords)
+{
+    lv_draw_image_opened_helper(t, draw_dsc, decoder_dsc, coords, img_draw_core);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -23,17 +23,49 @@
  *      DEFINES
  *********************/
 
+/*Max. size of the coverage mask of a polyline which is blended at once*/
+#define POLYLINE_BAND_MAX_SIZE  (16 * 1024)
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_COMPLEX
+/*The masks and area of a skew line*/
+typedef struct {
+    lv_draw_sw_mask_line_param_t left;
+    lv_draw_sw_mask_line_param_t right;
+    lv_draw_sw_mask_line_param_t top;
+    lv_draw_sw_mask_line_param_t bottom;
+    void * masks[5];
+    lv_area_t area;
+} skew_line_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
-static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
+static void draw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc, lv_opa_t * mask_buf);
+static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc,
+                                                       lv_opa_t * mask_buf);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_hor(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
+static void get_line_hor_area(const lv_draw_line_dsc_t * dsc, lv_area_t * area);
+static void get_line_ver_area(const lv_draw_line_dsc_t * dsc, lv_area_t * area);
+#if LV_DRAW_SW_COMPLEX
+    static void skew_line_init(skew_line_t * line, const lv_draw_line_dsc_t * dsc);
+    static void skew_line_free(skew_line_t * line);
+    static void draw_polyline_segments(lv_draw_task_t * t, const lv_draw_polyline_dsc_t * dsc,
+                                       lv_draw_line_dsc_t * line_dsc);
+    static bool add_segment_coverage(const lv_draw_line_dsc_t * dsc, const lv_area_t * band, lv_opa_t * band_buf,
+                                     lv_opa_t * row_buf);
+    static bool add_cap_coverage(const lv_point_precise_t * p, int32_t width, const lv_area_t * band,
+                                 lv_opa_t * band_buf, lv_opa_t * row_buf);
+    static bool add_rect_coverage(const lv_area_t * area, const lv_area_t * band, lv_opa_t * band_buf);
+    static bool add_mask_coverage(void * masks[], const lv_area_t * area, const lv_area_t * band,
+                                  lv_opa_t * band_buf, lv_opa_t * row_buf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -48,6 +80,91 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_task_t * t, const
  **********************/
 
 void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    draw_line(t, dsc, NULL);
+    LV_PROFILER_DRAW_END;
+}
+
+void lv_draw_sw_polyline(lv_draw_task_t * t, const lv_draw_polyline_dsc_t * dsc)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    if(dsc->point_cnt >= 2 && dsc->width > 0 && dsc->opa > LV_OPA_MIN) {
+        lv_draw_line_dsc_t line_dsc;
+        lv_draw_line_dsc_init(&line_dsc);
+        line_dsc.color = dsc->color;
+        line_dsc.width = dsc->width;
+        line_dsc.dash_width = dsc->dash_width;
+        line_dsc.dash_gap = dsc->dash_gap;
+        line_dsc.opa = dsc->opa;
+        line_dsc.round_start = dsc->round_start;
+        line_dsc.round_end = dsc->round_end;
+        line_dsc.raw_end = dsc->raw_end;
+
+        bool dashed = dsc->dash_gap && dsc->dash_width;
+#if LV_DRAW_SW_COMPLEX
+        if(!dashed) {
+            draw_polyline_segments(t, dsc, &line_dsc);
+        }
+        else
+#endif
+        {
+            /*Only horizontal and vertical lines can be dashed and they have a simple shape,
+             *so draw them one by one. The mask buffer of the skew segments is never larger
+             *than a row, so allocate it only once for all the segments.*/
+            lv_opa_t * mask_buf = NULL;
+#if LV_DRAW_SW_COMPLEX
+            uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
+            mask_buf = lv_malloc(hor_res);
+            LV_ASSERT_MALLOC(mask_buf);
+#endif
+
+            uint32_t i;
+            for(i = 1; i < dsc->point_cnt; i++) {
+                line_dsc.p1 = dsc->points[i - 1];
+                line_dsc.p2 = dsc->points[i];
+                draw_line(t, &line_dsc, mask_buf);
+            }
+
+            lv_free(mask_buf);
+            LV_UNUSED(dashed);
+        }
+    }
+
+    if(dsc->marker_w > 0 && dsc->marker_h > 0 && dsc->marker_opa > LV_OPA_MIN) {
+        lv_draw_fill_dsc_t fill_dsc;
+        lv_draw_fill_dsc_init(&fill_dsc);
+        fill_dsc.color = dsc->marker_color;
+        fill_dsc.opa = dsc->marker_opa;
+        fill_dsc.radius = dsc->marker_radius;
+
+        uint32_t i;
+        for(i = 0; i < dsc->point_cnt; i++) {
+            lv_area_t marker_area;
+            marker_area.x1 = (int32_t)dsc->points[i].x - dsc->marker_w;
+            marker_area.x2 = (int32_t)dsc->points[i].x + dsc->marker_w;
+            marker_area.y1 = (int32_t)dsc->points[i].y - dsc->marker_h;
+            marker_area.y2 = (int32_t)dsc->points[i].y + dsc->marker_h;
+            if(!lv_area_is_on(&marker_area, &t->clip_area)) continue;
+
+            lv_draw_sw_fill(t, &fill_dsc, &marker_area);
+        }
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Draw a line
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor
+ * @param mask_buf      a buffer with at least horizontal resolution size for the skew lines
+ *                      or NULL to allocate it here
+ */
+static void draw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc, lv_opa_t * mask_buf)
 {
     if(dsc->width == 0) return;
     if(dsc->opa <= LV_OPA_MIN) return;
@@ -64,10 +181,9 @@ void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
     is_common = lv_area_intersect(&clip_line, &clip_line, &t->clip_area);
     if(!is_common) return;
 
-    LV_PROFILER_DRAW_BEGIN;
     if((int32_t)dsc->p1.y == (int32_t)dsc->p2.y) draw_line_hor(t, dsc);
     else if((int32_t)dsc->p1.x == (int32_t)dsc->p2.x) draw_line_ver(t, dsc);
-    else draw_line_skew(t, dsc);
+    else draw_line_skew(t, dsc, mask_buf);
 
     if(dsc->round_end || dsc->round_start) {
         lv_draw_fill_dsc_t cir_dsc;
@@ -96,23 +212,12 @@ void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
             lv_draw_sw_fill(t, &cir_dsc, &cir_area);
         }
     }
-    LV_PROFILER_DRAW_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
 static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
 {
-    int32_t w = dsc->width - 1;
-    int32_t w_half0 = w >> 1;
-    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
-
     lv_area_t blend_area;
-    blend_area.x1 = (int32_t)LV_MIN(dsc->p1.x, dsc->p2.x);
-    blend_area.x2 = (int32_t)LV_MAX(dsc->p1.x, dsc->p2.x)  - 1;
-    blend_area.y1 = (int32_t)dsc->p1.y - w_half1;
-    blend_area.y2 = (int32_t)dsc->p1.y + w_half0;
+    get_line_hor_area(dsc, &blend_area);
 
     bool is_common;
     is_common = lv_area_intersect(&blend_area, &blend_area, &t->clip_area);
@@ -179,15 +284,8 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_dra
 
 static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
 {
-    int32_t w = dsc->width - 1;
-    int32_t w_half0 = w >> 1;
-    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
-
     lv_area_t blend_area;
-    blend_area.x1 = (int32_t)dsc->p1.x - w_half1;
-    blend_area.x2 = (int32_t)dsc->p1.x + w_half0;
-    blend_area.y1 = (int32_t)LV_MIN(dsc->p1.y, dsc->p2.y);
-    blend_area.y2 = (int32_t)LV_MAX(dsc->p1.y, dsc->p2.y) - 1;
+    get_line_ver_area(dsc, &blend_area);
 
     bool is_common;
     is_common = lv_area_intersect(&blend_area, &blend_area, &t->clip_area);
@@ -248,9 +346,132 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_dra
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
 
-static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
+static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc,
+                                                  lv_opa_t * mask_buf)
 {
 #if LV_DRAW_SW_COMPLEX
+    skew_line_t line;
+    skew_line_init(&line, dsc);
+
+    /*Get the union of `coords` and `clip`*/
+    /*`clip` is already truncated to the `draw_buf` size
+     *in 'lv_refr_area' function*/
+    lv_area_t blend_area;
+    bool is_common = lv_area_intersect(&blend_area, &line.area, &t->clip_area);
+    if(is_common == false) {
+        skew_line_free(&line);
+        return;
+    }
+
+    /*The real draw area is around the line.
+     *It's easy to calculate with steep lines, but the area can be very wide with very flat lines.
+     *So deal with it only with steep lines.*/
+    int32_t draw_area_w = lv_area_get_width(&blend_area);
+
+    /*Draw the background line by line*/
+    int32_t h;
+    uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
+    size_t mask_buf_size = LV_MIN(lv_area_get_size(&blend_area), hor_res);
+    bool own_mask_buf = mask_buf == NULL;
+    if(own_mask_buf) mask_buf = lv_malloc(mask_buf_size);
+
+    int32_t y2 = blend_area.y2;
+    blend_area.y2 = blend_area.y1;
+
+    uint32_t mask_p = 0;
+    lv_memset(mask_buf, 0xff, mask_buf_size);
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = &blend_area;
+
+    /*Fill the first row with 'color'*/
+    for(h = blend_area.y1; h <= y2; h++) {
+        blend_dsc.mask_res = lv_draw_sw_mask_apply(line.masks, &mask_buf[mask_p], blend_area.x1, h, draw_area_w);
+        if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
+            lv_memzero(&mask_buf[mask_p], draw_area_w);
+        }
+
+        mask_p += draw_area_w;
+        if((uint32_t) mask_p + draw_area_w < mask_buf_size) {
+            blend_area.y2 ++;
+        }
+        else {
+            blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+            lv_draw_sw_blend(t, &blend_dsc);
+
+            blend_area.y1 = blend_area.y2 + 1;
+            blend_area.y2 = blend_area.y1;
+            mask_p = 0;
+            lv_memset(mask_buf, 0xff, mask_buf_size);
+        }
+    }
+
+    /*Flush the last part*/
+    if(blend_area.y1 != blend_area.y2) {
+        blend_area.y2--;
+        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(t, &blend_dsc);
+    }
+
+    if(own_mask_buf) lv_free(mask_buf);
+
+    skew_line_free(&line);
+#else
+    LV_UNUSED(t);
+    LV_UNUSED(dsc);
+    LV_UNUSED(mask_buf);
+    LV_LOG_WARN("Can't draw skewed line with LV_DRAW_SW_COMPLEX == 0");
+#endif /*LV_DRAW_SW_COMPLEX*/
+}
+
+/**
+ * Get the area of a horizontal line
+ * @param dsc       the draw descriptor of the line
+ * @param area      store the area here
+ */
+static void get_line_hor_area(const lv_draw_line_dsc_t * dsc, lv_area_t * area)
+{
+    int32_t w = dsc->width - 1;
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+
+    area->x1 = (int32_t)LV_MIN(dsc->p1.x, dsc->p2.x);
+    area->x2 = (int32_t)LV_MAX(dsc->p1.x, dsc->p2.x)  - 1;
+    area->y1 = (int32_t)dsc->p1.y - w_half1;
+    area->y2 = (int32_t)dsc->p1.y + w_half0;
+}
+
+/**
+ * Get the area of a vertical line
+ * @param dsc       the draw descriptor of the line
+ * @param area      store the area here
+ */
+static void get_line_ver_area(const lv_draw_line_dsc_t * dsc, lv_area_t * area)
+{
+    int32_t w = dsc->width - 1;
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+
+    area->x1 = (int32_t)dsc->p1.x - w_half1;
+    area->x2 = (int32_t)dsc->p1.x + w_half0;
+    area->y1 = (int32_t)LV_MIN(dsc->p1.y, dsc->p2.y);
+    area->y2 = (int32_t)LV_MAX(dsc->p1.y, dsc->p2.y) - 1;
+}
+
+#if LV_DRAW_SW_COMPLEX
+
+/**
+ * Initialize the masks of a skew line and get its area
+ * @param line      the masks and the area will be stored here. Free with `skew_line_free`.
+ * @param dsc       the draw descriptor of the line
+ */
+static void skew_line_init(skew_line_t * line, const lv_draw_line_dsc_t * dsc)
+{
     /*Keep the great y in p1*/
     lv_point_t p1;
     lv_point_t p2;
@@ -284,125 +505,278 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
     int32_t w_half0 = w >> 1;
     int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
 
-    lv_area_t blend_area;
-    blend_area.x1 = LV_MIN(p1.x, p2.x) - w;
-    blend_area.x2 = LV_MAX(p1.x, p2.x) + w;
-    blend_area.y1 = LV_MIN(p1.y, p2.y) - w;
-    blend_area.y2 = LV_MAX(p1.y, p2.y) + w;
-
-    /*Get the union of `coords` and `clip`*/
-    /*`clip` is already truncated to the `draw_buf` size
-     *in 'lv_refr_area' function*/
-    bool is_common = lv_area_intersect(&blend_area, &blend_area, &t->clip_area);
-    if(is_common == false) return;
-
-    lv_draw_sw_mask_line_param_t mask_left_param;
-    lv_draw_sw_mask_line_param_t mask_right_param;
-    lv_draw_sw_mask_line_param_t mask_top_param;
-    lv_draw_sw_mask_line_param_t mask_bottom_param;
-
-    void * masks[5] = {&mask_left_param, & mask_right_param, NULL, NULL, NULL};
+    line->area.x1 = LV_MIN(p1.x, p2.x) - w;
+    line->area.x2 = LV_MAX(p1.x, p2.x) + w;
+    line->area.y1 = LV_MIN(p1.y, p2.y) - w;
+    line->area.y2 = LV_MAX(p1.y, p2.y) + w;
 
     if(flat) {
         if(xdiff > 0) {
-            lv_draw_sw_mask_line_points_init(&mask_left_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
+            lv_draw_sw_mask_line_points_init(&line->left, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
                                              LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-            lv_draw_sw_mask_line_points_init(&mask_right_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
+            lv_draw_sw_mask_line_points_init(&line->right, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
                                              LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
         }
         else {
-            lv_draw_sw_mask_line_points_init(&mask_left_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
+            lv_draw_sw_mask_line_points_init(&line->left, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
                                              LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-            lv_draw_sw_mask_line_points_init(&mask_right_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
+            lv_draw_sw_mask_line_points_init(&line->right, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
                                              LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
         }
     }
     else {
-        lv_draw_sw_mask_line_points_init(&mask_left_param, p1.x + w_half1, p1.y, p2.x + w_half1, p2.y,
+        lv_draw_sw_mask_line_points_init(&line->left, p1.x + w_half1, p1.y, p2.x + w_half1, p2.y,
                                          LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-        lv_draw_sw_mask_line_points_init(&mask_right_param, p1.x - w_half0, p1.y, p2.x - w_half0, p2.y,
+        lv_draw_sw_mask_line_points_init(&line->right, p1.x - w_half0, p1.y, p2.x - w_half0, p2.y,
                                          LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
 
     }
 
-    /*Use the normal vector for the endings*/
+    line->masks[0] = &line->left;
+    line->masks[1] = &line->right;
+    line->masks[2] = NULL;
+    line->masks[3] = NULL;
+    line->masks[4] = NULL;
 
+    /*Use the normal vector for the endings*/
     if(!dsc->raw_end) {
-        lv_draw_sw_mask_line_points_init(&mask_top_param, p1.x, p1.y, p1.x - ydiff, p1.y + xdiff,
+        lv_draw_sw_mask_line_points_init(&line->top, p1.x, p1.y, p1.x - ydiff, p1.y + xdiff,
                                          LV_DRAW_SW_MASK_LINE_SIDE_BOTTOM);
-        lv_draw_sw_mask_line_points_init(&mask_bottom_param, p2.x, p2.y, p2.x - ydiff, p2.y + xdiff,
+        lv_draw_sw_mask_line_points_init(&line->bottom, p2.x, p2.y, p2.x - ydiff, p2.y + xdiff,
                                          LV_DRAW_SW_MASK_LINE_SIDE_TOP);
-        masks[2] = &mask_top_param;
-        masks[3] = &mask_bottom_param;
+        line->masks[2] = &line->top;
+        line->masks[3] = &line->bottom;
     }
+}
 
-    /*The real draw area is around the line.
-     *It's easy to calculate with steep lines, but the area can be very wide with very flat lines.
-     *So deal with it only with steep lines.*/
-    int32_t draw_area_w = lv_area_get_width(&blend_area);
-
-    /*Draw the background line by line*/
-    int32_t h;
-    uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
-    size_t mask_buf_size = LV_MIN(lv_area_get_size(&blend_area), hor_res);
-    lv_opa_t * mask_buf = lv_malloc(mask_buf_size);
+/**
+ * Free the masks of a skew line
+ * @param line      a skew line initialized by `skew_line_init`
+ */
+static void skew_line_free(skew_line_t * line)
+{
+    uint32_t i;
+    for(i = 0; line->masks[i]; i++) {
+        lv_draw_sw_mask_free_param(line->masks[i]);
+    }
+}
 
-    int32_t y2 = blend_area.y2;
-    blend_area.y2 = blend_area.y1;
+/**
+ * Draw the segments of a polyline in one pass. The coverage of the segments and round endings is
+ * collected in a mask with the maximum of the overlapping parts, and each band of the mask is
+ * blended only once. This way the joints are not blended twice, so they are not darker than the
+ * segments with translucent lines.
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor of the polyline
+ * @param line_dsc      a line draw descriptor with the parameters of the segments
+ */
+static void draw_polyline_segments(lv_draw_task_t * t, const lv_draw_polyline_dsc_t * dsc,
+                                   lv_draw_line_dsc_t * line_dsc)
+{
+    /*The area of all the segments. Skew segments are wider than `width`, see `skew_line_init`.*/
+    lv_area_t area;
+    area.x1 = (int32_t)dsc->points[0].x;
+    area.x2 = area.x1;
+    area.y1 = (int32_t)dsc->points[0].y;
+    area.y2 = area.y1;
+    uint32_t i;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        area.x1 = LV_MIN(area.x1, (int32_t)dsc->points[i].x);
+        area.x2 = LV_MAX(area.x2, (int32_t)dsc->points[i].x);
+        area.y1 = LV_MIN(area.y1, (int32_t)dsc->points[i].y);
+        area.y2 = LV_MAX(area.y2, (int32_t)dsc->points[i].y);
+    }
+    lv_area_increase(&area, dsc->width * 2, dsc->width * 2);
+    if(!lv_area_intersect(&area, &area, &t->clip_area)) return;
+
+    int32_t area_w = lv_area_get_width(&area);
+    int32_t band_h = LV_CLAMP(1, POLYLINE_BAND_MAX_SIZE / area_w, lv_area_get_height(&area));
+    lv_opa_t * band_buf = lv_malloc(area_w * band_h);
+    lv_opa_t * row_buf = lv_malloc(area_w);
+    LV_ASSERT_MALLOC(band_buf);
+    LV_ASSERT_MALLOC(row_buf);
+    if(band_buf == NULL || row_buf == NULL) {
+        lv_free(band_buf);
+        lv_free(row_buf);
+        return;
+    }
 
-    uint32_t mask_p = 0;
-    lv_memset(mask_buf, 0xff, mask_buf_size);
+    lv_area_t band;
+    band.x1 = area.x1;
+    band.x2 = area.x2;
 
     lv_draw_sw_blend_dsc_t blend_dsc;
     lv_memzero(&blend_dsc, sizeof(blend_dsc));
-    blend_dsc.blend_area = &blend_area;
+    blend_dsc.blend_area = &band;
     blend_dsc.color = dsc->color;
     blend_dsc.opa = dsc->opa;
-    blend_dsc.mask_buf = mask_buf;
-    blend_dsc.mask_area = &blend_area;
-
-    /*Fill the first row with 'color'*/
-    for(h = blend_area.y1; h <= y2; h++) {
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, &mask_buf[mask_p], blend_area.x1, h, draw_area_w);
-        if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-            lv_memzero(&mask_buf[mask_p], draw_area_w);
+    blend_dsc.mask_buf = band_buf;
+    blend_dsc.mask_area = &band;
+
+    for(band.y1 = area.y1; band.y1 <= area.y2; band.y1 += band_h) {
+        band.y2 = LV_MIN(band.y1 + band_h - 1, area.y2);
+        lv_memzero(band_buf, lv_area_get_size(&band));
+
+        bool covered = false;
+        for(i = 1; i < dsc->point_cnt; i++) {
+            line_dsc->p1 = dsc->points[i - 1];
+            line_dsc->p2 = dsc->points[i];
+            if(add_segment_coverage(line_dsc, &band, band_buf, row_buf)) covered = true;
         }
 
-        mask_p += draw_area_w;
-        if((uint32_t) mask_p + draw_area_w < mask_buf_size) {
-            blend_area.y2 ++;
+        /*A joint has both a round end and start, but it's added only once*/
+        if(dsc->round_start || dsc->round_end) {
+            for(i = 0; i < dsc->point_cnt; i++) {
+                bool has_start = dsc->round_start && i + 1 < dsc->point_cnt;
+                bool has_end = dsc->round_end && i > 0;
+                if(!has_start && !has_end) continue;
+                if(add_cap_coverage(&dsc->points[i], dsc->width, &band, band_buf, row_buf)) covered = true;
+            }
         }
-        else {
+
+        if(covered) {
             blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
             lv_draw_sw_blend(t, &blend_dsc);
-
-            blend_area.y1 = blend_area.y2 + 1;
-            blend_area.y2 = blend_area.y1;
-            mask_p = 0;
-            lv_memset(mask_buf, 0xff, mask_buf_size);
         }
     }
 
-    /*Flush the last part*/
-    if(blend_area.y1 != blend_area.y2) {
-        blend_area.y2--;
-        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
-        lv_draw_sw_blend(t, &blend_dsc);
+    lv_free(band_buf);
+    lv_free(row_buf);
+}
+
+/**
+ * Add the coverage of a segment to the coverage mask of a band
+ * @param dsc           the draw descriptor of the segment
+ * @param band          the area of the band
+ * @param band_buf      the coverage mask of the band
+ * @param row_buf       a buffer with at least the width of the band
+ * @return              true: the segment covers some pixels of the band
+ */
+static bool add_segment_coverage(const lv_draw_line_dsc_t * dsc, const lv_area_t * band, lv_opa_t * band_buf,
+                                 lv_opa_t * row_buf)
+{
+    if(dsc->p1.x == dsc->p2.x && dsc->p1.y == dsc->p2.y) return false;
+
+    lv_area_t area;
+    if((int32_t)dsc->p1.y == (int32_t)dsc->p2.y) {
+        get_line_hor_area(dsc, &area);
+        return add_rect_coverage(&area, band, band_buf);
+    }
+    else if((int32_t)dsc->p1.x == (int32_t)dsc->p2.x) {
+        get_line_ver_area(dsc, &area);
+        return add_rect_coverage(&area, band, band_buf);
     }
 
-    lv_free(mask_buf);
+    /*Skip the segments out of the band without initializing the masks*/
+    area.x1 = (int32_t)LV_MIN(dsc->p1.x, dsc->p2.x) - dsc->width * 2;
+    area.x2 = (int32_t)LV_MAX(dsc->p1.x, dsc->p2.x) + dsc->width * 2;
+    area.y1 = (int32_t)LV_MIN(dsc->p1.y, dsc->p2.y) - dsc->width * 2;
+    area.y2 = (int32_t)LV_MAX(dsc->p1.y, dsc->p2.y) + dsc->width * 2;
+    if(!lv_area_is_on(&area, band)) return false;
 
-    lv_draw_sw_mask_free_param(&mask_left_param);
-    lv_draw_sw_mask_free_param(&mask_right_param);
-    if(!dsc->raw_end) {
-        lv_draw_sw_mask_free_param(&mask_top_param);
-        lv_draw_sw_mask_free_param(&mask_bottom_param);
+    skew_line_t line;
+    skew_line_init(&line, dsc);
+    bool covered = add_mask_coverage(line.masks, &line.area, band, band_buf, row_buf);
+    skew_line_free(&line);
+
+    return covered;
+}
+
+/**
+ * Add the coverage of a round ending to the coverage mask of a band
+ * @param p             the center of the ending
+ * @param width         the width of the line
+ * @param band          the area of the band
+ * @param band_buf      the coverage mask of the band
+ * @param row_buf       a buffer with at least the width of the band
+ * @return              true: the ending covers some pixels of the band
+ */
+static bool add_cap_coverage(const lv_point_precise_t * p, int32_t width, const lv_area_t * band,
+                             lv_opa_t * band_buf, lv_opa_t * row_buf)
+{
+    int32_t r = (width >> 1);
+    int32_t r_corr = (width & 1) ? 0 : 1;
+    lv_area_t cir_area;
+    cir_area.x1 = (int32_t)p->x - r;
+    cir_area.y1 = (int32_t)p->y - r;
+    cir_area.x2 = (int32_t)p->x + r - r_corr;
+    cir_area.y2 = (int32_t)p->y + r - r_corr;
+    if(!lv_area_is_on(&cir_area, band)) return false;
+
+    lv_draw_sw_mask_radius_param_t param;
+    lv_draw_sw_mask_radius_init(&param, &cir_area, LV_RADIUS_CIRCLE, false);
+    void * masks[2] = {&param, NULL};
+    bool covered = add_mask_coverage(masks, &cir_area, band, band_buf, row_buf);
+    lv_draw_sw_mask_free_param(&param);
+
+    return covered;
+}
+
+/**
+ * Add a fully covered rectangle to the coverage mask of a band
+ * @param area          the rectangle
+ * @param band          the area of the band
+ * @param band_buf      the coverage mask of the band
+ * @return              true: the rectangle covers some pixels of the band
+ */
+static bool add_rect_coverage(const lv_area_t * area, const lv_area_t * band, lv_opa_t * band_buf)
+{
+    lv_area_t a;
+    if(!lv_area_intersect(&a, area, band)) return false;
+
+    int32_t band_w = lv_area_get_width(band);
+    int32_t w = lv_area_get_width(&a);
+    lv_opa_t * dest = &band_buf[(a.y1 - band->y1) * band_w + (a.x1 - band->x1)];
+    int32_t y;
+    for(y = a.y1; y <= a.y2; y++) {
+        lv_memset(dest, 0xff, w);
+        dest += band_w;
     }
-#else
-    LV_UNUSED(t);
-    LV_UNUSED(dsc);
-    LV_LOG_WARN("Can't draw skewed line with LV_DRAW_SW_COMPLEX == 0");
-#endif /*LV_DRAW_SW_COMPLEX*/
+
+    return true;
+}
+
+/**
+ * Add the coverage of masks to the coverage mask of a band, keeping the larger value
+ * where they overlap
+ * @param masks         NULL terminated array of masks
+ * @param area          the area affected by the masks
+ * @param band          the area of the band
+ * @param band_buf      the coverage mask of the band
+ * @param row_buf       a buffer with at least the width of the band
+ * @return              true: the masks cover some pixels of the band
+ */
+static bool add_mask_coverage(void * masks[], const lv_area_t * area, const lv_area_t * band,
+                              lv_opa_t * band_buf, lv_opa_t * row_buf)
+{
+    lv_area_t a;
+    if(!lv_area_intersect(&a, area, band)) return false;
+
+    int32_t band_w = lv_area_get_width(band);
+    int32_t w = lv_area_get_width(&a);
+    lv_opa_t * dest = &band_buf[(a.y1 - band->y1) * band_w + (a.x1 - band->x1)];
+    bool covered = false;
+    int32_t y;
+    for(y = a.y1; y <= a.y2; y++, dest += band_w) {
+        lv_memset(row_buf, 0xff, w);
+        lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks, row_buf, a.x1, y, w);
+        if(res == LV_DRAW_SW_MASK_RES_TRANSP) continue;
+
+        covered = true;
+        if(res == LV_DRAW_SW_MASK_RES_FULL_COVER) {
+            lv_memset(dest, 0xff, w);
+            continue;
+        }
+
+        int32_t x;
+        for(x = 0; x < w; x++) {
+            if(row_buf[x] > dest[x]) dest[x] = row_buf[x];
+        }
+    }
+
+    return covered;
 }
 
+#endif /*LV_DRAW_SW_COMPLEX*/
+
 #endif /*LV_USE_DRAW_SW*/
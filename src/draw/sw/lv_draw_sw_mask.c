@@ -26,6 +26,9 @@
 #define circle_cache_mutex              LV_GLOBAL_DEFAULT()->draw_info.circle_cache_mutex
 #define _circle_cache                   LV_GLOBAL_DEFAULT()->sw_circle_cache
 
+/*Runs of the same opacity shorter than this are kept in partial spans*/
+#define SPAN_MIN_LEN                    16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -65,6 +68,7 @@ static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radiu
 static lv_opa_t * get_next_line(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t y, int32_t * len,
                                 int32_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+static inline int32_t /* LV_ATTRIBUTE_FAST_MEM */ get_run_end(const lv_opa_t * mask_buf, int32_t x, int32_t len);
 
 /**********************
  *  STATIC VARIABLES
@@ -107,6 +111,45 @@ lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[]
     return changed ? LV_DRAW_SW_MASK_RES_CHANGED : LV_DRAW_SW_MASK_RES_FULL_COVER;
 }
 
+uint32_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_get_spans(const lv_opa_t * mask_buf, int32_t len,
+                                                         lv_draw_sw_mask_span_t spans[], uint32_t span_max)
+{
+    LV_ASSERT(span_max > 0);
+
+    uint32_t span_cnt = 0;
+    int32_t x = 0;
+    while(x < len) {
+        lv_opa_t opa = mask_buf[x];
+        int32_t run_end = get_run_end(mask_buf, x, len);
+
+        lv_draw_sw_mask_span_type_t type;
+        if(run_end - x < SPAN_MIN_LEN) type = LV_DRAW_SW_MASK_SPAN_PARTIAL;
+        else if(opa == LV_OPA_TRANSP) type = LV_DRAW_SW_MASK_SPAN_TRANSP;
+        else type = LV_DRAW_SW_MASK_SPAN_FULL_COVER;
+
+        lv_draw_sw_mask_span_t * last = span_cnt ? &spans[span_cnt - 1] : NULL;
+        if(last && last->type == type && (type != LV_DRAW_SW_MASK_SPAN_FULL_COVER || last->opa == opa)) {
+            last->len += run_end - x;
+        }
+        else if(span_cnt == span_max) {
+            /*No more spans, the rest of the line needs the mask*/
+            last->type = LV_DRAW_SW_MASK_SPAN_PARTIAL;
+            last->len += len - x;
+            break;
+        }
+        else {
+            spans[span_cnt].len = run_end - x;
+            spans[span_cnt].type = type;
+            spans[span_cnt].opa = opa;
+            span_cnt++;
+        }
+
+        x = run_end;
+    }
+
+    return span_cnt;
+}
+
 void lv_draw_sw_mask_free_param(void * p)
 {
     lv_mutex_lock(&circle_cache_mutex);
@@ -1234,4 +1277,28 @@ static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM mask_mix(lv_opa_t mask_act, lv_opa_
     return LV_UDIV255(mask_act * mask_new);
 }
 
+/**
+ * Find where the run of the same opacity starting at `x` ends
+ * @param mask_buf  a line of a mask
+ * @param x         start of the run
+ * @param len       length of the line
+ * @return          index of the first pixel with a different opacity or `len`
+ */
+static inline int32_t LV_ATTRIBUTE_FAST_MEM get_run_end(const lv_opa_t * mask_buf, int32_t x, int32_t len)
+{
+    lv_opa_t opa = mask_buf[x];
+    x++;
+    while(x < len && ((lv_uintptr_t)&mask_buf[x] & 0x3)) {
+        if(mask_buf[x] != opa) return x;
+        x++;
+    }
+
+    /*Compare 4 pixels at once*/
+    uint32_t opa32 = opa * 0x01010101U;
+    while(x + 4 <= len && *((const uint32_t *)&mask_buf[x]) == opa32) x += 4;
+
+    while(x < len && mask_buf[x] == opa) x++;
+    return x;
+}
+
 #endif /*LV_DRAW_SW_COMPLEX*/
@@ -49,6 +49,18 @@ typedef enum {
     LV_DRAW_SW_MASK_TYPE_MAP,
 } lv_draw_sw_mask_type_t;
 
+typedef enum {
+    LV_DRAW_SW_MASK_SPAN_TRANSP,        /**< All pixels are transparent, nothing to draw*/
+    LV_DRAW_SW_MASK_SPAN_FULL_COVER,    /**< All pixels have the same `opa`, can be drawn without a mask*/
+    LV_DRAW_SW_MASK_SPAN_PARTIAL,       /**< The opacity changes, the mask needs to be applied pixel by pixel*/
+} lv_draw_sw_mask_span_type_t;
+
+typedef struct {
+    int32_t len;                        /**< Length of the span in pixels*/
+    lv_draw_sw_mask_span_type_t type;
+    lv_opa_t opa;                       /**< Opacity of the pixels in `LV_DRAW_SW_MASK_SPAN_FULL_COVER` spans*/
+} lv_draw_sw_mask_span_t;
+
 typedef enum {
     LV_DRAW_SW_MASK_LINE_SIDE_LEFT = 0,
     LV_DRAW_SW_MASK_LINE_SIDE_RIGHT,
@@ -89,6 +101,18 @@ lv_draw_sw_mask_res_t /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_mask_apply(void * m
                                                                         int32_t abs_y,
                                                                         int32_t len);
 
+/**
+ * Split a line of a mask into run-length spans of transparent, fully covered and partially covered pixels.
+ * Runs of the same opacity are kept in partial spans if they are too short to be worth blending separately.
+ * @param mask_buf  a line of a mask, e.g. the result of `lv_draw_sw_mask_apply`
+ * @param len       length of the line (in pixel count)
+ * @param spans     store the spans here
+ * @param span_max  size of `spans`. If there are more runs the last span will be partial until the end of the line.
+ * @return          number of spans stored in `spans`
+ */
+uint32_t /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_mask_get_spans(const lv_opa_t * mask_buf, int32_t len,
+                                                               lv_draw_sw_mask_span_t spans[], uint32_t span_max);
+
 /**
  * Free the data from the parameter.
  * It's called inside `lv_draw_sw_mask_remove_id` and `lv_draw_sw_mask_remove_custom`
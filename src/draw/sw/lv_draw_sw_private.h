@@ -16,6 +16,7 @@ extern "C" {
 
 #include "lv_draw_sw.h"
 #include "../lv_draw_private.h"
+#include "../../misc/cache/lv_cache.h"
 
 #if LV_USE_DRAW_SW
 
@@ -33,6 +34,17 @@ extern "C" {
 
 typedef struct {
     lv_draw_task_t * task_act;
+
+    /** Draw tasks waiting to be rendered by this thread. Other idle threads can steal from here too.*/
+    lv_draw_task_t * queue[LV_DRAW_SW_THREAD_QUEUE_SIZE];
+    uint32_t queue_head;            /**< Index of the oldest draw task in `queue`*/
+    volatile uint32_t queue_cnt;    /**< Number of draw tasks in `queue`*/
+    lv_mutex_t queue_lock;
+
+    uint32_t task_cnt;              /**< Number of rendered draw tasks*/
+    uint32_t steal_cnt;             /**< Number of draw tasks taken from the queue of other threads*/
+    volatile uint32_t busy_time;    /**< Time spent with rendering [ms]. Measured only if `LV_USE_SYSMON` is enabled.*/
+
     lv_thread_t thread;
     lv_thread_sync_t sync;
     lv_draw_unit_t * draw_unit;
@@ -41,20 +53,34 @@ typedef struct {
     volatile bool exit_status;
 } lv_draw_sw_thread_dsc_t;
 
+/** A large draw task which is rendered in horizontal bands by all the render threads*/
+typedef struct {
+    lv_draw_task_t * task;              /**< The draw task being split or NULL if there is none*/
+    lv_draw_sw_thread_dsc_t * owner;    /**< The thread which took the draw task and waits for the bands*/
+    int32_t y_next;                     /**< First row of the next band to render*/
+    int32_t y_end;                      /**< Last row to render*/
+    int32_t band_h;                     /**< Height of the bands*/
+    volatile uint32_t remaining;        /**< Number of bands which are not rendered yet*/
+    lv_image_decoder_dsc_t * decoder_dsc; /**< The image opened once for all the bands or NULL if not an image*/
+    lv_mutex_t lock;
+} lv_draw_sw_split_t;
+
 struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
 #if LV_USE_OS
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
+    lv_draw_sw_split_t split;
+    uint32_t queue_size;                /**< Max. number of draw tasks queued for a thread. At most `LV_DRAW_SW_THREAD_QUEUE_SIZE`*/
 #else
     lv_draw_task_t * task_act;
 #endif
 };
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
+    lv_cache_t * cache;                     /**< Blurred shadow corners shared by all the render threads*/
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_mutex_t lock;                        /**< Protects `stat`*/
 } lv_draw_sw_shadow_cache_t;
 #endif
 
@@ -62,6 +88,46 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+/**
+ * Create the cache of the blurred shadow corners.
+ * Called by LVGL in `lv_draw_sw_init()`
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Free the cache of the blurred shadow corners.
+ * Called by LVGL in `lv_draw_sw_deinit()`
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+
+/**
+ * Blur the corner of a box shadow and keep it in the cache until it's released.
+ * This way the bands of a split shadow can use the same corner.
+ * @param dsc       the shadow's draw descriptor
+ * @param coords    the coordinates of the object casting the shadow
+ * @return          the cache entry or NULL if the corner can't be cached (e.g. it's too large)
+ */
+lv_cache_entry_t * lv_draw_sw_shadow_cache_acquire_corner(const lv_draw_box_shadow_dsc_t * dsc,
+                                                          const lv_area_t * coords);
+
+/**
+ * Release a corner acquired by `lv_draw_sw_shadow_cache_acquire_corner()`
+ * @param entry     the cache entry of the corner
+ */
+void lv_draw_sw_shadow_cache_release_corner(lv_cache_entry_t * entry);
+#endif
+
+/**
+ * Draw an image which is already opened. Used to draw an image in bands without decoding it again.
+ * @param t             pointer to a draw task
+ * @param draw_dsc      the draw descriptor of the image
+ * @param decoder_dsc   the opened image
+ * @param coords        the coordinates of the image
+ */
+void lv_draw_sw_image_opened(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
+                             lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords);
+
 /**********************
  *      MACROS
  **********************/
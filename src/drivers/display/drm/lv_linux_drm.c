@@ -24,6 +24,7 @@
 
 #include "../../../stdlib/lv_sprintf.h"
 #include "../../../draw/lv_draw_buf.h"
+#include "../../../core/lv_obj.h"
 
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
 
@@ -46,6 +47,9 @@
 
 #define BUFFER_CNT 2
 
+/*Maximal number of rectangles passed in `FB_DAMAGE_CLIPS` in one commit*/
+#define DAMAGE_CLIP_CNT 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -58,7 +62,7 @@ typedef struct {
     uint32_t fb_handle;
 } drm_buffer_t;
 
-typedef struct {
+typedef struct _drm_dev_t {
     int fd;
     uint32_t conn_id, enc_id, crtc_id, plane_id, crtc_idx;
     uint32_t width, height;
@@ -80,6 +84,13 @@ typedef struct {
     drmModePropertyPtr conn_props[128];
     drm_buffer_t drm_bufs[BUFFER_CNT];
     drm_buffer_t * act_buf;
+    struct drm_mode_rect damage[DAMAGE_CLIP_CNT];
+    uint32_t damage_cnt;
+    bool crtc_active;               /**< The mode is already set on the CRTC*/
+    bool plane_active;              /**< A buffer was already committed to the plane*/
+    bool damage_unsupported;        /**< A commit with `FB_DAMAGE_CLIPS` was rejected, commit full frames*/
+    struct _drm_dev_t * parent;     /**< The device of the primary plane if this is an overlay plane*/
+    struct _drm_dev_t * overlay;    /**< The device of the overlay plane (if any)*/
 } drm_dev_t;
 
 /**********************
@@ -98,15 +109,21 @@ static int drm_add_crtc_property(drm_dev_t * drm_dev, const char * name, uint64_
 static int drm_add_conn_property(drm_dev_t * drm_dev, const char * name, uint64_t value);
 static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf);
 static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane_id, uint32_t crtc_id,
-                      uint32_t crtc_idx);
+                      uint32_t crtc_idx, bool overlay);
+static bool is_overlay_plane(drm_dev_t * drm_dev, uint32_t plane_id);
 static int drm_find_connector(drm_dev_t * drm_dev, int64_t connector_id);
 static int drm_open(const char * path);
 static int drm_setup(drm_dev_t * drm_dev, const char * device_path, int64_t connector_id, unsigned int fourcc);
 static int drm_allocate_dumb(drm_dev_t * drm_dev, drm_buffer_t * buf);
 static int drm_setup_buffers(drm_dev_t * drm_dev);
+static void drm_wait_for_flip(drm_dev_t * drm_dev);
 static void drm_flush_wait(lv_display_t * drm_dev);
+static void drm_add_damage(drm_dev_t * drm_dev, const lv_area_t * area);
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void drm_dmabuf_set_active_buf(lv_event_t * event);
+static void drm_overlay_delete_event_cb(lv_event_t * event);
+static void drm_free_plane_props(drm_dev_t * drm_dev);
+static void drm_free_buffers(drm_dev_t * drm_dev);
 
 static uint32_t tick_get_cb(void);
 
@@ -252,6 +269,90 @@ void lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_t conne
                 hor_res, ver_res, lv_display_get_dpi(disp));
 }
 
+lv_display_t * lv_linux_drm_create_overlay(lv_display_t * disp)
+{
+    drm_dev_t * parent = lv_display_get_driver_data(disp);
+    if(parent->fd < 0 || parent->parent || parent->overlay) {
+        LV_LOG_WARN("The display is not initialized or already has an overlay");
+        return NULL;
+    }
+
+    drm_dev_t * drm_dev = lv_malloc_zeroed(sizeof(drm_dev_t));
+    LV_ASSERT_MALLOC(drm_dev);
+    if(drm_dev == NULL) return NULL;
+
+    /* The device, the connector and the CRTC belong to the primary plane,
+     * only their IDs are needed to commit to the overlay plane */
+    drm_dev->parent = parent;
+    drm_dev->fd = parent->fd;
+    drm_dev->conn_id = parent->conn_id;
+    drm_dev->enc_id = parent->enc_id;
+    drm_dev->crtc_id = parent->crtc_id;
+    drm_dev->crtc_idx = parent->crtc_idx;
+    drm_dev->width = parent->width;
+    drm_dev->height = parent->height;
+    drm_dev->mmWidth = parent->mmWidth;
+    drm_dev->mmHeight = parent->mmHeight;
+    drm_dev->blob_id = parent->blob_id;
+    drm_dev->drm_event_ctx = parent->drm_event_ctx;
+    drm_dev->fourcc = DRM_FORMAT_ARGB8888;
+
+    if(find_plane(drm_dev, drm_dev->fourcc, &drm_dev->plane_id, drm_dev->crtc_id, drm_dev->crtc_idx, true)) {
+        LV_LOG_WARN("No overlay plane with ARGB8888 format was found");
+        goto free_dev;
+    }
+
+    drm_dev->plane = drmModeGetPlane(drm_dev->fd, drm_dev->plane_id);
+    if(!drm_dev->plane) {
+        LV_LOG_ERROR("Cannot get the overlay plane");
+        goto free_dev;
+    }
+
+    if(drm_get_plane_props(drm_dev)) {
+        LV_LOG_ERROR("Cannot get the overlay plane props");
+        goto free_plane;
+    }
+
+    if(drm_setup_buffers(drm_dev)) {
+        LV_LOG_ERROR("Cannot allocate the overlay buffers");
+        goto free_bufs;
+    }
+
+    lv_display_t * overlay_disp = lv_display_create(drm_dev->width, drm_dev->height);
+    if(overlay_disp == NULL) goto free_bufs;
+
+    lv_display_set_driver_data(overlay_disp, drm_dev);
+    lv_display_set_flush_wait_cb(overlay_disp, drm_flush_wait);
+    lv_display_set_flush_cb(overlay_disp, drm_flush);
+    lv_display_set_color_format(overlay_disp, LV_COLOR_FORMAT_ARGB8888);
+
+    size_t buf_size = LV_MIN(drm_dev->drm_bufs[1].size, drm_dev->drm_bufs[0].size);
+    lv_display_set_buffers(overlay_disp, drm_dev->drm_bufs[1].map, drm_dev->drm_bufs[0].map, buf_size,
+                           LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_add_event_cb(overlay_disp, drm_dmabuf_set_active_buf, LV_EVENT_REFR_START, drm_dev);
+    lv_display_add_event_cb(overlay_disp, drm_overlay_delete_event_cb, LV_EVENT_DELETE, drm_dev);
+    lv_display_set_dpi(overlay_disp, lv_display_get_dpi(disp));
+
+    /* Where there are no widgets the primary plane should be visible */
+    lv_obj_set_style_bg_opa(lv_display_get_screen_active(overlay_disp), LV_OPA_TRANSP, 0);
+
+    parent->overlay = drm_dev;
+
+    LV_LOG_INFO("drm: Found overlay plane_id: %u", drm_dev->plane_id);
+
+    return overlay_disp;
+
+free_bufs:
+    drm_free_buffers(drm_dev);
+    drm_free_plane_props(drm_dev);
+free_plane:
+    drmModeFreePlane(drm_dev->plane);
+free_dev:
+    lv_free(drm_dev);
+
+    return NULL;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -275,6 +376,9 @@ static uint32_t get_crtc_property_id(drm_dev_t * drm_dev, const char * name)
 {
     uint32_t i;
 
+    /* An overlay plane commits to the CRTC and the connector of the primary plane */
+    if(drm_dev->parent) drm_dev = drm_dev->parent;
+
     LV_LOG_TRACE("Find crtc property: %s", name);
 
     for(i = 0; i < drm_dev->count_crtc_props; ++i)
@@ -290,6 +394,9 @@ static uint32_t get_conn_property_id(drm_dev_t * drm_dev, const char * name)
 {
     uint32_t i;
 
+    /* An overlay plane commits to the CRTC and the connector of the primary plane */
+    if(drm_dev->parent) drm_dev = drm_dev->parent;
+
     LV_LOG_TRACE("Find conn property: %s", name);
 
     for(i = 0; i < drm_dev->count_conn_props; ++i)
@@ -439,8 +546,12 @@ static int drm_add_conn_property(drm_dev_t * drm_dev, const char * name, uint64_
 static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
 {
     int ret;
-    static int first = 1;
     uint32_t flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
+    drm_dev_t * main_dev = drm_dev->parent ? drm_dev->parent : drm_dev;
+
+    /* Only one non-blocking commit can be pending on a CRTC */
+    if(drm_dev->parent) drm_wait_for_flip(drm_dev->parent);
+    else if(drm_dev->overlay) drm_wait_for_flip(drm_dev->overlay);
 
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
 
@@ -456,7 +567,7 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     drm_dev->req = drmModeAtomicAlloc();
 
     /* On first Atomic commit, do a modeset */
-    if(first) {
+    if(!main_dev->crtc_active) {
         drm_add_conn_property(drm_dev, "CRTC_ID", drm_dev->crtc_id);
 
         drm_add_crtc_property(drm_dev, "MODE_ID", drm_dev->blob_id);
@@ -464,7 +575,7 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
 
         flags |= DRM_MODE_ATOMIC_ALLOW_MODESET;
 
-        first = 0;
+        main_dev->crtc_active = true;
     }
 
     drm_add_plane_property(drm_dev, "FB_ID", buf->fb_handle);
@@ -478,18 +589,49 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     drm_add_plane_property(drm_dev, "CRTC_W", drm_dev->width);
     drm_add_plane_property(drm_dev, "CRTC_H", drm_dev->height);
 
+    /* Tell the driver which parts of the buffer have changed since the previous commit,
+     * so e.g. a display with its own frame memory needs to receive only those parts.
+     * The buffers are kept in sync by LVGL so the changed parts are the refreshed areas.
+     * Without the property (or if the driver rejects it) the whole frame is committed.
+     * NOTE: this path is not yet tested on real hardware or vkms. */
+    uint32_t damage_blob_id = 0;
+    int cursor = drmModeAtomicGetCursor(drm_dev->req);
+    if(drm_dev->plane_active && drm_dev->damage_cnt > 0 && !drm_dev->damage_unsupported &&
+       get_plane_property_id(drm_dev, "FB_DAMAGE_CLIPS")) {
+        ret = drmModeCreatePropertyBlob(drm_dev->fd, drm_dev->damage,
+                                        sizeof(drm_dev->damage[0]) * drm_dev->damage_cnt, &damage_blob_id);
+        if(ret == 0) drm_add_plane_property(drm_dev, "FB_DAMAGE_CLIPS", damage_blob_id);
+        else damage_blob_id = 0;
+    }
+    drm_dev->damage_cnt = 0;
+
     ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, flags, drm_dev);
+
+    if(ret && damage_blob_id) {
+        LV_LOG_WARN("Commit with FB_DAMAGE_CLIPS failed: %s (%d), committing full frames from now",
+                    strerror(errno), errno);
+        drm_dev->damage_unsupported = true;
+        drmModeAtomicSetCursor(drm_dev->req, cursor);
+        ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, flags, drm_dev);
+    }
+
+    /* The commit keeps its own reference to the blob */
+    if(damage_blob_id) drmModeDestroyPropertyBlob(drm_dev->fd, damage_blob_id);
+
     if(ret) {
         LV_LOG_ERROR("drmModeAtomicCommit failed: %s (%d)", strerror(errno), errno);
         drmModeAtomicFree(drm_dev->req);
+        drm_dev->req = NULL;
         return ret;
     }
 
+    drm_dev->plane_active = true;
+
     return 0;
 }
 
 static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane_id, uint32_t crtc_id,
-                      uint32_t crtc_idx)
+                      uint32_t crtc_idx, bool overlay)
 {
     LV_UNUSED(crtc_id);
     drmModePlaneResPtr planes;
@@ -529,6 +671,11 @@ static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane
             continue;
         }
 
+        if(overlay && (plane->plane_id == drm_dev->parent->plane_id || !is_overlay_plane(drm_dev, plane->plane_id))) {
+            drmModeFreePlane(plane);
+            continue;
+        }
+
         *plane_id = plane->plane_id;
         drmModeFreePlane(plane);
 
@@ -545,6 +692,30 @@ static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane
     return ret;
 }
 
+static bool is_overlay_plane(drm_dev_t * drm_dev, uint32_t plane_id)
+{
+    drmModeObjectPropertiesPtr props = drmModeObjectGetProperties(drm_dev->fd, plane_id, DRM_MODE_OBJECT_PLANE);
+    if(!props) return false;
+
+    bool overlay = false;
+    uint32_t i;
+    for(i = 0; i < props->count_props; i++) {
+        drmModePropertyPtr prop = drmModeGetProperty(drm_dev->fd, props->props[i]);
+        if(!prop) continue;
+
+        bool is_type = lv_strcmp(prop->name, "type") == 0;
+        drmModeFreeProperty(prop);
+        if(is_type) {
+            overlay = props->prop_values[i] == DRM_PLANE_TYPE_OVERLAY;
+            break;
+        }
+    }
+
+    drmModeFreeObjectProperties(props);
+
+    return overlay;
+}
+
 static int drm_find_connector(drm_dev_t * drm_dev, int64_t connector_id)
 {
     drmModeConnector * conn = NULL;
@@ -753,7 +924,7 @@ static int drm_setup(drm_dev_t * drm_dev, const char * device_path, int64_t conn
         goto err;
     }
 
-    ret = find_plane(drm_dev, fourcc, &drm_dev->plane_id, drm_dev->crtc_id, drm_dev->crtc_idx);
+    ret = find_plane(drm_dev, fourcc, &drm_dev->plane_id, drm_dev->crtc_id, drm_dev->crtc_idx, false);
     if(ret) {
         LV_LOG_ERROR("Cannot find plane");
         goto err;
@@ -839,7 +1010,7 @@ static int drm_allocate_dumb(drm_dev_t * drm_dev, drm_buffer_t * buf)
     lv_memzero(&creq, sizeof(creq));
     creq.width = drm_dev->width;
     creq.height = drm_dev->height;
-    creq.bpp = LV_COLOR_DEPTH;
+    creq.bpp = drm_dev->fourcc == DRM_FORMAT_RGB565 ? 16 : 32;
     ret = drmIoctl(drm_dev->fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq);
     if(ret < 0) {
         LV_LOG_ERROR("DRM_IOCTL_MODE_CREATE_DUMB fail");
@@ -900,14 +1071,14 @@ static int create_gbm_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf)
     int res;
 
     /* gbm_bo_format does not define anything other than ARGB8888 or XRGB8888 */
-    if(LV_COLOR_DEPTH != 32) {
+    if(drm_dev->fourcc != DRM_FORMAT_XRGB8888 && drm_dev->fourcc != DRM_FORMAT_ARGB8888) {
         LV_LOG_ERROR("Unsupported color format");
         return -1;
     }
 
     /* Create a linear GBM buffer object - best practice when modifiers are not used */
     if(!(gbm_bo = gbm_bo_create(gbm_device,
-                                drm_dev->width, drm_dev->height, GBM_BO_FORMAT_XRGB8888,
+                                drm_dev->width, drm_dev->height, drm_dev->fourcc,
                                 GBM_BO_USE_SCANOUT | GBM_BO_USE_LINEAR))) {
 
         LV_LOG_ERROR("Unable to create gbm buffer object");
@@ -1010,10 +1181,80 @@ static int drm_setup_buffers(drm_dev_t * drm_dev)
     return 0;
 }
 
-static void drm_flush_wait(lv_display_t * disp)
+static void drm_free_buffers(drm_dev_t * drm_dev)
 {
-    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    int i;
+
+    for(i = 0; i < BUFFER_CNT; i++) {
+        drm_buffer_t * buf = &drm_dev->drm_bufs[i];
+
+        if(buf->fb_handle) drmModeRmFB(drm_dev->fd, buf->fb_handle);
+        if(buf->map && buf->map != MAP_FAILED) munmap(buf->map, buf->size);
+
+#if LV_USE_LINUX_DRM_GBM_BUFFERS
+        /* The handle is the prime fd of the buffer object */
+        if(buf->handle) close(buf->handle);
+#else
+        if(buf->handle) {
+            struct drm_mode_destroy_dumb dreq;
+            lv_memzero(&dreq, sizeof(dreq));
+            dreq.handle = buf->handle;
+            drmIoctl(drm_dev->fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+        }
+#endif
+
+        lv_memzero(buf, sizeof(drm_buffer_t));
+    }
+}
+
+static void drm_free_plane_props(drm_dev_t * drm_dev)
+{
+    uint32_t i;
+
+    for(i = 0; i < drm_dev->count_plane_props; i++) {
+        drmModeFreeProperty(drm_dev->plane_props[i]);
+        drm_dev->plane_props[i] = NULL;
+    }
 
+    drm_dev->count_plane_props = 0;
+}
+
+/* Free the overlay plane's resources when its display is deleted.
+ * The device, the connector and the CRTC are freed with the primary plane. */
+static void drm_overlay_delete_event_cb(lv_event_t * event)
+{
+    drm_dev_t * drm_dev = lv_event_get_user_data(event);
+    lv_display_t * disp = lv_event_get_current_target(event);
+
+    /* Don't free the buffers while the display controller might still read them.
+     * Only one commit can be pending on the CRTC so wait for the primary plane too. */
+    drm_wait_for_flip(drm_dev);
+    drm_wait_for_flip(drm_dev->parent);
+
+    /* Disable the plane, so that only the primary plane is visible */
+    if(drm_dev->plane_active) {
+        drmModeAtomicReqPtr req = drmModeAtomicAlloc();
+        if(req) {
+            drmModeAtomicAddProperty(req, drm_dev->plane_id, get_plane_property_id(drm_dev, "FB_ID"), 0);
+            drmModeAtomicAddProperty(req, drm_dev->plane_id, get_plane_property_id(drm_dev, "CRTC_ID"), 0);
+            if(drmModeAtomicCommit(drm_dev->fd, req, 0, NULL)) {
+                LV_LOG_WARN("Cannot disable the overlay plane: %s (%d)", strerror(errno), errno);
+            }
+            drmModeAtomicFree(req);
+        }
+    }
+
+    drm_free_buffers(drm_dev);
+    drm_free_plane_props(drm_dev);
+    drmModeFreePlane(drm_dev->plane);
+
+    drm_dev->parent->overlay = NULL;
+    lv_display_set_driver_data(disp, NULL);
+    lv_free(drm_dev);
+}
+
+static void drm_wait_for_flip(drm_dev_t * drm_dev)
+{
     struct pollfd pfd;
     pfd.fd = drm_dev->fd;
     pfd.events = POLLIN;
@@ -1033,15 +1274,41 @@ static void drm_flush_wait(lv_display_t * disp)
     }
 }
 
-static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+static void drm_flush_wait(lv_display_t * disp)
 {
+    drm_wait_for_flip(lv_display_get_driver_data(disp));
+}
 
-    if(!lv_display_flush_is_last(disp)) return;
+static void drm_add_damage(drm_dev_t * drm_dev, const lv_area_t * area)
+{
+    struct drm_mode_rect * clip;
+    if(drm_dev->damage_cnt < DAMAGE_CLIP_CNT) {
+        clip = &drm_dev->damage[drm_dev->damage_cnt];
+        drm_dev->damage_cnt++;
+        clip->x1 = area->x1;
+        clip->y1 = area->y1;
+        clip->x2 = area->x2 + 1;
+        clip->y2 = area->y2 + 1;
+    }
+    else {
+        /* Too many areas, extend the last one to cover the new area too */
+        clip = &drm_dev->damage[DAMAGE_CLIP_CNT - 1];
+        clip->x1 = LV_MIN(clip->x1, area->x1);
+        clip->y1 = LV_MIN(clip->y1, area->y1);
+        clip->x2 = LV_MAX(clip->x2, area->x2 + 1);
+        clip->y2 = LV_MAX(clip->y2, area->y2 + 1);
+    }
+}
 
-    LV_UNUSED(area);
+static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
     LV_UNUSED(px_map);
     drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
 
+    drm_add_damage(drm_dev, area);
+
+    if(!lv_display_flush_is_last(disp)) return;
+
     LV_ASSERT(drm_dev->act_buf != NULL);
 
     if(drm_dmabuf_set_plane(drm_dev, drm_dev->act_buf)) {
@@ -33,6 +33,17 @@ lv_display_t * lv_linux_drm_create(void);
 
 void lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_t connector_id);
 
+/**
+ * Create a display on an overlay plane of the CRTC used by `disp`.
+ * The overlay is composited over `disp` by the display controller, so widgets which change often
+ * (e.g. a cursor, a video or a notification) can be updated without redrawing or rescanning `disp`.
+ * Its screen is transparent by default and it's rendered in ARGB8888 format.
+ * Delete it with `lv_display_delete` before deleting `disp` to free the overlay plane.
+ * @param disp  a display created by `lv_linux_drm_create` and set up by `lv_linux_drm_set_file`
+ * @return      the new display or NULL if there is no free overlay plane supporting ARGB8888
+ */
+lv_display_t * lv_linux_drm_create_overlay(lv_display_t * disp);
+
 /**********************
  *      MACROS
  **********************/
@@ -14,6 +14,7 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <fcntl.h>
+#include <errno.h>
 #include <sys/mman.h>
 #include <sys/ioctl.h>
 #include <time.h>
@@ -33,6 +34,9 @@
  *      DEFINES
  *********************/
 
+/*Render directly into two pages of the mmap'd framebuffer and flip between them with `FBIOPAN_DISPLAY`*/
+#define LV_LINUX_FBDEV_PAGE_FLIP (LV_LINUX_FBDEV_MMAP && !LV_LINUX_FBDEV_BSD && LV_LINUX_FBDEV_BUFFER_COUNT == 2)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -61,6 +65,10 @@ typedef struct {
 #endif /* LV_LINUX_FBDEV_BSD */
 #if LV_LINUX_FBDEV_MMAP
     char * fbp;
+#endif
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    lv_draw_buf_t pages[2];
+    bool page_flip;
 #endif
     uint8_t * rotated_buf;
     size_t rotated_buf_size;
@@ -74,6 +82,10 @@ typedef struct {
  **********************/
 
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p);
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    static bool page_flip_init(lv_linux_fb_t * dsc);
+    static void page_flip_flush(lv_display_t * disp, lv_linux_fb_t * dsc);
+#endif
 static uint32_t tick_get_cb(void);
 
 /**********************
@@ -181,6 +193,11 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
 
     LV_LOG_INFO("%dx%d, %dbpp", dsc->vinfo.xres, dsc->vinfo.yres, dsc->vinfo.bits_per_pixel);
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    /* Needs to be checked before mapping as it might change the size of the framebuffer*/
+    dsc->page_flip = page_flip_init(dsc);
+#endif
+
     /* Figure out the size of the screen in bytes*/
     dsc->screensize =  dsc->finfo.smem_len;/*finfo.line_length * vinfo.yres;*/
 
@@ -224,16 +241,37 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
         draw_buf_size *= ver_res;
     }
 
-    uint8_t * draw_buf = NULL;
-    uint8_t * draw_buf_2 = NULL;
-    draw_buf = malloc(draw_buf_size);
+    lv_display_set_resolution(disp, hor_res, ver_res);
 
-    if(LV_LINUX_FBDEV_BUFFER_COUNT == 2) {
-        draw_buf_2 = malloc(draw_buf_size);
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    if(dsc->page_flip) {
+        /* The pages of the framebuffer are the draw buffers, so nothing needs to be copied in flush_cb*/
+        lv_color_format_t cf = lv_display_get_color_format(disp);
+        uint32_t page_size = dsc->finfo.line_length * ver_res;
+        lv_draw_buf_init(&dsc->pages[0], hor_res, ver_res, cf, dsc->finfo.line_length, dsc->fbp, page_size);
+        lv_draw_buf_init(&dsc->pages[1], hor_res, ver_res, cf, dsc->finfo.line_length, dsc->fbp + page_size, page_size);
+        lv_display_set_draw_buffers(disp, &dsc->pages[0], &dsc->pages[1]);
+        lv_display_set_render_mode(disp, LV_LINUX_FBDEV_RENDER_MODE);
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        /* The pages are shown as they are, so rotate while rendering*/
+        lv_display_set_matrix_rotation(disp, true);
+#endif
+        LV_LOG_INFO("Rendering directly into the framebuffer with page flipping");
     }
+    else
+#endif
+    {
+        uint8_t * draw_buf = NULL;
+        uint8_t * draw_buf_2 = NULL;
+        draw_buf = malloc(draw_buf_size);
 
-    lv_display_set_resolution(disp, hor_res, ver_res);
-    lv_display_set_buffers(disp, draw_buf, draw_buf_2, draw_buf_size, LV_LINUX_FBDEV_RENDER_MODE);
+        if(LV_LINUX_FBDEV_BUFFER_COUNT == 2) {
+            draw_buf_2 = malloc(draw_buf_size);
+        }
+
+        lv_display_set_buffers(disp, draw_buf, draw_buf_2, draw_buf_size, LV_LINUX_FBDEV_RENDER_MODE);
+    }
 
     if(width > 0) {
         lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 254, width * 10));
@@ -253,15 +291,30 @@ void lv_linux_fbdev_set_force_refresh(lv_display_t * disp, bool enabled)
  *   STATIC FUNCTIONS
  **********************/
 
-static void write_to_fb(lv_linux_fb_t * dsc, uint32_t fb_pos, const void * data, size_t sz)
+/**
+ * Write rows of pixels to the framebuffer.
+ * If the rows are contiguous both in the source and in the framebuffer, they are written at once.
+ */
+static void write_to_fb(lv_linux_fb_t * dsc, uint32_t fb_pos, const uint8_t * data, uint32_t data_stride,
+                        size_t row_size, int32_t row_cnt)
 {
+    if(data_stride == row_size && dsc->finfo.line_length == row_size) {
+        row_size *= row_cnt;
+        row_cnt = 1;
+    }
+
+    int32_t y;
+    for(y = 0; y < row_cnt; y++) {
 #if LV_LINUX_FBDEV_MMAP
-    uint8_t * fbp = (uint8_t *)dsc->fbp;
-    lv_memcpy(&fbp[fb_pos], data, sz);
+        uint8_t * fbp = (uint8_t *)dsc->fbp;
+        lv_memcpy(&fbp[fb_pos], data, row_size);
 #else
-    if(pwrite(dsc->fbfd, data, sz, fb_pos) < 0)
-        LV_LOG_ERROR("write failed: %d", errno);
+        if(pwrite(dsc->fbfd, data, row_size, fb_pos) < 0)
+            LV_LOG_ERROR("write failed: %d", errno);
 #endif
+        fb_pos += dsc->finfo.line_length;
+        data += data_stride;
+    }
 }
 
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
@@ -275,6 +328,13 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     }
 #endif
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    if(dsc->page_flip) {
+        page_flip_flush(disp, dsc);
+        return;
+    }
+#endif
+
     int32_t w = lv_area_get_width(area);
     int32_t h = lv_area_get_height(area);
     lv_color_format_t cf = lv_display_get_color_format(disp);
@@ -282,9 +342,24 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
 
     lv_area_t rotated_area;
     lv_display_rotation_t rotation = lv_display_get_rotation(disp);
+    uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
 
     /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here */
     if(rotation != LV_DISPLAY_ROTATION_0 && LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        rotated_area = *area;
+        lv_display_rotate_area(disp, &rotated_area);
+
+#if LV_LINUX_FBDEV_MMAP
+        /* Rotate straight into the framebuffer*/
+        if(rotated_area.x1 >= 0 && rotated_area.y1 >= 0 &&
+           rotated_area.x2 < (int32_t)dsc->vinfo.xres && rotated_area.y2 < (int32_t)dsc->vinfo.yres) {
+            uint32_t fb_pos =
+                (rotated_area.x1 + dsc->vinfo.xoffset) * px_size +
+                (rotated_area.y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
+            lv_draw_sw_rotate(color_p, &dsc->fbp[fb_pos], w, h, w_stride, dsc->finfo.line_length, rotation, cf);
+        }
+        area = NULL;
+#else
         /* (Re)allocate temporary buffer if needed */
         size_t buf_size = w * h * px_size;
         if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
@@ -293,7 +368,6 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         }
 
         /* Rotate the pixel buffer */
-        uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
         uint32_t h_stride = lv_draw_buf_width_to_stride(h, cf);
 
         switch(rotation) {
@@ -310,46 +384,29 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
                 break;
         }
         color_p = dsc->rotated_buf;
-
-        /* Rotate the area */
-        rotated_area = *area;
-        lv_display_rotate_area(disp, &rotated_area);
         area = &rotated_area;
-
-        if(rotation != LV_DISPLAY_ROTATION_180) {
-            w = lv_area_get_width(area);
-            h = lv_area_get_height(area);
-        }
+#endif
     }
 
     /* Ensure that we're within the framebuffer's bounds */
-    if(area->x2 < 0 || area->y2 < 0 || area->x1 > (int32_t)dsc->vinfo.xres - 1 || area->y1 > (int32_t)dsc->vinfo.yres - 1) {
-        lv_display_flush_ready(disp);
-        return;
-    }
+    if(area && area->x2 >= 0 && area->y2 >= 0 &&
+       area->x1 <= (int32_t)dsc->vinfo.xres - 1 && area->y1 <= (int32_t)dsc->vinfo.yres - 1) {
+        w = lv_area_get_width(area);
+        h = lv_area_get_height(area);
 
-    uint32_t fb_pos =
-        (area->x1 + dsc->vinfo.xoffset) * px_size +
-        (area->y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
+        uint32_t fb_pos =
+            (area->x1 + dsc->vinfo.xoffset) * px_size +
+            (area->y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
 
-    int32_t y;
-    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        uint32_t color_pos =
-            area->x1 * px_size +
-            area->y1 * disp->hor_res * px_size;
-
-        for(y = area->y1; y <= area->y2; y++) {
-            write_to_fb(dsc, fb_pos, &color_p[color_pos], w * px_size);
-            fb_pos += dsc->finfo.line_length;
-            color_pos += disp->hor_res * px_size;
+        if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
+            uint32_t color_pos =
+                area->x1 * px_size +
+                area->y1 * disp->hor_res * px_size;
+
+            write_to_fb(dsc, fb_pos, &color_p[color_pos], disp->hor_res * px_size, w * px_size, h);
         }
-    }
-    else {
-        w = lv_area_get_width(area);
-        for(y = area->y1; y <= area->y2; y++) {
-            write_to_fb(dsc, fb_pos, color_p, w * px_size);
-            fb_pos += dsc->finfo.line_length;
-            color_p += w * px_size;
+        else {
+            write_to_fb(dsc, fb_pos, color_p, w * px_size, w * px_size, h);
         }
     }
 
@@ -363,6 +420,68 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     lv_display_flush_ready(disp);
 }
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+
+/**
+ * Make the virtual resolution of the framebuffer at least twice as high as the screen
+ * so that the off-screen page can be rendered while the other one is shown.
+ * @param dsc   the driver data with the queried screen info
+ * @return      true: page flipping can be used
+ */
+static bool page_flip_init(lv_linux_fb_t * dsc)
+{
+    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) return false;
+
+    if(dsc->vinfo.yres_virtual < dsc->vinfo.yres * 2) {
+        struct fb_var_screeninfo vinfo = dsc->vinfo;
+        vinfo.yres_virtual = vinfo.yres * 2;
+        vinfo.xoffset = 0;
+        vinfo.yoffset = 0;
+        if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &vinfo) == -1) {
+            LV_LOG_WARN("The virtual resolution can't be increased, page flipping is not used");
+            return false;
+        }
+
+        /* The driver might have adjusted the other parameters too*/
+        if(ioctl(dsc->fbfd, FBIOGET_VSCREENINFO, &dsc->vinfo) == -1 ||
+           ioctl(dsc->fbfd, FBIOGET_FSCREENINFO, &dsc->finfo) == -1) {
+            perror("Error reading screen information");
+            return false;
+        }
+    }
+
+    if(dsc->vinfo.yres_virtual < dsc->vinfo.yres * 2 ||
+       dsc->finfo.smem_len < dsc->finfo.line_length * dsc->vinfo.yres * 2) {
+        LV_LOG_WARN("The framebuffer is too small for 2 pages, page flipping is not used");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Show the page which was just rendered.
+ * @param disp  pointer to a display
+ * @param dsc   the driver data of the display
+ */
+static void page_flip_flush(lv_display_t * disp, lv_linux_fb_t * dsc)
+{
+    /* The page can be shown only when all of its areas are rendered*/
+    if(lv_display_flush_is_last(disp)) {
+        dsc->vinfo.xoffset = 0;
+        dsc->vinfo.yoffset = disp->buf_act == disp->buf_2 ? dsc->vinfo.yres : 0;
+
+        /* Most drivers wait for the vertical blank here, so the flip doesn't tear*/
+        if(ioctl(dsc->fbfd, FBIOPAN_DISPLAY, &dsc->vinfo) == -1) {
+            perror("ioctl(FBIOPAN_DISPLAY)");
+        }
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+#endif /*LV_LINUX_FBDEV_PAGE_FLIP*/
+
 static uint32_t tick_get_cb(void)
 {
     struct timespec t;
@@ -712,6 +712,7 @@ bool lv_windows_keypad_device_window_message_handler(
                     if(textarea_object) {
                         lv_textarea_t * textarea = (lv_textarea_t *)(textarea_object);
                         lv_obj_t * label_object = lv_textarea_get_label(textarea_object);
+                        lv_obj_sync_coords(label_object);
 
                         composition_form.ptCurrentPos.x =
                             label_object->coords.x1 + textarea->cursor.area.x1;
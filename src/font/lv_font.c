@@ -12,6 +12,7 @@
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_assert.h"
+#include "../misc/cache/lv_cache.h"
 #include "../stdlib/lv_string.h"
 
 /*********************
@@ -89,6 +90,11 @@ void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc)
     if(font != NULL && font->release_glyph) {
         font->release_glyph(font, g_dsc);
     }
+    else {
+        /*E.g. the built-in fonts have no release callback but can return cached glyphs*/
+        lv_cache_release((lv_cache_t *)lv_cache_entry_get_cache(g_dsc->entry), g_dsc->entry, NULL);
+        g_dsc->entry = NULL;
+    }
 }
 
 bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
@@ -13,7 +13,10 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache_private.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../draw/lv_draw_buf.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +25,39 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#define fmt_txt_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_cache
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+
+#define CACHE_NAME "FONT_FMT_TXT_GLYPH"
+
+/*The glyph index cache is shared by the render threads without locking. Each entry is
+ *guarded by a sequence number (seqlock) and the statistics are counted atomically.
+ *Without atomic operations the cache is protected by the lock.*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define GID_LOCK()                  do {} while(0)
+    #define GID_UNLOCK()                do {} while(0)
+    #define GID_LOAD(p)                 __atomic_load_n((p), __ATOMIC_RELAXED)
+    #define GID_LOAD_ACQUIRE(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define GID_STORE(p, v)             __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+    #define GID_STORE_RELEASE(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define GID_CLAIM(p, old)           __atomic_compare_exchange_n((p), &(old), (old) + 1, false, \
+                                                                    __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+    #define GID_FENCE_ACQUIRE()         __atomic_thread_fence(__ATOMIC_ACQUIRE)
+    #define GID_FENCE_RELEASE()         __atomic_thread_fence(__ATOMIC_RELEASE)
+    #define GID_STAT_INC(p)             __atomic_fetch_add((p), 1, __ATOMIC_RELAXED)
+#else
+    #define GID_LOCK()                  lv_mutex_lock(&fmt_txt_cache.lock)
+    #define GID_UNLOCK()                lv_mutex_unlock(&fmt_txt_cache.lock)
+    #define GID_LOAD(p)                 (*(p))
+    #define GID_LOAD_ACQUIRE(p)         (*(p))
+    #define GID_STORE(p, v)             (*(p) = (v))
+    #define GID_STORE_RELEASE(p, v)     (*(p) = (v))
+    #define GID_CLAIM(p, old)           (*(p) == (old) ? (*(p) = (old) + 1, true) : false)
+    #define GID_FENCE_ACQUIRE()
+    #define GID_FENCE_RELEASE()
+    #define GID_STAT_INC(p)             ((*(p))++)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,11 +66,29 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+    lv_draw_buf_t * draw_buf;
+} glyph_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static const void * unpack_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                  uint16_t stride_in, lv_draw_buf_t * draw_buf);
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+#if LV_FONT_FMT_TXT_GID_CACHE_CNT
+static bool gid_cache_read(lv_font_fmt_txt_gid_cache_entry_t * entry, const lv_font_fmt_txt_dsc_t * fdsc,
+                           uint32_t letter, uint32_t * gid);
+static bool gid_cache_write(lv_font_fmt_txt_gid_cache_entry_t * entry, const lv_font_fmt_txt_dsc_t * fdsc,
+                            uint32_t letter, uint32_t gid);
+#endif
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
@@ -47,6 +101,13 @@ static int kern_pair_16_compare(const void * ref, const void * element);
     static inline uint8_t rle_next(void);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    static const void * get_cached_bitmap(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+#endif
+
 static lv_font_t * builtin_font_create_cb(const lv_font_info_t * info, const void * src);
 static void builtin_font_delete_cb(lv_font_t * font);
 static void * builtin_font_dup_src_cb(const void * src);
@@ -99,11 +160,159 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 
     if(g_dsc->req_raw_bitmap) return &fdsc->glyph_bitmap[gdsc->bitmap_index];
 
-    uint8_t * bitmap_out = draw_buf->data;
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    uint16_t stride_in = g_dsc->stride;
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    const void * bitmap = get_cached_bitmap(g_dsc, fdsc, gid);
+    if(bitmap) return bitmap;
+#endif
+
+    /*Not cached, unpack it to the provided draw buffer*/
+    return unpack_bitmap(fdsc, gdsc, g_dsc->stride, draw_buf);
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+
+    if(fdsc->stride == 0) dsc_out->stride = 0;
+    else {
+        /*e.g. font_dsc stride ==  4 means align to 4 byte boundary.
+         *In glyph_dsc store the actual line length in bytes*/
+        dsc_out->stride = LV_ROUND_UP(dsc_out->box_w, fdsc->stride);
+    }
+
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+void lv_font_fmt_txt_cache_init(void)
+{
+    lv_mutex_init(&fmt_txt_cache.lock);
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    fmt_txt_cache.glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(glyph_cache_data_t),
+    LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb,
+    });
+    lv_cache_set_name(fmt_txt_cache.glyph_cache, CACHE_NAME);
+#endif
+}
+
+void lv_font_fmt_txt_cache_deinit(void)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    if(fmt_txt_cache.glyph_cache) {
+        lv_cache_destroy(fmt_txt_cache.glyph_cache, NULL);
+        fmt_txt_cache.glyph_cache = NULL;
+    }
+#endif
+
+    lv_mutex_delete(&fmt_txt_cache.lock);
+}
+
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font)
+{
+#if LV_FONT_FMT_TXT_GID_CACHE_CNT
+    uint32_t i;
+    GID_LOCK();
+    for(i = 0; i < LV_FONT_FMT_TXT_GID_CACHE_CNT; i++) {
+        lv_font_fmt_txt_gid_cache_entry_t * entry = &fmt_txt_cache.gid_cache[i];
+        if(font == NULL || GID_LOAD(&entry->fdsc) == font->dsc) {
+            /*Another thread might be writing the entry right now, so retry until it's cleared*/
+            while(!gid_cache_write(entry, NULL, 0, 0)) {}
+        }
+    }
+    GID_UNLOCK();
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    /*The entries are ordered by font, but it's rare enough to simply drop all*/
+    if(fmt_txt_cache.glyph_cache) lv_cache_drop_all(fmt_txt_cache.glyph_cache, NULL);
+#endif
+
+    LV_UNUSED(font);
+}
+
+void lv_font_fmt_txt_cache_get_stat(lv_font_fmt_txt_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    lv_mutex_lock(&fmt_txt_cache.lock);
+    stat->glyph_hit_cnt = fmt_txt_cache.stat.glyph_hit_cnt;
+    stat->glyph_miss_cnt = fmt_txt_cache.stat.glyph_miss_cnt;
+    stat->gid_hit_cnt = GID_LOAD(&fmt_txt_cache.stat.gid_hit_cnt);
+    stat->gid_miss_cnt = GID_LOAD(&fmt_txt_cache.stat.gid_miss_cnt);
+    lv_mutex_unlock(&fmt_txt_cache.lock);
+}
+
+void lv_font_fmt_txt_cache_reset_stat(void)
+{
+    lv_mutex_lock(&fmt_txt_cache.lock);
+    fmt_txt_cache.stat.glyph_hit_cnt = 0;
+    fmt_txt_cache.stat.glyph_miss_cnt = 0;
+    GID_STORE(&fmt_txt_cache.stat.gid_hit_cnt, 0);
+    GID_STORE(&fmt_txt_cache.stat.gid_miss_cnt, 0);
+    lv_mutex_unlock(&fmt_txt_cache.lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Unpack the bitmap of a glyph to A8 format
+ * @param fdsc          descriptor of the font
+ * @param gdsc          descriptor of the glyph
+ * @param stride_in     the line length of the glyph's bitmap in bytes, 0: no padding
+ * @param draw_buf      draw buffer to store the result
+ * @return              `draw_buf` or NULL on error
+ */
+static const void * unpack_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                  uint16_t stride_in, lv_draw_buf_t * draw_buf)
+{
+    uint8_t * bitmap_out = draw_buf->data;
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
@@ -218,69 +427,157 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+/**
+ * Get the unpacked bitmap of a glyph from the cache, add it to the cache if not there yet.
+ * @param g_dsc     the glyph descriptor. Its `entry` will be set
+ * @param fdsc      descriptor of the font
+ * @param gid       index of the glyph
+ * @return          a draw buffer with the A8 bitmap, or NULL if it couldn't be cached
+ */
+static const void * get_cached_bitmap(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
-    }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
+    if(fmt_txt_cache.glyph_cache == NULL) return NULL;
 
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    glyph_cache_data_t search_key = {
+        .slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h,
+        .fdsc = fdsc,
+        .gid = gid,
+    };
+
+    bool created = false;
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(fmt_txt_cache.glyph_cache, &search_key, &created);
+    if(entry == NULL) return NULL;
+
+    lv_mutex_lock(&fmt_txt_cache.lock);
+    if(created) fmt_txt_cache.stat.glyph_miss_cnt++;
+    else fmt_txt_cache.stat.glyph_hit_cnt++;
+    lv_mutex_unlock(&fmt_txt_cache.lock);
+
+    g_dsc->entry = entry;
+    glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = data->fdsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[data->gid];
+
+    data->draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h, LV_COLOR_FORMAT_A8,
+                                           LV_STRIDE_AUTO);
+    if(data->draw_buf == NULL) return false;
+
+    uint16_t stride_in = fdsc->stride == 0 ? 0 : LV_ROUND_UP(gdsc->box_w, fdsc->stride);
+    if(unpack_bitmap(fdsc, gdsc, stride_in, data->draw_buf) == NULL) {
+        lv_draw_buf_destroy(data->draw_buf);
+        data->draw_buf = NULL;
+        return false;
     }
 
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    bool * created = user_data;
+    *created = true;
+    return true;
+}
 
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy(data->draw_buf);
+}
 
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    if(lhs->gid != rhs->gid) return lhs->gid > rhs->gid ? 1 : -1;
+    return 0;
+}
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    if(letter == '\0') return 0;
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
 
-    if(fdsc->stride == 0) dsc_out->stride = 0;
-    else {
-        /*e.g. font_dsc stride ==  4 means align to 4 byte boundary.
-         *In glyph_dsc store the actual line length in bytes*/
-        dsc_out->stride = LV_ROUND_UP(dsc_out->box_w, fdsc->stride);
+#if LV_FONT_FMT_TXT_GID_CACHE_CNT
+    uint32_t idx = (letter + (uint32_t)((lv_uintptr_t)fdsc >> 3) * 31) % LV_FONT_FMT_TXT_GID_CACHE_CNT;
+    lv_font_fmt_txt_gid_cache_entry_t * entry = &fmt_txt_cache.gid_cache[idx];
+
+    uint32_t gid;
+    GID_LOCK();
+    if(gid_cache_read(entry, fdsc, letter, &gid)) {
+        GID_STAT_INC(&fmt_txt_cache.stat.gid_hit_cnt);
+        GID_UNLOCK();
+        return gid;
     }
+    GID_STAT_INC(&fmt_txt_cache.stat.gid_miss_cnt);
+    GID_UNLOCK();
 
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
+    gid = search_glyph_dsc_id(fdsc, letter);
 
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+    /*If another thread is writing the entry just don't cache this letter*/
+    GID_LOCK();
+    gid_cache_write(entry, fdsc, letter, gid);
+    GID_UNLOCK();
 
-    return true;
+    return gid;
+#else
+    return search_glyph_dsc_id(fdsc, letter);
+#endif
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+#if LV_FONT_FMT_TXT_GID_CACHE_CNT
+/**
+ * Read an entry of the glyph index cache without locking
+ * @param entry     pointer to a cache entry
+ * @param fdsc      the font to look for
+ * @param letter    the letter to look for
+ * @param gid       store the glyph index here on hit
+ * @return          true: hit; false: miss or the entry is being written by another thread
+ */
+static bool gid_cache_read(lv_font_fmt_txt_gid_cache_entry_t * entry, const lv_font_fmt_txt_dsc_t * fdsc,
+                           uint32_t letter, uint32_t * gid)
 {
-    if(letter == '\0') return 0;
+    uint32_t seq = GID_LOAD_ACQUIRE(&entry->seq);
+    if(seq & 1) return false;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    bool found = GID_LOAD(&entry->fdsc) == fdsc && GID_LOAD(&entry->letter) == letter;
+    *gid = GID_LOAD(&entry->gid);
+
+    /*If the entry was changed meanwhile the read values might be mixed*/
+    GID_FENCE_ACQUIRE();
+    return found && GID_LOAD(&entry->seq) == seq;
+}
+
+/**
+ * Write an entry of the glyph index cache without locking
+ * @param entry     pointer to a cache entry
+ * @param fdsc      the font of the letter, or NULL to clear the entry
+ * @param letter    the letter
+ * @param gid       the glyph index of the letter
+ * @return          true: written; false: another thread is writing the entry
+ */
+static bool gid_cache_write(lv_font_fmt_txt_gid_cache_entry_t * entry, const lv_font_fmt_txt_dsc_t * fdsc,
+                            uint32_t letter, uint32_t gid)
+{
+    uint32_t seq = GID_LOAD(&entry->seq);
+    if(seq & 1) return false;
+    if(!GID_CLAIM(&entry->seq, seq)) return false;
+
+    /*Don't let the readers see the new values with the old even sequence number*/
+    GID_FENCE_RELEASE();
+    GID_STORE(&entry->fdsc, fdsc);
+    GID_STORE(&entry->letter, letter);
+    GID_STORE(&entry->gid, gid);
+    GID_STORE_RELEASE(&entry->seq, seq + 2);
+    return true;
+}
+#endif /*LV_FONT_FMT_TXT_GID_CACHE_CNT*/
 
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
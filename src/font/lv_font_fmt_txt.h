@@ -193,6 +193,14 @@ typedef struct {
     uint8_t stride;
 } lv_font_fmt_txt_dsc_t;
 
+/** Statistics of the glyph caches of the built-in fonts*/
+typedef struct {
+    uint32_t glyph_hit_cnt;     /**< Number of glyph bitmaps found in the cache*/
+    uint32_t glyph_miss_cnt;    /**< Number of glyph bitmaps unpacked and added to the cache*/
+    uint32_t gid_hit_cnt;       /**< Number of glyph indexes found in the cache*/
+    uint32_t gid_miss_cnt;      /**< Number of glyph indexes searched in the character maps*/
+} lv_font_fmt_txt_cache_stat_t;
+
 typedef struct {
     const lv_font_t * font_p; /**< Pointer to built-in font*/
     uint32_t size; /** < Size of the built-in font*/
@@ -224,6 +232,24 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Remove the cached glyph bitmaps and glyph indexes of a font.
+ * Needs to be called before the descriptor of a font is freed or modified.
+ * @param font      pointer to a font, or NULL to drop the data of all fonts
+ */
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font);
+
+/**
+ * Get the hit and miss statistics of the glyph caches of the built-in fonts.
+ * @param stat      store the statistics here
+ */
+void lv_font_fmt_txt_cache_get_stat(lv_font_fmt_txt_cache_stat_t * stat);
+
+/**
+ * Reset the hit and miss statistics of the glyph caches of the built-in fonts.
+ */
+void lv_font_fmt_txt_cache_reset_stat(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -15,6 +15,8 @@ extern "C" {
  *********************/
 
 #include "lv_font_fmt_txt.h"
+#include "../misc/cache/lv_cache.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -41,10 +43,42 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+typedef struct {
+    uint32_t seq;                           /**< Incremented before and after writing the entry. Odd: being written*/
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< The font of the letter. NULL: unused entry */
+    uint32_t letter;
+    uint32_t gid;
+} lv_font_fmt_txt_gid_cache_entry_t;
+
+typedef struct {
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    lv_cache_t * glyph_cache;               /**< Unpacked A8 glyph bitmaps*/
+#endif
+#if LV_FONT_FMT_TXT_GID_CACHE_CNT
+    /** Direct mapped cache of the glyph indexes of the letters. Read and written without locking
+     * if the compiler has atomic builtins.*/
+    lv_font_fmt_txt_gid_cache_entry_t gid_cache[LV_FONT_FMT_TXT_GID_CACHE_CNT];
+#endif
+    lv_font_fmt_txt_cache_stat_t stat;
+    lv_mutex_t lock;                        /**< Protects the counters in `stat` and the glyph index cache without atomic builtins*/
+} lv_font_fmt_txt_cache_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the glyph caches of the built-in fonts.
+ * Called by LVGL in `lv_init()`
+ */
+void lv_font_fmt_txt_cache_init(void);
+
+/**
+ * Free the glyph caches of the built-in fonts.
+ * Called by LVGL in `lv_deinit()`
+ */
+void lv_font_fmt_txt_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
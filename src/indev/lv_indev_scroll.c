@@ -260,6 +260,7 @@ int32_t lv_indev_scroll_throw_predict(lv_indev_t * indev, lv_dir_t dir)
 
 void lv_indev_scroll_get_snap_dist(lv_obj_t * obj, lv_point_t * p)
 {
+    lv_obj_sync_coords(obj);
     p->x = find_snap_point_x(obj, obj->coords.x1, obj->coords.x2, 0);
     p->y = find_snap_point_y(obj, obj->coords.y1, obj->coords.y2, 0);
 }
@@ -442,6 +443,8 @@ lv_obj_t * lv_indev_find_scroll_obj(lv_indev_t * indev)
 static void init_scroll_limits(lv_indev_t * indev)
 {
     lv_obj_t * obj = indev->pointer.scroll_obj;
+    lv_obj_sync_coords(obj);
+
     /*If there no STOP allow scrolling anywhere*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLL_ONE) == false) {
         lv_area_set(&indev->pointer.scroll_area, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX);
@@ -518,6 +521,8 @@ static int32_t find_snap_point_x(const lv_obj_t * obj, int32_t min, int32_t max,
     lv_scroll_snap_t align = lv_obj_get_scroll_snap_x(obj);
     if(align == LV_SCROLL_SNAP_NONE) return LV_COORD_MAX;
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     int32_t dist = LV_COORD_MAX;
 
     int32_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
@@ -529,6 +534,7 @@ static int32_t find_snap_point_x(const lv_obj_t * obj, int32_t min, int32_t max,
         lv_obj_t * child = obj->spec_attr->children[i];
         if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
         if(lv_obj_has_flag(child, LV_OBJ_FLAG_SNAPPABLE)) {
+            lv_obj_sync_coords_with_parent(child);
             int32_t x_child = 0;
             int32_t x_parent = 0;
             switch(align) {
@@ -574,6 +580,8 @@ static int32_t find_snap_point_y(const lv_obj_t * obj, int32_t min, int32_t max,
     lv_scroll_snap_t align = lv_obj_get_scroll_snap_y(obj);
     if(align == LV_SCROLL_SNAP_NONE) return LV_COORD_MAX;
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
+
     int32_t dist = LV_COORD_MAX;
 
     int32_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
@@ -585,6 +593,7 @@ static int32_t find_snap_point_y(const lv_obj_t * obj, int32_t min, int32_t max,
         lv_obj_t * child = obj->spec_attr->children[i];
         if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
         if(lv_obj_has_flag(child, LV_OBJ_FLAG_SNAPPABLE)) {
+            lv_obj_sync_coords_with_parent(child);
             int32_t y_child = 0;
             int32_t y_parent = 0;
             switch(align) {
@@ -708,6 +717,8 @@ static int32_t elastic_diff(lv_obj_t * scroll_obj, int32_t diff, int32_t scroll_
  */
 static void has_more_snap_points(lv_obj_t * scroll_obj, lv_dir_t dir, bool * has_start_snap, bool * has_end_snap)
 {
+    lv_obj_sync_coords(scroll_obj);
+
     *has_start_snap = true;
     *has_end_snap = true;
     lv_scroll_snap_t snap;
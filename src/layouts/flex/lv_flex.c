@@ -143,6 +143,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     int32_t item_gap = f.row ? lv_obj_get_style_pad_column(cont, LV_PART_MAIN) : lv_obj_get_style_pad_row(cont,
                                                                                                           LV_PART_MAIN);
     int32_t max_main_size = (f.row ? lv_obj_get_content_width(cont) : lv_obj_get_content_height(cont));
+    lv_obj_sync_coords(cont);
     int32_t abs_y = cont->coords.y1 + lv_obj_get_style_space_top(cont,
                                                                  LV_PART_MAIN) - lv_obj_get_scroll_y(cont);
     int32_t abs_x = cont->coords.x1 + lv_obj_get_style_space_left(cont,
@@ -396,6 +397,8 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             continue;
         }
 
+        lv_obj_sync_coords_with_parent(item);
+
         uint16_t item_w_layout = item->w_layout;
         uint16_t item_h_layout = item->h_layout;
 
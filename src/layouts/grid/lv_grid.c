@@ -200,6 +200,7 @@ static void grid_update(lv_obj_t * cont, void * user_data)
      *It will be used as helper during item repositioning to avoid calculating this value for every children*/
     int32_t pad_left = lv_obj_get_style_space_left(cont, LV_PART_MAIN);
     int32_t pad_top = lv_obj_get_style_space_top(cont, LV_PART_MAIN);
+    lv_obj_sync_coords(cont);
     hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
     hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
 
@@ -470,6 +471,7 @@ static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
 static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint)
 {
     if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return;
+    lv_obj_sync_coords_with_parent(item);
     uint32_t col_span = get_col_span(item);
     uint32_t row_span = get_row_span(item);
     if(row_span == 0 || col_span == 0) return;
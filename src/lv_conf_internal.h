@@ -28,6 +28,7 @@
 #define LV_DRAW_SW_ASM_NONE             0
 #define LV_DRAW_SW_ASM_NEON             1
 #define LV_DRAW_SW_ASM_HELIUM           2
+#define LV_DRAW_SW_ASM_X86_SIMD         3
 #define LV_DRAW_SW_ASM_CUSTOM           255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -228,6 +229,29 @@
             #endif
         #endif
     #endif
+
+    /** Number of separate memory arenas for the threads other than the one calling `lv_init()`
+     *  (e.g. render and decoder threads). Each arena has its own lock, so these threads don't wait
+     *  for each other in `lv_malloc()`. The threads get the arenas in round-robin order and
+     *  fall back to the main pool when their arena is full. A block freed by another thread is
+     *  given back to its arena without locking (if the compiler has atomic builtins).
+     *  Requires `LV_USE_OS` and thread-local storage support in the compiler. 0: disable */
+    #ifndef LV_MEM_THREAD_ARENA_CNT
+        #ifdef CONFIG_LV_MEM_THREAD_ARENA_CNT
+            #define LV_MEM_THREAD_ARENA_CNT CONFIG_LV_MEM_THREAD_ARENA_CNT
+        #else
+            #define LV_MEM_THREAD_ARENA_CNT 0
+        #endif
+    #endif
+
+    /** Size of each thread arena. The arenas are taken from the end of `LV_MEM_SIZE`. */
+    #ifndef LV_MEM_THREAD_ARENA_SIZE
+        #ifdef CONFIG_LV_MEM_THREAD_ARENA_SIZE
+            #define LV_MEM_THREAD_ARENA_SIZE CONFIG_LV_MEM_THREAD_ARENA_SIZE
+        #else
+            #define LV_MEM_THREAD_ARENA_SIZE (32 * 1024U)     /**< [bytes] */
+        #endif
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -366,6 +390,37 @@
     #endif
 #endif
 
+/** Divide the layers into a grid of `N x N` bins and keep a list of the draw tasks touching each bin.
+ * This way the dependency check of the draw tasks needs to look only at the draw tasks in the same bins
+ * instead of all the older draw tasks of the layer. Useful if there are hundreds or thousands of draw tasks.
+ * The bins are created only when a layer has at least `LV_DRAW_TASK_INDEX_MIN_TASK_CNT` draw tasks.
+ * Set to 0 to disable the draw task index. */
+#ifndef LV_DRAW_TASK_INDEX_GRID_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_INDEX_GRID_SIZE
+        #define LV_DRAW_TASK_INDEX_GRID_SIZE CONFIG_LV_DRAW_TASK_INDEX_GRID_SIZE
+    #else
+        #define LV_DRAW_TASK_INDEX_GRID_SIZE      8
+    #endif
+#endif
+#ifndef LV_DRAW_TASK_INDEX_MIN_TASK_CNT
+    #ifdef CONFIG_LV_DRAW_TASK_INDEX_MIN_TASK_CNT
+        #define LV_DRAW_TASK_INDEX_MIN_TASK_CNT CONFIG_LV_DRAW_TASK_INDEX_MIN_TASK_CNT
+    #else
+        #define LV_DRAW_TASK_INDEX_MIN_TASK_CNT   32
+    #endif
+#endif
+
+/** Size of an arena (bump allocator) per display for the draw tasks created while refreshing the display.
+ * It replaces the `lv_malloc`/`lv_free` pairs of each draw task and is reused after each refreshed area.
+ * If the arena is full `lv_malloc` is used. Set to 0 to always use `lv_malloc`. */
+#ifndef LV_DRAW_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_ARENA_SIZE
+        #define LV_DRAW_ARENA_SIZE CONFIG_LV_DRAW_ARENA_SIZE
+    #else
+        #define LV_DRAW_ARENA_SIZE    0     /**< [bytes]*/
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -557,6 +612,27 @@
         #endif
     #endif
 
+    /** If there are multiple draw units, max. number of draw tasks queued for each render thread.
+     *  More tasks can be dispatched at once but an idle thread might need to steal more often. */
+    #ifndef LV_DRAW_SW_THREAD_QUEUE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_THREAD_QUEUE_SIZE
+            #define LV_DRAW_SW_THREAD_QUEUE_SIZE CONFIG_LV_DRAW_SW_THREAD_QUEUE_SIZE
+        #else
+            #define LV_DRAW_SW_THREAD_QUEUE_SIZE    8
+        #endif
+    #endif
+
+    /** If there are multiple draw units, split the fills, box shadows, images and layers
+     *  larger than this area into horizontal bands rendered by all the draw units in parallel.
+     *  Set to 0 to disable splitting. [px] */
+    #ifndef LV_DRAW_SW_SPLIT_MIN_AREA
+        #ifdef CONFIG_LV_DRAW_SW_SPLIT_MIN_AREA
+            #define LV_DRAW_SW_SPLIT_MIN_AREA CONFIG_LV_DRAW_SW_SPLIT_MIN_AREA
+        #else
+            #define LV_DRAW_SW_SPLIT_MIN_AREA   (200 * 200)
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -591,14 +667,15 @@
     #endif
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /** Allow buffering some shadow calculation.
-         *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-        #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
-            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
+        /** Size of the cache storing the blurred corners of the box shadows [bytes].
+         *  Shadows with the same width, radius and similar size share a corner
+         *  so they are blurred only once. A corner costs `2 * (shadow_width + radius)^2` bytes.
+         *  0: disable the cache */
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_BYTES
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_BYTES
+                #define LV_DRAW_SW_SHADOW_CACHE_BYTES CONFIG_LV_DRAW_SW_SHADOW_CACHE_BYTES
             #else
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+                #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0
             #endif
         #endif
 
@@ -1411,6 +1488,55 @@
     #endif
 #endif
 
+/** Number of resolved style property values cached in each `lv_obj_t` to avoid
+ *  looking up the same properties again and again (e.g. when a static screen is redrawn).
+ *  The cache is allocated when a property of the object is read first and it's
+ *  invalidated when the styles, state or parent of the object (or its parents) change.
+ *  Modifying a shared style (`lv_style_set_...()`) invalidates the cache of all objects.
+ *  0: disable the cache */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE    0
+    #endif
+#endif
+
+/** Keep the children of widgets having at least this many children sorted by their Y coordinate
+ *  while refreshing the screen. This way only the children on the refreshed area are visited
+ *  instead of all the children (e.g. long lists or large grids of buttons).
+ *  0: disable the index */
+#ifndef LV_OBJ_CHILD_INDEX_MIN_CNT
+    #ifdef CONFIG_LV_OBJ_CHILD_INDEX_MIN_CNT
+        #define LV_OBJ_CHILD_INDEX_MIN_CNT CONFIG_LV_OBJ_CHILD_INDEX_MIN_CNT
+    #else
+        #define LV_OBJ_CHILD_INDEX_MIN_CNT  0
+    #endif
+#endif
+
+/** Apply the scroll offset and the movement of widgets to their children only when the
+ *  coordinates of a child are used (e.g. it's drawn or clicked). This way scrolling takes the same
+ *  time regardless of the number of children and descendants.
+ *  Custom code reading `obj->coords` directly needs to call `lv_obj_sync_coords(obj)` first. */
+#ifndef LV_OBJ_LAZY_COORDS
+    #ifdef CONFIG_LV_OBJ_LAZY_COORDS
+        #define LV_OBJ_LAZY_COORDS CONFIG_LV_OBJ_LAZY_COORDS
+    #else
+        #define LV_OBJ_LAZY_COORDS  0
+    #endif
+#endif
+
+/** When a widget is scrolled in `LV_DISPLAY_RENDER_MODE_DIRECT`, move its already rendered pixels
+ *  in the draw buffer and redraw only the uncovered strip, instead of redrawing the whole widget.
+ *  It's used only for widgets with a plain opaque background and nothing drawn over them. */
+#ifndef LV_OBJ_SCROLL_BLIT
+    #ifdef CONFIG_LV_OBJ_SCROLL_BLIT
+        #define LV_OBJ_SCROLL_BLIT CONFIG_LV_OBJ_SCROLL_BLIT
+    #else
+        #define LV_OBJ_SCROLL_BLIT  0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1948,6 +2074,28 @@
     #endif
 #endif
 
+/** Size of the cache storing the unpacked (and decompressed) glyph bitmaps
+ *  of the built-in fonts to avoid unpacking them on every draw [bytes].
+ *  0: disable the cache */
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Number of letters whose glyph index is cached to avoid searching them
+ *  in the character maps of the built-in fonts on every use.
+ *  0: disable the cache */
+#ifndef LV_FONT_FMT_TXT_GID_CACHE_CNT
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GID_CACHE_CNT
+        #define LV_FONT_FMT_TXT_GID_CACHE_CNT CONFIG_LV_FONT_FMT_TXT_GID_CACHE_CNT
+    #else
+        #define LV_FONT_FMT_TXT_GID_CACHE_CNT 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -2351,6 +2499,13 @@
             #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_TABLE
+        #ifdef CONFIG_LV_LABEL_LINE_TABLE
+            #define LV_LABEL_LINE_TABLE CONFIG_LV_LABEL_LINE_TABLE
+        #else
+            #define LV_LABEL_LINE_TABLE 0       /**< Store the line breaks of labels to speed up drawing and hit testing of long texts */
+        #endif
+    #endif
     #ifndef LV_LABEL_WAIT_CHAR_COUNT
         #ifdef CONFIG_LV_LABEL_WAIT_CHAR_COUNT
             #define LV_LABEL_WAIT_CHAR_COUNT CONFIG_LV_LABEL_WAIT_CHAR_COUNT
@@ -3425,6 +3580,15 @@
         #endif
     #endif
 
+    /** Profiler function to record the value of a counter */
+    #ifndef LV_PROFILER_COUNTER
+        #ifdef CONFIG_LV_PROFILER_COUNTER
+            #define LV_PROFILER_COUNTER CONFIG_LV_PROFILER_COUNTER
+        #else
+            #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+        #endif
+    #endif
+
     /*Enable layout profiler*/
     #ifndef LV_PROFILER_LAYOUT
         #ifdef LV_KCONFIG_PRESENT
@@ -4704,6 +4868,11 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
     #endif
 #endif
 
+#if (defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE) || \
+    (defined(CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE) && CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #warning "LV_DRAW_SW_SHADOW_CACHE_SIZE was replaced by LV_DRAW_SW_SHADOW_CACHE_BYTES which is the size of the whole cache in bytes (not the largest cached shadow). Please update lv_conf.h or run menuconfig again."
+#endif
+
 /*Allow only upper case letters and '/'  ('/' is a special case for backward compatibility)*/
 #define LV_FS_IS_VALID_LETTER(l) ((l) == '/' || ((l) >= 'A' && (l) <= 'Z'))
 
@@ -27,6 +27,11 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+#if LV_USE_PROFILER && LV_PROFILER_CACHE
+    static void cache_count_lookup_no_lock(lv_cache_t * cache, bool hit);
+#else
+    #define cache_count_lookup_no_lock(cache, hit)
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -99,6 +104,7 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
     }
+    cache_count_lookup_no_lock(cache, entry != NULL);
     lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_CACHE_END;
@@ -157,6 +163,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
 
     if(cache->size != 0) {
         entry = cache->clz->get_cb(cache, key, user_data);
+        cache_count_lookup_no_lock(cache, entry != NULL);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
             lv_mutex_unlock(&cache->lock);
@@ -357,3 +364,18 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+#if LV_USE_PROFILER && LV_PROFILER_CACHE
+static void cache_count_lookup_no_lock(lv_cache_t * cache, bool hit)
+{
+    cache->lookup_cnt++;
+    if(hit) cache->hit_cnt++;
+
+    /*Report the hit rate in percent only periodically to not flood the trace*/
+    if(cache->lookup_cnt >= 64) {
+        LV_PROFILER_CACHE_COUNTER(cache->name ? cache->name : "cache", (int32_t)(cache->hit_cnt * 100 / cache->lookup_cnt));
+        cache->lookup_cnt = 0;
+        cache->hit_cnt = 0;
+    }
+}
+#endif
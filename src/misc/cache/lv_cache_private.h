@@ -138,6 +138,11 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+
+#if LV_USE_PROFILER && LV_PROFILER_CACHE
+    uint32_t lookup_cnt;              /**< Lookups since the last hit rate report */
+    uint32_t hit_cnt;                 /**< Hits since the last hit rate report */
+#endif
 };
 
 /**
@@ -49,6 +49,7 @@ static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(const lv_anim_t * a_current);
 static void remove_anim(void * a);
+static void anim_ll_remove(lv_anim_t * a);
 
 /**********************
  *  STATIC VARIABLES
@@ -567,15 +568,25 @@ static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
+    /*It can be called from an animation's callback too (e.g. by `lv_refr_now()`)*/
+    bool nested = state.anim_timer_running;
+    state.anim_timer_running = true;
+    state.anim_timer_restart = false;
+
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
     lv_anim_t * a = lv_ll_get_head(anim_ll_p);
     while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+        /*The callbacks can delete any animations. If the next one is deleted
+         *`anim_timer_next` is moved forward so the list needn't be read from the head again.*/
+        state.anim_timer_next = lv_ll_get_next(anim_ll_p, a);
+
+        uint32_t now = lv_tick_get();
+        uint32_t elaps = lv_tick_diff(now, a->last_timer_run);
 
         if(a->is_paused) {
-            const uint32_t time_paused = lv_tick_elaps(a->pause_time);
+            const uint32_t time_paused = lv_tick_diff(now, a->pause_time);
             const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
 
             if(is_pause_over) {
@@ -588,7 +599,7 @@ static void anim_timer(lv_timer_t * param)
         else {
             a->act_time += elaps;
         }
-        a->last_timer_run = lv_tick_get();
+        a->last_timer_run = now;
 
         /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
          * happened in `anim_completed_handler` which could make this linked list reading corrupt
@@ -644,14 +655,20 @@ static void anim_timer(lv_timer_t * param)
             }
         }
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
+        /*After a nested call `anim_timer_next` might be deleted -> start from the head.
+         *The animations which already ran are skipped by `run_round`.*/
+        if(state.anim_timer_restart) {
+            state.anim_timer_restart = false;
             a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
+        }
+        else {
+            a = state.anim_timer_next;
+        }
     }
 
+    state.anim_timer_next = NULL;
+    state.anim_timer_running = nested;
+    state.anim_timer_restart = nested;
 }
 
 /**
@@ -673,7 +690,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
+        anim_ll_remove(a);
         /*Flag that the list has changed*/
         anim_mark_list_change();
 
@@ -795,7 +812,7 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
+            anim_ll_remove(a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
             lv_free(a);
             /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
@@ -816,7 +833,17 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
 static void remove_anim(void * a)
 {
     lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
+    anim_ll_remove(anim);
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
     lv_free(a);
 }
+
+/**
+ * Remove an animation from the linked list and keep `anim_timer_next` valid
+ * @param a     pointer to an animation
+ */
+static void anim_ll_remove(lv_anim_t * a)
+{
+    if(state.anim_timer_next == a) state.anim_timer_next = lv_ll_get_next(anim_ll_p, a);
+    lv_ll_remove(anim_ll_p, a);
+}
@@ -28,6 +28,9 @@ typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
+    bool anim_timer_running;
+    bool anim_timer_restart;    /**< Handle the animations from the head again after a nested refresh */
+    lv_anim_t * anim_timer_next; /**< The animation to handle next, kept valid if animations are deleted */
     lv_timer_t * timer;
     lv_ll_t anim_ll;
 } lv_anim_state_t;
@@ -0,0 +1,144 @@
+/**
+ * @file lv_arena.c
+ * Arena (bump) allocator.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_arena.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../stdlib/lv_sprintf.h"
+#include "lv_assert.h"
+#include "lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * arena_alloc(lv_arena_t * arena, size_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_arena_init(lv_arena_t * arena, uint32_t size)
+{
+    LV_ASSERT_NULL(arena);
+    lv_memzero(arena, sizeof(lv_arena_t));
+    arena->size = size;
+}
+
+void lv_arena_deinit(lv_arena_t * arena)
+{
+    LV_ASSERT_NULL(arena);
+    if(arena->live_cnt) {
+        LV_LOG_WARN("%" LV_PRIu32 " blocks are still in use", arena->live_cnt);
+    }
+
+    lv_free(arena->buf);
+    arena->buf = NULL;
+    arena->used = 0;
+    arena->live_cnt = 0;
+}
+
+void * lv_arena_alloc_zeroed(lv_arena_t * arena, size_t size)
+{
+    void * p = arena_alloc(arena, size);
+    if(p) {
+        lv_memzero(p, size);
+        return p;
+    }
+
+    arena->fallback_cnt++;
+    return lv_malloc_zeroed(size);
+}
+
+void lv_arena_free(lv_arena_t * arena, void * p)
+{
+    if(p == NULL) return;
+
+    if(lv_arena_owns(arena, p)) {
+        LV_ASSERT(arena->live_cnt > 0);
+        arena->live_cnt--;
+        /*The last block is freed, so the whole memory can be reused*/
+        if(arena->live_cnt == 0) arena->used = 0;
+    }
+    else {
+        lv_free(p);
+    }
+}
+
+bool lv_arena_owns(const lv_arena_t * arena, const void * p)
+{
+    const uint8_t * p8 = p;
+    return arena->buf && p8 >= arena->buf && p8 < arena->buf + arena->size;
+}
+
+bool lv_arena_reset(lv_arena_t * arena)
+{
+    if(arena->live_cnt) {
+        LV_LOG_WARN("%" LV_PRIu32 " blocks are still in use, %" LV_PRIu32 " bytes can't be reused",
+                    arena->live_cnt, arena->used);
+        return false;
+    }
+
+    arena->used = 0;
+    return true;
+}
+
+void lv_arena_reset_stat(lv_arena_t * arena)
+{
+    arena->used_max = arena->used;
+    arena->alloc_cnt = 0;
+    arena->fallback_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get a memory block from the arena's buffer
+ * @param arena     pointer to an arena
+ * @param size      size of the memory block in bytes
+ * @return          pointer to the memory block or NULL if there is not enough space
+ */
+static void * arena_alloc(lv_arena_t * arena, size_t size)
+{
+    LV_ASSERT_NULL(arena);
+    if(arena->size == 0) return NULL;
+
+    if(arena->buf == NULL) {
+        arena->buf = lv_malloc(arena->size);
+        LV_ASSERT_MALLOC(arena->buf);
+        if(arena->buf == NULL) return NULL;
+    }
+
+    /*Align the absolute address as `lv_malloc` might use smaller alignment*/
+    uintptr_t start = LV_ALIGN_UP((uintptr_t)arena->buf + arena->used, LV_ARENA_ALIGN) - (uintptr_t)arena->buf;
+    if(start + size > arena->size) return NULL;
+
+    arena->used = (uint32_t)(start + size);
+    arena->used_max = LV_MAX(arena->used_max, arena->used);
+    arena->alloc_cnt++;
+    arena->live_cnt++;
+
+    return arena->buf + start;
+}
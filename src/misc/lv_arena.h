@@ -0,0 +1,106 @@
+/**
+ * @file lv_arena.h
+ * Arena (bump) allocator for short living allocations which are released together.
+ * If the arena is full the allocations fall back to `lv_malloc`.
+ */
+
+#ifndef LV_ARENA_H
+#define LV_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Alignment of the memory blocks returned from the arena */
+#define LV_ARENA_ALIGN      8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of an arena*/
+struct _lv_arena_t {
+    uint8_t * buf;              /**< The memory of the arena. Allocated on the first allocation.*/
+    uint32_t size;              /**< Size of `buf` in bytes*/
+    uint32_t used;              /**< Number of bytes already given out from `buf`*/
+    uint32_t live_cnt;          /**< Number of blocks in `buf` which are not freed yet*/
+
+    /*Statistics since the last `lv_arena_reset_stat()`*/
+    uint32_t used_max;          /**< The highest `used` value*/
+    uint32_t alloc_cnt;         /**< Number of allocations served from `buf`*/
+    uint32_t fallback_cnt;      /**< Number of allocations served by `lv_malloc` as `buf` was full*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an arena. The memory is allocated only when it's used first.
+ * @param arena     pointer to an `lv_arena_t` variable to initialize
+ * @param size      size of the arena in bytes. If 0 all the allocations will use `lv_malloc`.
+ */
+void lv_arena_init(lv_arena_t * arena, uint32_t size);
+
+/**
+ * Free the memory of an arena. All the blocks allocated from it become invalid.
+ * @param arena     pointer to an arena
+ */
+void lv_arena_deinit(lv_arena_t * arena);
+
+/**
+ * Allocate a zeroed memory block from the arena, or with `lv_malloc_zeroed` if the arena is full.
+ * @param arena     pointer to an arena
+ * @param size      size of the memory block in bytes
+ * @return          pointer to the memory block or NULL on error
+ */
+void * lv_arena_alloc_zeroed(lv_arena_t * arena, size_t size);
+
+/**
+ * Free a memory block allocated by `lv_arena_alloc_zeroed`.
+ * The memory of the arena is reused only when all of its blocks are freed.
+ * @param arena     pointer to the arena used for the allocation
+ * @param p         pointer to the memory block
+ */
+void lv_arena_free(lv_arena_t * arena, void * p);
+
+/**
+ * Check if a memory block was allocated from the memory of the arena.
+ * @param arena     pointer to an arena
+ * @param p         pointer to a memory block
+ * @return          true: `p` is in the arena; false: `p` was allocated by `lv_malloc`
+ */
+bool lv_arena_owns(const lv_arena_t * arena, const void * p);
+
+/**
+ * Make the whole memory of the arena available again.
+ * It's ignored (and a warning is logged) if there are blocks which are not freed yet.
+ * @param arena     pointer to an arena
+ * @return          true: the arena was reset; false: there are still blocks in use
+ */
+bool lv_arena_reset(lv_arena_t * arena);
+
+/**
+ * Clear the statistics (`used_max`, `alloc_cnt`, `fallback_cnt`) of the arena
+ * @param arena     pointer to an arena
+ */
+void lv_arena_reset_stat(lv_arena_t * arena);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ARENA_H*/
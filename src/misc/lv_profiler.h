@@ -20,6 +20,11 @@ extern "C" {
 
 #include LV_PROFILER_INCLUDE
 
+/* Profilers without counter support ignore the counters */
+#if !LV_USE_PROFILER_BUILTIN && !defined(LV_PROFILER_BUILTIN_COUNTER)
+#define LV_PROFILER_BUILTIN_COUNTER(name, value) do { LV_UNUSED(name); LV_UNUSED(value); } while(0)
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -42,6 +47,7 @@ extern "C" {
 #define LV_PROFILER_END
 #define LV_PROFILER_BEGIN_TAG(tag) LV_UNUSED(tag)
 #define LV_PROFILER_END_TAG(tag)   LV_UNUSED(tag)
+#define LV_PROFILER_COUNTER(name, value) do { LV_UNUSED(name); LV_UNUSED(value); } while(0)
 
 #endif /*LV_USE_PROFILER*/
 
@@ -50,11 +56,13 @@ extern "C" {
 #define LV_PROFILER_LAYOUT_END LV_PROFILER_END
 #define LV_PROFILER_LAYOUT_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_LAYOUT_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_LAYOUT_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_LAYOUT_BEGIN
 #define LV_PROFILER_LAYOUT_END
 #define LV_PROFILER_LAYOUT_BEGIN_TAG(tag)
 #define LV_PROFILER_LAYOUT_END_TAG(tag)
+#define LV_PROFILER_LAYOUT_COUNTER(name, value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_STYLE
@@ -98,11 +106,13 @@ extern "C" {
 #define LV_PROFILER_REFR_END LV_PROFILER_END
 #define LV_PROFILER_REFR_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_REFR_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_REFR_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_REFR_BEGIN
 #define LV_PROFILER_REFR_END
 #define LV_PROFILER_REFR_BEGIN_TAG(tag)
 #define LV_PROFILER_REFR_END_TAG(tag)
+#define LV_PROFILER_REFR_COUNTER(name, value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_INDEV
@@ -134,11 +144,13 @@ extern "C" {
 #define LV_PROFILER_CACHE_END LV_PROFILER_END
 #define LV_PROFILER_CACHE_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
 #define LV_PROFILER_CACHE_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_CACHE_COUNTER(name, value) LV_PROFILER_COUNTER(name, value)
 #else
 #define LV_PROFILER_CACHE_BEGIN
 #define LV_PROFILER_CACHE_END
 #define LV_PROFILER_CACHE_BEGIN_TAG(tag)
 #define LV_PROFILER_CACHE_END_TAG(tag)
+#define LV_PROFILER_CACHE_COUNTER(name, value)
 #endif
 
 #if LV_USE_PROFILER && LV_PROFILER_FS
@@ -27,11 +27,26 @@
     #define LV_PROFILER_MULTEX_DEINIT lv_mutex_delete(&profiler_ctx->mutex)
     #define LV_PROFILER_MULTEX_LOCK   lv_mutex_lock(&profiler_ctx->mutex)
     #define LV_PROFILER_MULTEX_UNLOCK lv_mutex_unlock(&profiler_ctx->mutex)
+
+    /* Maximum number of threads having their own ring buffer */
+    #define LV_PROFILER_RING_MAX      16
 #else
     #define LV_PROFILER_MULTEX_INIT
     #define LV_PROFILER_MULTEX_DEINIT
     #define LV_PROFILER_MULTEX_LOCK
     #define LV_PROFILER_MULTEX_UNLOCK
+
+    #define LV_PROFILER_RING_MAX      1
+#endif
+
+/* A ring is written only by its thread and read only while holding the mutex,
+ * so ordered loads and stores of the indices are enough to share it */
+#if defined(__GNUC__) || defined(__clang__)
+    #define LV_PROFILER_LOAD(p)       __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define LV_PROFILER_STORE(p, v)   __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+    #define LV_PROFILER_LOAD(p)       (*(p))
+    #define LV_PROFILER_STORE(p, v)   (*(p) = (v))
 #endif
 
 /**********************
@@ -44,24 +59,34 @@
 typedef struct {
     uint64_t tick;     /**< The tick value of the profiler item */
     char tag;          /**< The tag of the profiler item */
+    int32_t value;     /**< The value of a counter item */
     const char * func; /**< A pointer to the function associated with the profiler item */
 #if LV_USE_OS
-    int tid;           /**< The thread ID of the profiler item */
-    int cpu;         /**< The CPU ID of the profiler item */
+    int cpu;           /**< The CPU ID of the profiler item */
 #endif
 } lv_profiler_builtin_item_t;
 
+/**
+ * @brief Ring buffer of profiler items written by a single thread
+ */
+typedef struct {
+    volatile int tid;                                  /**< The thread ID of the writer, 0: unused*/
+    lv_profiler_builtin_item_t * volatile item_arr;    /**< Pointer to an array of profiler items */
+    volatile uint32_t head;                            /**< Number of written items, changed only by the writer */
+    volatile uint32_t tail;                            /**< Number of flushed items, changed only while flushing */
+} lv_profiler_builtin_ring_t;
+
 /**
  * @brief Structure representing a context for the LVGL built-in profiler
  */
 typedef struct _lv_profiler_builtin_ctx_t {
-    lv_profiler_builtin_item_t * item_arr; /**< Pointer to an array of profiler items */
-    uint32_t item_num;                     /**< Number of profiler items in the array */
-    uint32_t cur_index;                    /**< Index of the current profiler item */
+    lv_profiler_builtin_ring_t rings[LV_PROFILER_RING_MAX]; /**< Ring buffers of the threads */
+    uint32_t item_num;                     /**< Number of profiler items in a ring */
     lv_profiler_builtin_config_t config;   /**< Configuration for the built-in profiler */
     bool enable;                           /**< Whether the built-in profiler is enabled */
 #if LV_USE_OS
-    lv_mutex_t mutex;                      /**< Mutex to protect the built-in profiler */
+    bool lock_free;                        /**< The threads can be told apart so they don't need to lock */
+    lv_mutex_t mutex;                      /**< Mutex to protect the flushing and the registration of threads */
 #endif
 } lv_profiler_builtin_ctx_t;
 
@@ -73,7 +98,11 @@ static uint64_t default_tick_get_cb(void);
 static void default_flush_cb(const char * buf);
 static int default_tid_get_cb(void);
 static int default_cpu_get_cb(void);
-static void flush_no_lock(void);
+static void write_item(const char * func, char tag, int32_t value);
+#if LV_USE_OS
+    static lv_profiler_builtin_ring_t * get_ring(int tid);
+#endif
+static void flush_ring_no_lock(lv_profiler_builtin_ring_t * ring);
 
 /**********************
  *  STATIC VARIABLES
@@ -97,6 +126,7 @@ void lv_profiler_builtin_config_init(lv_profiler_builtin_config_t * config)
     config->flush_cb = default_flush_cb;
     config->tid_get_cb = default_tid_get_cb;
     config->cpu_get_cb = default_cpu_get_cb;
+    config->format = LV_PROFILER_BUILTIN_FORMAT_FTRACE;
 }
 
 void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
@@ -123,9 +153,10 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
     profiler_ctx = lv_malloc_zeroed(sizeof(lv_profiler_builtin_ctx_t));
     LV_ASSERT_MALLOC(profiler_ctx);
 
-    profiler_ctx->item_arr = lv_malloc(num * sizeof(lv_profiler_builtin_item_t));
-    LV_ASSERT_MALLOC(profiler_ctx->item_arr);
-    if(profiler_ctx->item_arr == NULL) {
+    /*Allocate the ring of the initializing thread to report an error early*/
+    profiler_ctx->rings[0].item_arr = lv_malloc(num * sizeof(lv_profiler_builtin_item_t));
+    LV_ASSERT_MALLOC(profiler_ctx->rings[0].item_arr);
+    if(profiler_ctx->rings[0].item_arr == NULL) {
         lv_free(profiler_ctx);
         profiler_ctx = NULL;
         LV_LOG_ERROR("malloc failed for item_arr");
@@ -136,10 +167,24 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
     profiler_ctx->item_num = num;
     profiler_ctx->config = *config;
 
+#if LV_USE_OS
+    /*Without a real thread ID all threads would write the same ring*/
+    profiler_ctx->lock_free = config->tid_get_cb && config->tid_get_cb != default_tid_get_cb;
+    profiler_ctx->rings[0].tid = config->tid_get_cb ? config->tid_get_cb() : 1;
+#else
+    profiler_ctx->rings[0].tid = 1;
+#endif
+
     if(profiler_ctx->config.flush_cb) {
-        /* add profiler header for perfetto */
-        profiler_ctx->config.flush_cb("# tracer: nop\n");
-        profiler_ctx->config.flush_cb("#\n");
+        if(profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON) {
+            /* The closing bracket is optional in the JSON array format */
+            profiler_ctx->config.flush_cb("[\n");
+        }
+        else {
+            /* add profiler header for perfetto */
+            profiler_ctx->config.flush_cb("# tracer: nop\n");
+            profiler_ctx->config.flush_cb("#\n");
+        }
     }
 
     lv_profiler_builtin_set_enable(LV_PROFILER_BUILTIN_DEFAULT_ENABLE);
@@ -151,7 +196,10 @@ void lv_profiler_builtin_uninit(void)
 {
     LV_ASSERT_NULL(profiler_ctx);
     LV_PROFILER_MULTEX_DEINIT;
-    lv_free(profiler_ctx->item_arr);
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_RING_MAX; i++) {
+        lv_free(profiler_ctx->rings[i].item_arr);
+    }
     lv_free(profiler_ctx);
     profiler_ctx = NULL;
 }
@@ -170,39 +218,22 @@ void lv_profiler_builtin_flush(void)
     LV_ASSERT_NULL(profiler_ctx);
 
     LV_PROFILER_MULTEX_LOCK;
-    flush_no_lock();
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_RING_MAX; i++) {
+        lv_profiler_builtin_ring_t * ring = &profiler_ctx->rings[i];
+        if(LV_PROFILER_LOAD(&ring->item_arr)) flush_ring_no_lock(ring);
+    }
     LV_PROFILER_MULTEX_UNLOCK;
 }
 
 void lv_profiler_builtin_write(const char * func, char tag)
 {
-    LV_ASSERT_NULL(profiler_ctx);
-    LV_ASSERT_NULL(func);
-
-    if(!profiler_ctx->enable) {
-        return;
-    }
-
-    LV_PROFILER_MULTEX_LOCK;
-
-    if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
-        flush_no_lock();
-        profiler_ctx->cur_index = 0;
-    }
-
-    lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
-    item->func = func;
-    item->tag = tag;
-    item->tick = profiler_ctx->config.tick_get_cb();
-
-#if LV_USE_OS
-    item->tid = profiler_ctx->config.tid_get_cb();
-    item->cpu = profiler_ctx->config.cpu_get_cb();
-#endif
-
-    profiler_ctx->cur_index++;
+    write_item(func, tag, 0);
+}
 
-    LV_PROFILER_MULTEX_UNLOCK;
+void lv_profiler_builtin_counter(const char * name, int32_t value)
+{
+    write_item(name, 'C', value);
 }
 
 /**********************
@@ -229,40 +260,173 @@ static int default_cpu_get_cb(void)
     return 0;
 }
 
-static void flush_no_lock(void)
+static void write_item(const char * func, char tag, int32_t value)
+{
+    LV_ASSERT_NULL(profiler_ctx);
+    LV_ASSERT_NULL(func);
+
+    if(!profiler_ctx->enable) {
+        return;
+    }
+
+#if LV_USE_OS
+    bool lock_free = profiler_ctx->lock_free;
+    if(!lock_free) LV_PROFILER_MULTEX_LOCK;
+
+    lv_profiler_builtin_ring_t * ring = get_ring(lock_free ? profiler_ctx->config.tid_get_cb() : 1);
+#else
+    lv_profiler_builtin_ring_t * ring = &profiler_ctx->rings[0];
+#endif
+
+    if(ring) {
+        uint32_t head = ring->head;
+        if(head - LV_PROFILER_LOAD(&ring->tail) >= profiler_ctx->item_num) {
+            /*The ring wasn't flushed in time, so flush it here*/
+#if LV_USE_OS
+            if(lock_free) LV_PROFILER_MULTEX_LOCK;
+            flush_ring_no_lock(ring);
+            if(lock_free) LV_PROFILER_MULTEX_UNLOCK;
+#else
+            flush_ring_no_lock(ring);
+#endif
+        }
+
+        lv_profiler_builtin_item_t * item = &ring->item_arr[head % profiler_ctx->item_num];
+        item->func = func;
+        item->tag = tag;
+        item->value = value;
+        item->tick = profiler_ctx->config.tick_get_cb();
+
+#if LV_USE_OS
+        item->cpu = profiler_ctx->config.cpu_get_cb();
+#endif
+
+        /*Publish the item only when it's completely written*/
+        LV_PROFILER_STORE(&ring->head, head + 1);
+    }
+
+#if LV_USE_OS
+    if(!lock_free) LV_PROFILER_MULTEX_UNLOCK;
+#endif
+}
+
+#if LV_USE_OS
+/**
+ * Get the ring buffer of a thread. Allocate a new one if this thread doesn't have it yet.
+ * @param tid   ID of the current thread
+ * @return      the ring buffer or NULL if there are too many threads or it's being allocated
+ */
+static lv_profiler_builtin_ring_t * get_ring(int tid)
+{
+    lv_profiler_builtin_ring_t * rings = profiler_ctx->rings;
+    uint32_t i;
+
+    /*Rings are used in order, so the first unused ring ends the search*/
+    for(i = 0; i < LV_PROFILER_RING_MAX; i++) {
+        int ring_tid = LV_PROFILER_LOAD(&rings[i].tid);
+        if(ring_tid == tid) return LV_PROFILER_LOAD(&rings[i].item_arr) ? &rings[i] : NULL;
+        if(ring_tid == 0) break;
+    }
+
+    if(i == LV_PROFILER_RING_MAX) return NULL;
+
+    LV_PROFILER_MULTEX_LOCK;
+
+    /*Another thread might have taken this ring in the meantime*/
+    for(; i < LV_PROFILER_RING_MAX && rings[i].tid != 0; i++) {}
+
+    lv_profiler_builtin_ring_t * ring = NULL;
+    if(i < LV_PROFILER_RING_MAX) {
+        ring = &rings[i];
+        ring->head = 0;
+        ring->tail = 0;
+
+        /*Claim the ring before allocating so nested writes of this thread are ignored and not registered again*/
+        LV_PROFILER_STORE(&ring->tid, tid);
+        lv_profiler_builtin_item_t * item_arr = lv_malloc(profiler_ctx->item_num * sizeof(lv_profiler_builtin_item_t));
+        LV_ASSERT_MALLOC(item_arr);
+        LV_PROFILER_STORE(&ring->item_arr, item_arr);
+        if(item_arr == NULL) ring = NULL;
+    }
+    else {
+        LV_LOG_WARN("Too many threads, the events of thread %d are not recorded", tid);
+    }
+
+    LV_PROFILER_MULTEX_UNLOCK;
+
+    return ring;
+}
+#endif
+
+static void flush_ring_no_lock(lv_profiler_builtin_ring_t * ring)
 {
     if(!profiler_ctx->config.flush_cb) {
         LV_LOG_WARN("flush_cb is not registered");
+        ring->tail = LV_PROFILER_LOAD(&ring->head);
         return;
     }
 
-    uint32_t cur = 0;
+    uint32_t tail = ring->tail;
+    uint32_t head = LV_PROFILER_LOAD(&ring->head);
     char buf[LV_PROFILER_STR_MAX_LEN];
     uint32_t tick_per_sec = profiler_ctx->config.tick_per_sec;
-    while(cur < profiler_ctx->cur_index) {
-        lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur++];
+    bool json = profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON;
+    int tid = ring->tid;
+
+    while(tail != head) {
+        lv_profiler_builtin_item_t * item = &ring->item_arr[tail % profiler_ctx->item_num];
+        tail++;
+
         uint64_t sec = item->tick / tick_per_sec;
         uint64_t nsec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
-
 #if LV_USE_OS
-        lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-%d [%d] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
-                    item->tid,
-                    item->cpu,
-                    sec,
-                    nsec,
-                    item->tag,
-                    item->func);
+        int cpu = item->cpu;
 #else
-        lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-1 [0] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
-                    sec,
-                    nsec,
-                    item->tag,
-                    item->func);
+        int cpu = 0;
 #endif
+
+        if(json) {
+            /*Time stamps are in microseconds*/
+            uint64_t usec = sec * 1000000 + nsec / 1000;
+            uint32_t usec_frac = (uint32_t)(nsec % 1000);
+            if(item->tag == 'C') {
+                lv_snprintf(buf, sizeof(buf),
+                            "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%" LV_PRIu64 ".%03" LV_PRIu32 ","
+                            "\"pid\":1,\"tid\":%d,\"args\":{\"value\":%" LV_PRId32 "}},\n",
+                            item->func, usec, usec_frac, tid, item->value);
+            }
+            else {
+                lv_snprintf(buf, sizeof(buf),
+                            "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%" LV_PRIu64 ".%03" LV_PRIu32 ","
+                            "\"pid\":1,\"tid\":%d},\n",
+                            item->func, item->tag, usec, usec_frac, tid);
+            }
+        }
+        else if(item->tag == 'C') {
+            lv_snprintf(buf, sizeof(buf),
+                        "   LVGL-%d [%d] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: C|1|%s|%" LV_PRId32 "\n",
+                        tid,
+                        cpu,
+                        sec,
+                        nsec,
+                        item->func,
+                        item->value);
+        }
+        else {
+            lv_snprintf(buf, sizeof(buf),
+                        "   LVGL-%d [%d] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
+                        tid,
+                        cpu,
+                        sec,
+                        nsec,
+                        item->tag,
+                        item->func);
+        }
         profiler_ctx->config.flush_cb(buf);
     }
+
+    /*Let the writer reuse the flushed items*/
+    LV_PROFILER_STORE(&ring->tail, tail);
 }
 
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -28,11 +28,20 @@ extern "C" {
 #define LV_PROFILER_BUILTIN_END_TAG(tag)    lv_profiler_builtin_write((tag), 'E')
 #define LV_PROFILER_BUILTIN_BEGIN           LV_PROFILER_BUILTIN_BEGIN_TAG(__func__)
 #define LV_PROFILER_BUILTIN_END             LV_PROFILER_BUILTIN_END_TAG(__func__)
+#define LV_PROFILER_BUILTIN_COUNTER(name, value) lv_profiler_builtin_counter((name), (value))
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Output format of the built-in profiler
+ */
+typedef enum {
+    LV_PROFILER_BUILTIN_FORMAT_FTRACE,      /**< Android systrace (ftrace) text, one line per event*/
+    LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON, /**< Chrome Trace Event JSON, can be opened directly by Perfetto*/
+} lv_profiler_builtin_format_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -61,7 +70,9 @@ void lv_profiler_builtin_uninit(void);
 void lv_profiler_builtin_set_enable(bool enable);
 
 /**
- * @brief Flush the profiling data to the console
+ * @brief Flush the profiling data of all threads to the console
+ * @note Can be called periodically from a low priority thread so that the threads
+ *       being measured don't need to flush their buffers when they become full.
  */
 void lv_profiler_builtin_flush(void);
 
@@ -72,6 +83,13 @@ void lv_profiler_builtin_flush(void);
  */
 void lv_profiler_builtin_write(const char * func, char tag);
 
+/**
+ * @brief Record the current value of a counter, e.g. memory usage or number of draw tasks
+ * @param name Name of the counter
+ * @param value The current value of the counter
+ */
+void lv_profiler_builtin_counter(const char * name, int32_t value);
+
 /**********************
  *      MACROS
  **********************/
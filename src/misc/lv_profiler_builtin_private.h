@@ -34,8 +34,10 @@ struct _lv_profiler_builtin_config_t {
     uint32_t tick_per_sec;              /**< The number of ticks per second */
     uint64_t (*tick_get_cb)(void);      /**< Callback function to get the current tick count */
     void (*flush_cb)(const char * buf); /**< Callback function to flush the profiling data */
-    int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
+    int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID (must not be 0).
+                                         *   If it's set, each thread records into its own buffer without locking. */
     int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
+    lv_profiler_builtin_format_t format; /**< Format of the flushed data */
 };
 
 
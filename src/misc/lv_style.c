@@ -20,6 +20,13 @@
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
 
+/*The objects might have cached the old values of the properties*/
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #define RESOLVED_CACHE_INVALIDATE() LV_GLOBAL_DEFAULT()->style_resolved_cache_epoch++
+#else
+    #define RESOLVED_CACHE_INVALIDATE() do {} while(0)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -190,6 +197,12 @@ void lv_style_init(lv_style_t * style)
 }
 
 void lv_style_reset(lv_style_t * style)
+{
+    lv_style_reset_core(style);
+    RESOLVED_CACHE_INVALIDATE();
+}
+
+void lv_style_reset_core(lv_style_t * style)
 {
     LV_ASSERT_STYLE(style);
 
@@ -272,6 +285,19 @@ lv_style_prop_t lv_style_get_num_custom_props(void)
 }
 
 bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
+{
+    bool res = lv_style_remove_prop_core(style, prop);
+    if(res) RESOLVED_CACHE_INVALIDATE();
+    return res;
+}
+
+void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+    lv_style_set_prop_core(style, prop, value);
+    RESOLVED_CACHE_INVALIDATE();
+}
+
+bool lv_style_remove_prop_core(lv_style_t * style, lv_style_prop_t prop)
 {
     LV_ASSERT_STYLE(style);
 
@@ -324,7 +350,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
     return false;
 }
 
-void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+void lv_style_set_prop_core(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
 {
     LV_ASSERT_STYLE(style);
 
@@ -28,6 +28,33 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Clear all properties from a style and free all allocated memories without invalidating
+ * the resolved style values cached in all the objects. Used for the local and transition
+ * styles of an object.
+ * @param style pointer to a style
+ */
+void lv_style_reset_core(lv_style_t * style);
+
+/**
+ * Set the value of property in a style without invalidating the resolved style values
+ * cached in all the objects. Used for the local and transition styles of an object
+ * as only that object needs to be refreshed.
+ * @param style pointer to style
+ * @param prop the ID of a property (e.g. `LV_STYLE_BG_COLOR`)
+ * @param value `lv_style_value_t` variable in which a field is set according to the type of `prop`
+ */
+void lv_style_set_prop_core(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+
+/**
+ * Remove a property from a style without invalidating the resolved style values
+ * cached in all the objects. Used for the local and transition styles of an object.
+ * @param style pointer to a style
+ * @param prop  a style property ORed with a state.
+ * @return true: the property was found and removed; false: the property wasn't found
+ */
+bool lv_style_remove_prop_core(lv_style_t * style, lv_style_prop_t prop);
+
 /**********************
  *      MACROS
  **********************/
@@ -12,6 +12,7 @@
 #include "../stdlib/lv_sprintf.h"
 #include "lv_assert.h"
 #include "lv_ll.h"
+#include "lv_math.h"
 #include "lv_profiler.h"
 
 /*********************
@@ -20,6 +21,8 @@
 
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define NOT_SCHEDULED UINT32_MAX
+#define HEAP_MIN_CAPACITY 8
 
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
@@ -34,6 +37,16 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static uint32_t heap_get_remaining(lv_timer_t * timer, uint32_t now);
+static bool heap_is_before(lv_timer_t * a, lv_timer_t * b, uint32_t now);
+static void heap_set(uint32_t index, lv_timer_t * timer);
+static void heap_sift_up(uint32_t index, uint32_t now);
+static void heap_sift_down(uint32_t index, uint32_t now);
+static bool heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_move_top_to_ran(void);
+static void heap_add_back_ran(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,43 +103,21 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
+    /*Run the ready timers from the top of the heap.
+     *They are moved after the heap to run them only once even if they are ready again.*/
+    while(state_p->heap_size > 0) {
+        lv_timer_t * timer_active = state_p->heap[0];
+        if(heap_get_remaining(timer_active, lv_tick_get()) > 0) break;
 
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
+        heap_move_top_to_ran();
+        state_p->timer_deleted = false;
+        lv_timer_exec(timer_active);
+    }
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+    heap_add_back_ran();
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
-    }
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_size > 0) time_until_next = lv_timer_time_remaining(state_p->heap[0]);
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -177,8 +168,14 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->seq = state.seq_cnt++;
+    new_timer->heap_index = NOT_SCHEDULED;
 
-    state.timer_created = true;
+    if(!heap_insert(new_timer)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
 
     lv_timer_handler_resume();
 
@@ -193,6 +190,7 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    heap_remove(timer);
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +201,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    if(timer->heap_index == NOT_SCHEDULED) heap_insert(timer);
     lv_timer_handler_resume();
 }
 
@@ -216,18 +216,21 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+    heap_update(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +249,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -260,6 +264,12 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_size = 0;
+    state.heap_ran_cnt = 0;
+    state.heap_capacity = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -381,6 +391,177 @@ static void lv_timer_handler_resume(void)
     }
 }
 
+/**
+ * Get the remaining time of a timer to order the heap.
+ * Timers whose repeat count is over are ready to delete or pause them.
+ * @param timer     pointer to lv_timer
+ * @param now       the current tick
+ * @return          the time remaining, or 0 if it needs to be run
+ */
+static uint32_t heap_get_remaining(lv_timer_t * timer, uint32_t now)
+{
+    if(timer->repeat_count == 0) return 0;
+
+    uint32_t elp = now - timer->last_run;
+    if(elp >= timer->period) return 0;
+    return timer->period - elp;
+}
+
+/**
+ * Check if a timer should run before an other one.
+ * If both are ready, the newer runs first as the timers were run from the newest before.
+ * @param a         pointer to lv_timer
+ * @param b         pointer to an other lv_timer
+ * @param now       the current tick
+ * @return          true: `a` should run first
+ */
+static bool heap_is_before(lv_timer_t * a, lv_timer_t * b, uint32_t now)
+{
+    uint32_t a_remaining = heap_get_remaining(a, now);
+    uint32_t b_remaining = heap_get_remaining(b, now);
+    if(a_remaining != b_remaining) return a_remaining < b_remaining;
+
+    return (int32_t)(a->seq - b->seq) > 0;
+}
+
+static void heap_set(uint32_t index, lv_timer_t * timer)
+{
+    state.heap[index] = timer;
+    timer->heap_index = index;
+}
+
+static void heap_sift_up(uint32_t index, uint32_t now)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[index];
+    while(index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if(!heap_is_before(timer, heap[parent], now)) break;
+        heap_set(index, heap[parent]);
+        index = parent;
+    }
+    heap_set(index, timer);
+}
+
+static void heap_sift_down(uint32_t index, uint32_t now)
+{
+    lv_timer_t ** heap = state.heap;
+    uint32_t size = state.heap_size;
+    lv_timer_t * timer = heap[index];
+    while(1) {
+        uint32_t child = index * 2 + 1;
+        if(child >= size) break;
+        if(child + 1 < size && heap_is_before(heap[child + 1], heap[child], now)) child++;
+        if(!heap_is_before(heap[child], timer, now)) break;
+        heap_set(index, heap[child]);
+        index = child;
+    }
+    heap_set(index, timer);
+}
+
+/**
+ * Add a timer to the heap
+ * @param timer     pointer to a not scheduled lv_timer
+ * @return          false if the heap couldn't be enlarged
+ */
+static bool heap_insert(lv_timer_t * timer)
+{
+    uint32_t total = state.heap_size + state.heap_ran_cnt;
+    if(total == state.heap_capacity) {
+        uint32_t new_capacity = LV_MAX(state.heap_capacity * 2, HEAP_MIN_CAPACITY);
+        lv_timer_t ** new_heap = lv_realloc(state.heap, new_capacity * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+        state.heap = new_heap;
+        state.heap_capacity = new_capacity;
+    }
+
+    /*Make room for the new timer by moving the first ran timer to the end*/
+    if(state.heap_ran_cnt > 0) heap_set(total, state.heap[state.heap_size]);
+
+    uint32_t index = state.heap_size;
+    state.heap_size++;
+    state.heap[index] = timer;
+    heap_sift_up(index, lv_tick_get());
+
+    return true;
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    if(index == NOT_SCHEDULED) return;
+    timer->heap_index = NOT_SCHEDULED;
+
+    if(index >= state.heap_size) {
+        /*It already ran, replace it with the last ran timer*/
+        uint32_t last = state.heap_size + state.heap_ran_cnt - 1;
+        if(index != last) heap_set(index, state.heap[last]);
+        state.heap_ran_cnt--;
+        return;
+    }
+
+    state.heap_size--;
+    uint32_t last = state.heap_size;
+    lv_timer_t * last_timer = state.heap[last];
+
+    /*Keep the ran timers right after the heap*/
+    if(state.heap_ran_cnt > 0) heap_set(last, state.heap[last + state.heap_ran_cnt]);
+
+    if(index != last) {
+        uint32_t now = lv_tick_get();
+        state.heap[index] = last_timer;
+        heap_sift_up(index, now);
+        heap_sift_down(last_timer->heap_index, now);
+    }
+}
+
+/**
+ * Restore the order of the heap after the remaining time of a timer has changed
+ * @param timer     pointer to lv_timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    if(index >= state.heap_size) return;  /*Paused or already ran*/
+
+    uint32_t now = lv_tick_get();
+    heap_sift_up(index, now);
+    heap_sift_down(timer->heap_index, now);
+}
+
+/**
+ * Move the first timer of the heap after the heap before running it
+ */
+static void heap_move_top_to_ran(void)
+{
+    lv_timer_t * top = state.heap[0];
+    state.heap_size--;
+    uint32_t last = state.heap_size;
+
+    if(last > 0) {
+        state.heap[0] = state.heap[last];
+        heap_sift_down(0, lv_tick_get());
+    }
+
+    /*The freed slot is right before the ran timers*/
+    heap_set(last, top);
+    state.heap_ran_cnt++;
+}
+
+/**
+ * Add the timers which ran in this `lv_timer_handler()` call back to the heap
+ */
+static void heap_add_back_ran(void)
+{
+    uint32_t now = lv_tick_get();
+    while(state.heap_ran_cnt > 0) {
+        state.heap_ran_cnt--;
+        state.heap_size++;
+        heap_sift_up(state.heap_size - 1, now);
+    }
+}
+
 void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data)
 {
     state.resume_cb = cb;
@@ -33,6 +33,8 @@ struct _lv_timer_t {
     lv_timer_cb_t timer_cb;    /**< Timer function */
     void * user_data;          /**< Custom user data */
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
+    uint32_t heap_index;       /**< Index in the heap of the scheduled timers */
+    uint32_t seq;              /**< Creation order to run the newer timers first if they are ready together */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
 };
@@ -40,10 +42,20 @@ struct _lv_timer_t {
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
 
+    /**
+     * Binary min-heap of the not paused timers ordered by their remaining time.
+     * The timers which already ran in the current `lv_timer_handler()` call are stored
+     * after the heap and are added back to it when the handler finishes.
+     */
+    lv_timer_t ** heap;
+    uint32_t heap_size;        /**< Number of timers in the heap */
+    uint32_t heap_ran_cnt;     /**< Number of timers stored after the heap */
+    uint32_t heap_capacity;
+    uint32_t seq_cnt;
+
     bool lv_timer_run;
     uint8_t idle_last;
     bool timer_deleted;
-    bool timer_created;
     uint32_t timer_time_until_next;
 
     bool already_running;
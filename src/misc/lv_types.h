@@ -119,6 +119,7 @@ typedef struct _lv_display_t lv_display_t;
 typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
+typedef struct _lv_draw_task_index_t lv_draw_task_index_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
@@ -175,6 +176,7 @@ typedef struct _lv_image_header_cache_data_t lv_image_header_cache_data_t;
 typedef struct _lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct _lv_draw_label_hint_t lv_draw_label_hint_t;
+typedef struct _lv_draw_label_lines_t lv_draw_label_lines_t;
 
 typedef struct _lv_draw_glyph_dsc_t lv_draw_glyph_dsc_t;
 
@@ -186,6 +188,10 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_resolved_cache_t lv_obj_style_resolved_cache_t;
+
+typedef struct _lv_obj_child_index_t lv_obj_child_index_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
@@ -353,6 +359,8 @@ typedef uint32_t lv_prop_id_t;
 
 typedef struct _lv_array_t lv_array_t;
 
+typedef struct _lv_arena_t lv_arena_t;
+
 typedef struct _lv_iter_t lv_iter_t;
 
 typedef struct _lv_circle_buf_t lv_circle_buf_t;
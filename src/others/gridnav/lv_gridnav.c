@@ -389,11 +389,13 @@ static bool obj_is_focusable(lv_obj_t * obj)
 
 static int32_t get_x_center(lv_obj_t * obj)
 {
+    lv_obj_sync_coords(obj);
     return obj->coords.x1 + lv_area_get_width(&obj->coords) / 2;
 }
 
 static int32_t get_y_center(lv_obj_t * obj)
 {
+    lv_obj_sync_coords(obj);
     return obj->coords.y1 + lv_area_get_height(&obj->coords) / 2;
 }
 
@@ -17,6 +17,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../../widgets/label/lv_label.h"
 #include "../../display/lv_display_private.h"
+#include "../../draw/lv_draw_private.h"
 
 /*********************
  *      DEFINES
@@ -43,6 +44,10 @@
     static void perf_monitor_disp_event_cb(lv_event_t * e);
     static void perf_dump_info(lv_display_t * disp);
     static void perf_control(lv_display_t * disp, bool start);
+    static void perf_frame_start(lv_sysmon_perf_info_t * info);
+    static void perf_frame_ready(lv_sysmon_perf_info_t * info);
+    static void histogram_add(lv_sysmon_histogram_t * hist, uint32_t value);
+    static void histogram_get_latency(const lv_sysmon_histogram_t * hist, lv_sysmon_latency_t * latency);
 #endif
 
 #if LV_USE_MEM_MONITOR
@@ -54,6 +59,19 @@
  *  STATIC VARIABLES
  **********************/
 
+#if LV_USE_PERF_MONITOR
+/*Upper limit of the histogram buckets [ms]. Dense around the typical frame times to get useful percentiles.*/
+static const uint32_t histogram_limits[LV_SYSMON_HISTOGRAM_BUCKET_CNT] = {
+    0, 1, 2, 3, 4, 6, 8, 12, 16, 20, 25, 33, 50, 66, 100, UINT32_MAX
+};
+
+#if LV_USE_PERF_MONITOR_LOG_MODE
+static const char * const stage_names[LV_SYSMON_STAGE_CNT] = {
+    "frame", "layout", "render", "dispatch wait", "flush"
+};
+#endif
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -149,6 +167,31 @@ void lv_sysmon_performance_dump(lv_display_t * disp)
     perf_dump_info(disp);
 }
 
+lv_subject_t * lv_sysmon_get_performance_subject(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        LV_LOG_WARN("There is no default display");
+        return NULL;
+    }
+
+    /*The subject is initialized with the label*/
+    if(disp->perf_label == NULL) return NULL;
+
+    return &disp->perf_sysmon_backend.subject;
+}
+
+void lv_sysmon_performance_reset_latency(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        LV_LOG_WARN("There is no default display");
+        return;
+    }
+
+    lv_memzero(&disp->perf_sysmon_info.histograms, sizeof(disp->perf_sysmon_info.histograms));
+}
+
 void lv_sysmon_performance_resume(lv_display_t * disp)
 {
     perf_control(disp, true);
@@ -214,19 +257,24 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
         case LV_EVENT_REFR_START:
             info->measured.refr_interval_sum += lv_tick_elaps(info->measured.refr_start);
             info->measured.refr_start = lv_tick_get();
+            perf_frame_start(info);
             break;
         case LV_EVENT_REFR_READY:
             info->measured.refr_elaps_sum += lv_tick_elaps(info->measured.refr_start);
             info->measured.refr_cnt++;
+            perf_frame_ready(info);
             break;
         case LV_EVENT_RENDER_START:
             info->measured.render_in_progress = 1;
             info->measured.render_start = lv_tick_get();
+            info->frame.rendered = 1;
+            info->frame.render_start = info->measured.render_start;
             break;
         case LV_EVENT_RENDER_READY:
             info->measured.render_in_progress = 0;
             info->measured.render_elaps_sum += lv_tick_elaps(info->measured.render_start);
             info->measured.render_cnt++;
+            info->frame.render_time += lv_tick_elaps(info->frame.render_start);
             break;
         case LV_EVENT_FLUSH_START:
         case LV_EVENT_FLUSH_WAIT_START:
@@ -240,10 +288,14 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
         case LV_EVENT_FLUSH_FINISH:
         case LV_EVENT_FLUSH_WAIT_FINISH:
             if(info->measured.render_in_progress) {
-                info->measured.flush_in_render_elaps_sum += lv_tick_elaps(info->measured.flush_in_render_start);
+                uint32_t elaps = lv_tick_elaps(info->measured.flush_in_render_start);
+                info->measured.flush_in_render_elaps_sum += elaps;
+                info->frame.flush_in_render_time += elaps;
             }
             else {
-                info->measured.flush_not_in_render_elaps_sum += lv_tick_elaps(info->measured.flush_not_in_render_start);
+                uint32_t elaps = lv_tick_elaps(info->measured.flush_not_in_render_start);
+                info->measured.flush_not_in_render_elaps_sum += elaps;
+                info->frame.flush_not_in_render_time += elaps;
             }
             break;
         case LV_EVENT_DELETE:
@@ -291,17 +343,53 @@ static void perf_dump_info(lv_display_t * disp)
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.fps) / info->calculated.run_cnt;
 
+    info->calculated.inv_px = disp->inv_px_sum;
+    info->calculated.redrawn_px = disp->redrawn_px_sum;
+    disp->inv_px_sum = 0;
+    disp->redrawn_px_sum = 0;
+
+    info->calculated.stripe_cnt = disp->stripe_cnt;
+    info->calculated.stripe_overlap = disp->stripe_cnt ? (100 * disp->stripe_overlap_cnt / disp->stripe_cnt) : 0;
+    disp->stripe_cnt = 0;
+    disp->stripe_overlap_cnt = 0;
+
+#if LV_DRAW_ARENA_SIZE
+    info->calculated.draw_arena_used_max = disp->draw_arena.used_max;
+    info->calculated.draw_arena_alloc_cnt = disp->draw_arena.alloc_cnt;
+    info->calculated.draw_arena_fallback_cnt = disp->draw_arena.fallback_cnt;
+    lv_arena_reset_stat(&disp->draw_arena);
+#endif
+
+    uint32_t i;
+    for(i = 0; i < LV_SYSMON_STAGE_CNT; i++) {
+        histogram_get_latency(&info->histograms.stage[i], &info->calculated.stage_latency[i]);
+    }
+
+    info->calculated.draw_unit_cnt = LV_MIN(lv_draw_get_unit_count(), LV_SYSMON_DRAW_UNIT_MAX);
+    for(i = 0; i < info->calculated.draw_unit_cnt; i++) {
+        histogram_get_latency(&info->histograms.draw_unit[i], &info->calculated.draw_unit_latency[i]);
+    }
+
     lv_subject_set_pointer(&disp->perf_sysmon_backend.subject, info);
 
-    lv_sysmon_perf_info_t prev_info = *info;
-    lv_memzero(info, sizeof(lv_sysmon_perf_info_t));
-    info->measured.refr_start = prev_info.measured.refr_start;
-    info->calculated.cpu_avg_total = prev_info.calculated.cpu_avg_total;
+    /*Start a new period but keep the totals, the current frame and the histograms*/
+    uint32_t refr_start = info->measured.refr_start;
+    uint32_t cpu_avg_total = info->calculated.cpu_avg_total;
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
-    info->calculated.cpu_proc = prev_info.calculated.cpu_proc;
+    uint32_t cpu_proc = info->calculated.cpu_proc;
 #endif  /*LV_SYSMON_PROC_IDLE_AVAILABLE*/
-    info->calculated.fps_avg_total = prev_info.calculated.fps_avg_total;
-    info->calculated.run_cnt = prev_info.calculated.run_cnt;
+    uint32_t fps_avg_total = info->calculated.fps_avg_total;
+    uint32_t run_cnt = info->calculated.run_cnt;
+
+    lv_memzero(&info->measured, sizeof(info->measured));
+    lv_memzero(&info->calculated, sizeof(info->calculated));
+    info->measured.refr_start = refr_start;
+    info->calculated.cpu_avg_total = cpu_avg_total;
+#if LV_SYSMON_PROC_IDLE_AVAILABLE
+    info->calculated.cpu_proc = cpu_proc;
+#endif  /*LV_SYSMON_PROC_IDLE_AVAILABLE*/
+    info->calculated.fps_avg_total = fps_avg_total;
+    info->calculated.run_cnt = run_cnt;
 
     info->measured.last_report_timestamp = lv_tick_get();
 }
@@ -326,6 +414,29 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
            perf->calculated.cpu);
+    LV_LOG("sysmon: redrawn %" LV_PRIu32 " px for %" LV_PRIu32 " invalidated px\n",
+           perf->calculated.redrawn_px, perf->calculated.inv_px);
+    if(perf->calculated.stripe_cnt) {
+        LV_LOG("sysmon: pipeline %" LV_PRIu32 " stripes, %" LV_PRIu32 "%% overlapped\n",
+               perf->calculated.stripe_cnt, perf->calculated.stripe_overlap);
+    }
+#if LV_DRAW_ARENA_SIZE
+    LV_LOG("sysmon: draw arena %" LV_PRIu32 "/%d bytes (alloc: %" LV_PRIu32 " | fallback: %" LV_PRIu32 ")\n",
+           perf->calculated.draw_arena_used_max, LV_DRAW_ARENA_SIZE,
+           perf->calculated.draw_arena_alloc_cnt, perf->calculated.draw_arena_fallback_cnt);
+#endif
+    uint32_t i;
+    for(i = 0; i < LV_SYSMON_STAGE_CNT; i++) {
+        const lv_sysmon_latency_t * l = &perf->calculated.stage_latency[i];
+        LV_LOG("sysmon: %s p50 %" LV_PRIu32 " | p95 %" LV_PRIu32 " | p99 %" LV_PRIu32 " | max %" LV_PRIu32 " ms\n",
+               stage_names[i], l->p50, l->p95, l->p99, l->max);
+    }
+    for(i = 0; i < perf->calculated.draw_unit_cnt; i++) {
+        const lv_sysmon_latency_t * l = &perf->calculated.draw_unit_latency[i];
+        LV_LOG("sysmon: draw unit %" LV_PRIu32 " busy p50 %" LV_PRIu32 " | p95 %" LV_PRIu32 " | p99 %" LV_PRIu32
+               " | max %" LV_PRIu32 " ms\n",
+               i, l->p50, l->p95, l->p99, l->max);
+    }
 #else
     lv_obj_t * label = lv_observer_get_target(observer);
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
@@ -368,6 +479,95 @@ static void perf_control(lv_display_t * disp, bool start)
     }
 }
 
+/**
+ * Reset the stage durations of the refresh which is being started
+ * @param info      pointer to the performance info of the display
+ */
+static void perf_frame_start(lv_sysmon_perf_info_t * info)
+{
+    lv_memzero(&info->frame, sizeof(info->frame));
+
+    /*The draw units only count their busy time so save the current values*/
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    uint32_t i;
+    for(i = 0; u && i < LV_SYSMON_DRAW_UNIT_MAX; i++, u = u->next) {
+        info->frame.unit_busy_start[i] = lv_draw_unit_get_busy_time(u);
+    }
+}
+
+/**
+ * Add the stage durations of the finished refresh to the histograms
+ * @param info      pointer to the performance info of the display
+ */
+static void perf_frame_ready(lv_sysmon_perf_info_t * info)
+{
+    /*Nothing was rendered, it would only distort the statistics*/
+    if(!info->frame.rendered) return;
+
+    lv_sysmon_histogram_t * hist = info->histograms.stage;
+    uint32_t frame_time = lv_tick_elaps(info->measured.refr_start);
+
+    /*The flush and the waiting are measured during rendering too so subtract them*/
+    uint32_t render_time = info->frame.render_time;
+    uint32_t not_render_time = info->frame.flush_in_render_time + info->frame.dispatch_wait_time;
+    render_time = render_time > not_render_time ? render_time - not_render_time : 0;
+
+    histogram_add(&hist[LV_SYSMON_STAGE_FRAME], frame_time);
+    histogram_add(&hist[LV_SYSMON_STAGE_LAYOUT], info->frame.layout_time);
+    histogram_add(&hist[LV_SYSMON_STAGE_RENDER], render_time);
+    histogram_add(&hist[LV_SYSMON_STAGE_DISPATCH_WAIT], info->frame.dispatch_wait_time);
+    histogram_add(&hist[LV_SYSMON_STAGE_FLUSH],
+                  info->frame.flush_in_render_time + info->frame.flush_not_in_render_time);
+
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    uint32_t i;
+    for(i = 0; u && i < LV_SYSMON_DRAW_UNIT_MAX; i++, u = u->next) {
+        histogram_add(&info->histograms.draw_unit[i], lv_draw_unit_get_busy_time(u) - info->frame.unit_busy_start[i]);
+    }
+}
+
+/**
+ * Add a duration to a histogram
+ * @param hist      pointer to a histogram
+ * @param value     the duration [ms]
+ */
+static void histogram_add(lv_sysmon_histogram_t * hist, uint32_t value)
+{
+    uint32_t i;
+    for(i = 0; value > histogram_limits[i]; i++) {}
+
+    hist->bucket_cnt[i]++;
+    hist->sample_cnt++;
+    if(value > hist->max) hist->max = value;
+}
+
+/**
+ * Get the percentiles of a histogram. The upper limit of the bucket of a percentile is used
+ * so the real values are smaller or equal.
+ * @param hist      pointer to a histogram
+ * @param latency   store the result here
+ */
+static void histogram_get_latency(const lv_sysmon_histogram_t * hist, lv_sysmon_latency_t * latency)
+{
+    static const uint32_t percents[3] = {50, 95, 99};
+    uint32_t * results[3] = {&latency->p50, &latency->p95, &latency->p99};
+
+    uint32_t b = 0;
+    uint32_t sum = hist->bucket_cnt[0];
+    uint32_t p;
+    for(p = 0; p < 3; p++) {
+        /*Index of the sample at the given percentile, rounded up*/
+        uint32_t target = (uint32_t)(((uint64_t)hist->sample_cnt * percents[p] + 99) / 100);
+        while(sum < target && b < LV_SYSMON_HISTOGRAM_BUCKET_CNT - 1) {
+            b++;
+            sum += hist->bucket_cnt[b];
+        }
+        *results[p] = LV_MIN(histogram_limits[b], hist->max);
+    }
+
+    latency->max = hist->max;
+}
+
 #endif
 
 #if LV_USE_MEM_MONITOR
@@ -376,6 +576,7 @@ static void mem_update_timer_cb(lv_timer_t * t)
 {
     lv_mem_monitor_t * mem_mon = lv_timer_get_user_data(t);
     lv_mem_monitor(mem_mon);
+    LV_PROFILER_COUNTER("mem_used", (int32_t)(mem_mon->total_size - mem_mon->free_size));
     lv_subject_set_pointer(&sysmon_mem.subject, mem_mon);
 }
 
@@ -35,6 +35,19 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_PERF_MONITOR
+/** Stages of a refresh whose durations are recorded in histograms*/
+typedef enum {
+    LV_SYSMON_STAGE_FRAME,          /**< The whole refresh*/
+    LV_SYSMON_STAGE_LAYOUT,         /**< Updating the layouts*/
+    LV_SYSMON_STAGE_RENDER,         /**< Walking the widget tree and creating the draw tasks.
+                                     *   Without an OS the draw units draw here too.*/
+    LV_SYSMON_STAGE_DISPATCH_WAIT,  /**< Waiting for the draw units to finish the draw tasks*/
+    LV_SYSMON_STAGE_FLUSH,          /**< Flushing and waiting for the flush to be finished*/
+    LV_SYSMON_STAGE_CNT,
+} lv_sysmon_stage_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -66,6 +79,21 @@ void lv_sysmon_hide_performance(lv_display_t * disp);
  */
 void lv_sysmon_performance_dump(lv_display_t * disp);
 
+/**
+ * Get the subject which is notified with the `lv_sysmon_perf_info_t` of the display in every report period.
+ * It also contains the p50/p95/p99/max durations of the refresh stages.
+ * @param disp      target display, NULL: use the default
+ * @return          pointer to the subject or NULL if `lv_sysmon_show_performance` wasn't called for the display
+ */
+lv_subject_t * lv_sysmon_get_performance_subject(lv_display_t * disp);
+
+/**
+ * Clear the histograms of the refresh stages' durations.
+ * The histograms collect all the refreshes since the performance monitor was shown or this function was called.
+ * @param disp      target display, NULL: use the default
+ */
+void lv_sysmon_performance_reset_latency(lv_display_t * disp);
+
 /**
  * Resume the system performance monitor.
  * @param disp      target display, NULL: use the default
@@ -22,6 +22,12 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of buckets of the latency histograms*/
+#define LV_SYSMON_HISTOGRAM_BUCKET_CNT  16
+
+/** Max. number of draw units whose busy time is recorded in a histogram*/
+#define LV_SYSMON_DRAW_UNIT_MAX         4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +38,25 @@ struct _lv_sysmon_backend_data_t {
 };
 
 #if LV_USE_PERF_MONITOR
+
+/**
+ * Histogram of the durations of a refresh stage with logarithmic-like buckets.
+ * The bucket limits are in `lv_sysmon.c`.
+ */
+typedef struct {
+    uint32_t bucket_cnt[LV_SYSMON_HISTOGRAM_BUCKET_CNT];
+    uint32_t sample_cnt;
+    uint32_t max;
+} lv_sysmon_histogram_t;
+
+/** Percentiles of a histogram [ms]*/
+typedef struct {
+    uint32_t p50;
+    uint32_t p95;
+    uint32_t p99;
+    uint32_t max;
+} lv_sysmon_latency_t;
+
 struct _lv_sysmon_perf_info_t {
     struct {
         bool inited;
@@ -50,6 +75,24 @@ struct _lv_sysmon_perf_info_t {
         uint32_t render_in_progress : 1;
     } measured;
 
+    /** Stage durations of the current refresh, added to the histograms when the refresh is ready*/
+    struct {
+        uint32_t layout_time;
+        uint32_t dispatch_wait_time;
+        uint32_t flush_in_render_time;
+        uint32_t flush_not_in_render_time;
+        uint32_t render_start;
+        uint32_t render_time;
+        uint32_t unit_busy_start[LV_SYSMON_DRAW_UNIT_MAX];
+        uint32_t rendered : 1;
+    } frame;
+
+    /** Stage durations of all the rendered frames since the last `lv_sysmon_performance_reset_latency`*/
+    struct {
+        lv_sysmon_histogram_t stage[LV_SYSMON_STAGE_CNT];
+        lv_sysmon_histogram_t draw_unit[LV_SYSMON_DRAW_UNIT_MAX];   /**< Busy time of the draw units*/
+    } histograms;
+
     struct {
         uint32_t fps;
         uint32_t cpu;
@@ -62,6 +105,18 @@ struct _lv_sysmon_perf_info_t {
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
+        uint32_t inv_px;                    /**< Sum of the invalidated areas' size*/
+        uint32_t redrawn_px;                /**< Sum of the redrawn areas' size (after joining the invalidated areas)*/
+        uint32_t stripe_cnt;                /**< Number of stripes rendered with pipelined rendering*/
+        uint32_t stripe_overlap;            /**< Percentage of the stripes created while the previous one was drawn*/
+#if LV_DRAW_ARENA_SIZE
+        uint32_t draw_arena_used_max;       /**< Max. used bytes of the display's draw arena*/
+        uint32_t draw_arena_alloc_cnt;      /**< Number of allocations served by the draw arena*/
+        uint32_t draw_arena_fallback_cnt;   /**< Number of allocations which didn't fit into the draw arena*/
+#endif
+        lv_sysmon_latency_t stage_latency[LV_SYSMON_STAGE_CNT];          /**< Percentiles of the refresh stages*/
+        lv_sysmon_latency_t draw_unit_latency[LV_SYSMON_DRAW_UNIT_MAX];  /**< Percentiles of the draw units' busy time*/
+        uint32_t draw_unit_cnt;             /**< Number of draw units in `draw_unit_latency`*/
     } calculated;
 
 };
@@ -52,6 +52,9 @@
 #define xml_path_prefix LV_GLOBAL_DEFAULT()->xml_path_prefix
 #define lv_event_xml_store_timeline LV_GLOBAL_DEFAULT()->lv_event_xml_store_timeline
 
+/*Number of attributes of a view element which can be replayed without allocating memory*/
+#define LV_XML_VIEW_ATTRS_LOCAL_CNT 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -61,6 +64,7 @@
  **********************/
 static void view_start_element_handler(void * user_data, const char * name, const char ** attrs);
 static void view_end_element_handler(void * user_data, const char * name);
+static void replay_view(lv_xml_parser_state_t * state, const lv_xml_component_scope_t * scope);
 static void get_timeline_from_event_cb(lv_event_t * e);
 static void free_timelines_event_cb(lv_event_t * e);
 
@@ -182,21 +186,29 @@ void * lv_xml_create_in_scope(lv_obj_t * parent, lv_xml_component_scope_t * pare
     lv_obj_t ** parent_node = lv_ll_ins_head(&state.parent_ll);
     *parent_node = parent;
 
-    /* Create an XML parser and set handlers */
-    XML_Memory_Handling_Suite mem_handlers;
-    mem_handlers.malloc_fcn = lv_malloc;
-    mem_handlers.realloc_fcn = lv_realloc;
-    mem_handlers.free_fcn = lv_free;
-    XML_Parser parser = XML_ParserCreate_MM(NULL, &mem_handlers, NULL);
-    XML_SetUserData(parser, &state);
-    XML_SetElementHandler(parser, view_start_element_handler, view_end_element_handler);
-
-    /* Parse the XML */
-    if(XML_Parse(parser, scope->view_def, lv_strlen(scope->view_def), XML_TRUE) == XML_STATUS_ERROR) {
-        LV_LOG_WARN("XML parsing error: %s on line %lu", XML_ErrorString(XML_GetErrorCode(parser)),
-                    XML_GetCurrentLineNumber(parser));
+    if(!lv_array_is_empty(&scope->view_elements)) {
+        /* The view was compiled when the component was registered, no need to parse it again */
+        replay_view(&state, scope);
+    }
+    else {
+        /* Create an XML parser and set handlers */
+        XML_Memory_Handling_Suite mem_handlers;
+        mem_handlers.malloc_fcn = lv_malloc;
+        mem_handlers.realloc_fcn = lv_realloc;
+        mem_handlers.free_fcn = lv_free;
+        XML_Parser parser = XML_ParserCreate_MM(NULL, &mem_handlers, NULL);
+        XML_SetUserData(parser, &state);
+        XML_SetElementHandler(parser, view_start_element_handler, view_end_element_handler);
+
+        /* Parse the XML */
+        if(XML_Parse(parser, scope->view_def, lv_strlen(scope->view_def), XML_TRUE) == XML_STATUS_ERROR) {
+            LV_LOG_WARN("XML parsing error: %s on line %lu", XML_ErrorString(XML_GetErrorCode(parser)),
+                        XML_GetCurrentLineNumber(parser));
+            XML_ParserFree(parser);
+            lv_ll_clear(&state.parent_ll);
+            return NULL;
+        }
         XML_ParserFree(parser);
-        return NULL;
     }
 
     state.item = state.view;
@@ -244,7 +256,6 @@ void * lv_xml_create_in_scope(lv_obj_t * parent, lv_xml_component_scope_t * pare
     }
 
     lv_ll_clear(&state.parent_ll);
-    XML_ParserFree(parser);
 
     return state.view;
 }
@@ -809,6 +820,47 @@ static void view_end_element_handler(void * user_data, const char * name)
     }
 }
 
+/**
+ * Call the element handlers for the elements of a compiled view
+ * the same way as parsing the view's XML would do
+ * @param state     the parser state
+ * @param scope     the scope of the component with a compiled view
+ */
+static void replay_view(lv_xml_parser_state_t * state, const lv_xml_component_scope_t * scope)
+{
+    /*The handlers might modify the attributes (e.g. when resolving the params)
+     *so collect them into a buffer for each element*/
+    const char * attrs_local[LV_XML_VIEW_ATTRS_LOCAL_CNT * 2 + 1];
+    const char ** attrs = attrs_local;
+    if(scope->view_max_attr_cnt > LV_XML_VIEW_ATTRS_LOCAL_CNT) {
+        attrs = lv_malloc((scope->view_max_attr_cnt * 2 + 1) * sizeof(const char *));
+        LV_ASSERT_MALLOC(attrs);
+        if(attrs == NULL) return;
+    }
+
+    const char * str_pool = (const char *)scope->view_str_pool.data;
+    const uint32_t * attr_ofs = (const uint32_t *)scope->view_attr_ofs.data;
+    uint32_t element_cnt = lv_array_size(&scope->view_elements);
+    uint32_t i;
+    for(i = 0; i < element_cnt; i++) {
+        const lv_xml_view_element_t * element = lv_array_at(&scope->view_elements, i);
+        uint32_t a;
+        for(a = 0; a < element->attr_cnt * 2; a++) {
+            attrs[a] = str_pool + attr_ofs[element->attr_index + a];
+        }
+        attrs[a] = NULL;
+
+        view_start_element_handler(state, str_pool + element->name_ofs, attrs);
+
+        uint32_t e;
+        for(e = 0; e < element->end_cnt; e++) {
+            view_end_element_handler(state, NULL);
+        }
+    }
+
+    if(attrs != attrs_local) lv_free(attrs);
+}
+
 static void get_timeline_from_event_cb(lv_event_t * e)
 {
     void ** out = lv_event_get_param(e);
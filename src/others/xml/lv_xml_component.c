@@ -45,6 +45,10 @@ static void process_font_element(lv_xml_parser_state_t * state, const char * typ
 static void process_image_element(lv_xml_parser_state_t * state, const char * type, const char ** attrs);
 static void process_prop_element(lv_xml_parser_state_t * state, const char ** attrs);
 static char * extract_view_content(const char * xml_definition);
+static void compile_view(lv_xml_component_scope_t * scope);
+static void compile_start_element_handler(void * user_data, const char * name, const char ** attrs);
+static void compile_end_element_handler(void * user_data, const char * name);
+static uint32_t view_str_pool_add(lv_array_t * pool, const char * str);
 static style_prop_anim_type_t style_prop_anim_get_type(lv_style_prop_t prop);
 static int32_t anim_value_to_int(lv_style_prop_t prop_type, const char * value_str);
 static void int_anim_exec_cb(lv_anim_t * a, int32_t v);
@@ -184,6 +188,9 @@ lv_result_t lv_xml_component_register_from_data(const char * name, const char *
             lv_xml_component_unregister(name);
             return LV_RESULT_INVALID;
         }
+
+        /*Parse the view only once here and just replay the elements when the component is created*/
+        compile_view(scope);
     }
 
     return LV_RESULT_OK;
@@ -257,6 +264,9 @@ lv_result_t lv_xml_component_unregister(const char * name)
     lv_free((char *)scope->name);
     lv_free((char *)scope->view_def);
     lv_free((char *)scope->extends);
+    lv_array_deinit(&scope->view_elements);
+    lv_array_deinit(&scope->view_attr_ofs);
+    lv_array_deinit(&scope->view_str_pool);
 
     lv_xml_const_t * cnst;
     LV_LL_READ(&scope->const_ll, cnst) {
@@ -889,6 +899,104 @@ static char * extract_view_content(const char * xml_definition)
     return view_content;
 }
 
+/**
+ * Parse `view_def` into a list of elements which can be replayed without parsing the XML again
+ * @param scope     pointer to a component scope with `view_def` set
+ */
+static void compile_view(lv_xml_component_scope_t * scope)
+{
+    /*Every element starts with `<` and every attribute has an `=`,
+     *so with this capacity no reallocation is needed during compiling*/
+    uint32_t element_cap = 0;
+    uint32_t attr_cap = 0;
+    const char * c;
+    for(c = scope->view_def; *c; c++) {
+        if(*c == '<') element_cap++;
+        else if(*c == '=') attr_cap += 2;
+    }
+
+    lv_array_init(&scope->view_elements, element_cap, sizeof(lv_xml_view_element_t));
+    lv_array_init(&scope->view_attr_ofs, LV_MAX(attr_cap, 1), sizeof(uint32_t));
+    lv_array_init(&scope->view_str_pool, lv_strlen(scope->view_def) + 1, sizeof(char));
+    scope->view_max_attr_cnt = 0;
+
+    XML_Memory_Handling_Suite mem_handlers;
+    mem_handlers.malloc_fcn = lv_malloc;
+    mem_handlers.realloc_fcn = lv_realloc;
+    mem_handlers.free_fcn = lv_free;
+    XML_Parser parser = XML_ParserCreate_MM(NULL, &mem_handlers, NULL);
+    XML_SetUserData(parser, scope);
+    XML_SetElementHandler(parser, compile_start_element_handler, compile_end_element_handler);
+
+    if(XML_Parse(parser, scope->view_def, lv_strlen(scope->view_def), XML_TRUE) == XML_STATUS_ERROR) {
+        /*Leave it empty. The error will be reported when the view is parsed on creation*/
+        lv_array_deinit(&scope->view_elements);
+        lv_array_deinit(&scope->view_attr_ofs);
+        lv_array_deinit(&scope->view_str_pool);
+    }
+    else {
+        /*The compiled view is kept until the component is unregistered so free the unused capacity*/
+        lv_array_resize(&scope->view_elements, lv_array_size(&scope->view_elements));
+        lv_array_resize(&scope->view_str_pool, lv_array_size(&scope->view_str_pool));
+        if(!lv_array_is_empty(&scope->view_attr_ofs)) {
+            lv_array_resize(&scope->view_attr_ofs, lv_array_size(&scope->view_attr_ofs));
+        }
+    }
+
+    XML_ParserFree(parser);
+}
+
+static void compile_start_element_handler(void * user_data, const char * name, const char ** attrs)
+{
+    lv_xml_component_scope_t * scope = user_data;
+
+    lv_xml_view_element_t element;
+    element.name_ofs = view_str_pool_add(&scope->view_str_pool, name);
+    element.attr_index = lv_array_size(&scope->view_attr_ofs);
+    element.attr_cnt = 0;
+    element.end_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; attrs[i]; i++) {
+        uint32_t ofs = view_str_pool_add(&scope->view_str_pool, attrs[i]);
+        lv_array_push_back(&scope->view_attr_ofs, &ofs);
+    }
+    element.attr_cnt = i / 2;
+    if(element.attr_cnt > scope->view_max_attr_cnt) scope->view_max_attr_cnt = element.attr_cnt;
+
+    lv_array_push_back(&scope->view_elements, &element);
+}
+
+static void compile_end_element_handler(void * user_data, const char * name)
+{
+    LV_UNUSED(name);
+
+    lv_xml_component_scope_t * scope = user_data;
+
+    /*Elements are closed in reverse order, so it's enough to count
+     *how many elements are closed after the last opened one*/
+    lv_xml_view_element_t * element = lv_array_back(&scope->view_elements);
+    if(element) element->end_cnt++;
+}
+
+/**
+ * Copy a string to the end of the string pool
+ * @param pool      pointer to an array of `char`s
+ * @param str       the string to add
+ * @return          offset of the added string in the pool
+ */
+static uint32_t view_str_pool_add(lv_array_t * pool, const char * str)
+{
+    uint32_t ofs = lv_array_size(pool);
+    uint32_t len = lv_strlen(str) + 1;
+    if(ofs + len > lv_array_capacity(pool)) {
+        lv_array_resize(pool, LV_MAX(ofs + len, lv_array_capacity(pool) * 2));
+    }
+
+    lv_memcpy(pool->data + ofs, str, len);
+    pool->size += len;
+    return ofs;
+}
 
 static style_prop_anim_type_t style_prop_anim_get_type(lv_style_prop_t prop)
 {
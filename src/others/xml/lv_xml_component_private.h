@@ -18,6 +18,7 @@ extern "C" {
 
 #include "lv_xml_utils.h"
 #include "../../misc/lv_ll.h"
+#include "../../misc/lv_array.h"
 #include "../../misc/lv_style.h"
 #include "../../others/observer/lv_observer.h"
 
@@ -27,6 +28,17 @@ extern "C" {
 
 typedef  void * (*lv_xml_component_process_cb_t)(lv_obj_t * parent, const char * data, const char ** attrs);
 
+/**
+ * An element of the compiled view of a component.
+ * Replaying the elements in order calls the same element handlers as parsing `view_def`.
+ */
+typedef struct {
+    uint32_t name_ofs;      /**< Offset of the tag name in `view_str_pool`*/
+    uint32_t attr_index;    /**< Index of the first attribute name in `view_attr_ofs`*/
+    uint32_t attr_cnt;      /**< Number of attribute name-value pairs*/
+    uint32_t end_cnt;       /**< Number of elements closed right after this element*/
+} lv_xml_view_element_t;
+
 struct _lv_xml_component_scope_t {
     const char * name;
     lv_ll_t style_ll;
@@ -39,6 +51,10 @@ struct _lv_xml_component_scope_t {
     lv_ll_t image_ll;
     lv_ll_t event_ll;
     const char * view_def;
+    lv_array_t view_elements;   /**< `lv_xml_view_element_t`s compiled from `view_def`. Empty if it couldn't be compiled*/
+    lv_array_t view_attr_ofs;   /**< `uint32_t` offsets of the attribute names and values in `view_str_pool`*/
+    lv_array_t view_str_pool;   /**< The tag names and attributes of the view as `\0` terminated strings*/
+    uint32_t view_max_attr_cnt; /**< The most attribute name-value pairs on an element of the view*/
     const char * extends;
     uint32_t is_widget : 1;
     uint32_t is_screen : 1;
@@ -38,6 +38,41 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_USE_OS && LV_MEM_THREAD_ARENA_CNT
+    #define USE_THREAD_ARENAS   1
+    #define ARENA_SIZE          (LV_MEM_THREAD_ARENA_SIZE & ~ALIGN_MASK)
+    #if LV_MEM_THREAD_ARENA_CNT * LV_MEM_THREAD_ARENA_SIZE >= LV_MEM_SIZE
+        #error "The thread arenas don't fit into LV_MEM_SIZE"
+    #endif
+
+    #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+        #define THREAD_LOCAL _Thread_local
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define THREAD_LOCAL __thread
+    #elif defined(_MSC_VER)
+        #define THREAD_LOCAL __declspec(thread)
+    #else
+        #error "LV_MEM_THREAD_ARENA_CNT requires thread local storage"
+    #endif
+
+    #define ARENA_ID_NONE   0   /*The thread has no arena assigned yet*/
+    #define ARENA_ID_MAIN   1   /*The thread uses the main pool*/
+
+    /*The blocks freed by other threads are pushed to the arena's `remote_free` list without locking
+     *and the arena frees them on its next allocation. Without atomic operations the arena is locked.*/
+    #if defined(__GNUC__) || defined(__clang__)
+        #define USE_REMOTE_FREE     1
+        #define REMOTE_FREE_LOAD(p)                 __atomic_load_n((p), __ATOMIC_RELAXED)
+        #define REMOTE_FREE_PUSH(p, expected, v)    __atomic_compare_exchange_n((p), &(expected), (v), true, \
+                                                                                __ATOMIC_RELEASE, __ATOMIC_RELAXED)
+        #define REMOTE_FREE_TAKE_ALL(p)             __atomic_exchange_n((p), NULL, __ATOMIC_ACQUIRE)
+    #else
+        #define USE_REMOTE_FREE     0
+    #endif
+#else
+    #define USE_THREAD_ARENAS   0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,10 +81,22 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+#if USE_THREAD_ARENAS
+    static void arenas_init(uint8_t * mem);
+    static void arenas_deinit(void);
+    static lv_tlsf_arena_t * get_thread_arena(void);
+    static lv_tlsf_arena_t * find_arena(void * p);
+    static void arena_free(lv_tlsf_arena_t * arena, void * p);
+    static void arena_drain_remote_free(lv_tlsf_arena_t * arena);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if USE_THREAD_ARENAS
+    /*1 + index of the arena used by the current thread, or one of the `ARENA_ID_...` values*/
+    static THREAD_LOCAL uint32_t thread_arena_id;
+#endif
 
 /**********************
  *      MACROS
@@ -76,16 +123,26 @@ void lv_mem_init(void)
 
 #if LV_MEM_ADR == 0
 #ifdef LV_MEM_POOL_ALLOC
-    state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
+    uint8_t * work_mem = (uint8_t *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE);
 #else
     /*Allocate a large array to store the dynamically allocated data*/
     static MEM_UNIT work_mem_int[LV_MEM_SIZE / sizeof(MEM_UNIT)] LV_ATTRIBUTE_LARGE_RAM_ARRAY;
-    state.tlsf = lv_tlsf_create_with_pool((void *)work_mem_int, LV_MEM_SIZE);
+    uint8_t * work_mem = (uint8_t *)work_mem_int;
 #endif
 #else
-    state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
+    uint8_t * work_mem = (uint8_t *)LV_MEM_ADR;
 #endif
 
+#if USE_THREAD_ARENAS
+    /*The thread arenas are at the end of the work memory*/
+    size_t main_size = LV_MEM_SIZE - LV_MEM_THREAD_ARENA_CNT * ARENA_SIZE;
+    arenas_init(work_mem + main_size);
+#else
+    size_t main_size = LV_MEM_SIZE;
+#endif
+
+    state.tlsf = lv_tlsf_create_with_pool((void *)work_mem, main_size);
+
     lv_ll_init(&state.pool_ll, sizeof(lv_pool_t));
 
     /*Record the first pool*/
@@ -100,6 +157,9 @@ void lv_mem_init(void)
 
 void lv_mem_deinit(void)
 {
+#if USE_THREAD_ARENAS
+    arenas_deinit();
+#endif
     lv_ll_clear(&state.pool_ll);
     lv_tlsf_destroy(state.tlsf);
 #if LV_USE_OS
@@ -138,6 +198,23 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
 
 void * lv_malloc_core(size_t size)
 {
+#if USE_THREAD_ARENAS
+    lv_tlsf_arena_t * arena = get_thread_arena();
+    if(arena) {
+        lv_mutex_lock(&arena->mutex);
+        arena_drain_remote_free(arena);
+        void * p = lv_tlsf_malloc(arena->tlsf, size);
+        if(p) {
+            arena->cur_used += lv_tlsf_block_size(p);
+            arena->max_used = LV_MAX(arena->cur_used, arena->max_used);
+        }
+        lv_mutex_unlock(&arena->mutex);
+
+        if(p) return p;
+        /*The arena is full, use the main pool*/
+    }
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -156,6 +233,32 @@ void * lv_malloc_core(size_t size)
 
 void * lv_realloc_core(void * p, size_t new_size)
 {
+#if USE_THREAD_ARENAS
+    lv_tlsf_arena_t * arena = find_arena(p);
+    if(arena) {
+        lv_mutex_lock(&arena->mutex);
+        arena_drain_remote_free(arena);
+        size_t arena_old_size = lv_tlsf_block_size(p);
+        void * arena_p_new = lv_tlsf_realloc(arena->tlsf, p, new_size);
+        if(arena_p_new) {
+            arena->cur_used -= arena_old_size;
+            arena->cur_used += lv_tlsf_block_size(arena_p_new);
+            arena->max_used = LV_MAX(arena->cur_used, arena->max_used);
+        }
+        lv_mutex_unlock(&arena->mutex);
+
+        if(arena_p_new) return arena_p_new;
+
+        /*Doesn't fit into its arena, move it to the arena of this thread or to the main pool*/
+        arena_p_new = lv_malloc_core(new_size);
+        if(arena_p_new == NULL) return NULL;
+
+        lv_memcpy(arena_p_new, p, LV_MIN(arena_old_size, new_size));
+        lv_free_core(p);
+        return arena_p_new;
+    }
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -177,6 +280,28 @@ void * lv_realloc_core(void * p, size_t new_size)
 
 void lv_free_core(void * p)
 {
+#if USE_THREAD_ARENAS
+    /*Give the memory back to the arena which allocated it, even if it's freed by an other thread*/
+    lv_tlsf_arena_t * arena = find_arena(p);
+    if(arena) {
+#if USE_REMOTE_FREE
+        bool own_arena = thread_arena_id > ARENA_ID_MAIN && &state.arenas[thread_arena_id - ARENA_ID_MAIN - 1] == arena;
+        if(!own_arena) {
+            /*Don't wait for the threads of the arena, let them free it on their next allocation*/
+            void * head = REMOTE_FREE_LOAD(&arena->remote_free);
+            do {
+                *(void **)p = head;
+            } while(!REMOTE_FREE_PUSH(&arena->remote_free, head, p));
+            return;
+        }
+#endif
+        lv_mutex_lock(&arena->mutex);
+        arena_free(arena, p);
+        lv_mutex_unlock(&arena->mutex);
+        return;
+    }
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -205,6 +330,20 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
+#if USE_THREAD_ARENAS
+    /*The render threads might allocate in their arenas meanwhile*/
+    size_t arenas_max_used = 0;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_ARENA_CNT; i++) {
+        lv_tlsf_arena_t * arena = &state.arenas[i];
+        lv_mutex_lock(&arena->mutex);
+        arena_drain_remote_free(arena);
+        lv_tlsf_walk_pool(lv_tlsf_get_pool(arena->tlsf), lv_mem_walker, mon_p);
+        arenas_max_used += arena->max_used;
+        lv_mutex_unlock(&arena->mutex);
+    }
+#endif
+
     mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
@@ -215,6 +354,10 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     }
 
     mon_p->max_used = state.max_used;
+#if USE_THREAD_ARENAS
+    /*The arenas might have reached their maximum at different times so it's an upper bound*/
+    mon_p->max_used += arenas_max_used;
+#endif
 
     LV_TRACE_MEM("finished");
 }
@@ -243,6 +386,22 @@ lv_result_t lv_mem_test_core(void)
         }
     }
 
+#if USE_THREAD_ARENAS
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_ARENA_CNT; i++) {
+        lv_tlsf_arena_t * arena = &state.arenas[i];
+        lv_mutex_lock(&arena->mutex);
+        arena_drain_remote_free(arena);
+        bool failed = lv_tlsf_check(arena->tlsf) || lv_tlsf_check_pool(lv_tlsf_get_pool(arena->tlsf));
+        lv_mutex_unlock(&arena->mutex);
+        if(failed) {
+            LV_LOG_WARN("arena %" LV_PRIu32 " failed", i);
+            lv_mutex_unlock(&state.mutex);
+            return LV_RESULT_INVALID;
+        }
+    }
+#endif
+
     LV_TRACE_MEM("passed");
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -254,6 +413,110 @@ lv_result_t lv_mem_test_core(void)
  *   STATIC FUNCTIONS
  **********************/
 
+#if USE_THREAD_ARENAS
+
+static void arenas_init(uint8_t * mem)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_ARENA_CNT; i++) {
+        lv_tlsf_arena_t * arena = &state.arenas[i];
+        lv_mutex_init(&arena->mutex);
+        arena->tlsf = lv_tlsf_create_with_pool(mem, ARENA_SIZE);
+        arena->mem_start = mem;
+        arena->mem_end = mem + ARENA_SIZE;
+        arena->cur_used = 0;
+        arena->max_used = 0;
+        arena->remote_free = NULL;
+        mem += ARENA_SIZE;
+    }
+
+    state.arena_next = 0;
+
+    /*The thread which initializes LVGL uses the main pool*/
+    thread_arena_id = ARENA_ID_MAIN;
+}
+
+static void arenas_deinit(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_ARENA_CNT; i++) {
+        lv_tlsf_destroy(state.arenas[i].tlsf);
+        lv_mutex_delete(&state.arenas[i].mutex);
+    }
+}
+
+/**
+ * Get the arena of the current thread. Assign one if it has none yet.
+ * @return      the arena of the thread or NULL if it uses the main pool
+ */
+static lv_tlsf_arena_t * get_thread_arena(void)
+{
+    if(thread_arena_id == ARENA_ID_NONE) {
+        lv_mutex_lock(&state.mutex);
+        thread_arena_id = ARENA_ID_MAIN + 1 + state.arena_next;
+        state.arena_next = (state.arena_next + 1) % LV_MEM_THREAD_ARENA_CNT;
+        lv_mutex_unlock(&state.mutex);
+    }
+
+    if(thread_arena_id == ARENA_ID_MAIN) return NULL;
+    return &state.arenas[thread_arena_id - ARENA_ID_MAIN - 1];
+}
+
+/**
+ * Find the arena which contains a memory block
+ * @param p     pointer to an allocated memory block
+ * @return      the arena containing `p` or NULL if it's in the main pool
+ */
+static lv_tlsf_arena_t * find_arena(void * p)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_ARENA_CNT; i++) {
+        lv_tlsf_arena_t * arena = &state.arenas[i];
+        if((uint8_t *)p >= arena->mem_start && (uint8_t *)p < arena->mem_end) return arena;
+    }
+
+    return NULL;
+}
+
+/**
+ * Free a block of an arena. The arena needs to be locked.
+ * @param arena     pointer to the arena containing the block
+ * @param p         pointer to the block
+ */
+static void arena_free(lv_tlsf_arena_t * arena, void * p)
+{
+    size_t size = lv_tlsf_block_size(p);
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, size);
+#endif
+    lv_tlsf_free(arena->tlsf, p);
+    if(arena->cur_used > size) arena->cur_used -= size;
+    else arena->cur_used = 0;
+}
+
+/**
+ * Free the blocks which were freed by other threads. The arena needs to be locked.
+ * @param arena     pointer to an arena
+ */
+static void arena_drain_remote_free(lv_tlsf_arena_t * arena)
+{
+#if USE_REMOTE_FREE
+    /*Usually empty, so check it before the more expensive exchange*/
+    if(REMOTE_FREE_LOAD(&arena->remote_free) == NULL) return;
+
+    void * p = REMOTE_FREE_TAKE_ALL(&arena->remote_free);
+    while(p) {
+        void * next = *(void **)p;
+        arena_free(arena, p);
+        p = next;
+    }
+#else
+    LV_UNUSED(arena);
+#endif
+}
+
+#endif /*USE_THREAD_ARENAS*/
+
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
@@ -27,6 +27,19 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_OS && LV_MEM_THREAD_ARENA_CNT
+/** A separate TLSF pool used by some threads to avoid waiting for each other*/
+typedef struct {
+    lv_mutex_t mutex;
+    lv_tlsf_t tlsf;
+    uint8_t * mem_start;        /**< Start of the arena's memory. Used to find the arena of a pointer */
+    uint8_t * mem_end;          /**< End of the arena's memory (exclusive) */
+    size_t cur_used;
+    size_t max_used;
+    void * remote_free;         /**< List of the blocks freed by other threads. Linked through their first word */
+} lv_tlsf_arena_t;
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -35,6 +48,10 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_USE_OS && LV_MEM_THREAD_ARENA_CNT
+    lv_tlsf_arena_t arenas[LV_MEM_THREAD_ARENA_CNT];
+    uint32_t arena_next;        /**< The arena to assign to the next new thread */
+#endif
 } lv_tlsf_state_t;
 
 /**********************
@@ -408,6 +408,7 @@ void lv_arc_rotate_obj_to_angle(const lv_obj_t * obj, lv_obj_t * obj_to_rotate,
     lv_obj_update_layout(obj);
 
     int32_t angle = (int32_t)get_angle(obj);
+    lv_obj_sync_coords(obj_to_rotate);
     int32_t pivot_x = obj_to_rotate->coords.x1 - center.x;
     int32_t pivot_y = obj_to_rotate->coords.y1 - center.y;
     lv_obj_set_style_transform_pivot_x(obj_to_rotate, -pivot_x, 0);
@@ -833,6 +834,7 @@ static void get_center(const lv_obj_t * obj, lv_point_t * center, int32_t * arc_
     int32_t r = (LV_MIN(lv_obj_get_width(obj) - left_bg - right_bg,
                         lv_obj_get_height(obj) - top_bg - bottom_bg)) / 2;
 
+    lv_obj_sync_coords((lv_obj_t *)obj);
     center->x = obj->coords.x1 + r + left_bg;
     center->y = obj->coords.y1 + r + top_bg;
 
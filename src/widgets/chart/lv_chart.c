@@ -42,6 +42,11 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_stacked(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
+static lv_point_precise_t * alloc_polyline_points(lv_obj_t * obj);
+static bool is_simple_point(const lv_draw_rect_dsc_t * dsc);
+static void draw_series_polyline(lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc,
+                                 lv_draw_rect_dsc_t * point_dsc, int32_t point_w, int32_t point_h,
+                                 const lv_point_precise_t * points, uint32_t point_cnt, uint32_t id);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
@@ -986,6 +991,10 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
 
     line_dsc.base.id1 = ser_cnt - 1;
     point_dsc_default.base.id1 = line_dsc.base.id1;
+
+    /*Draw the points and lines of a series with a few polyline tasks instead of a task per line and point*/
+    lv_point_precise_t * points = crowded_mode ? NULL : alloc_polyline_points(obj);
+
     /*Go through all data lines*/
     LV_LL_READ_BACK(&chart->series_ll, ser) {
         if(ser->hidden) {
@@ -1002,90 +1011,127 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
 
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
-        line_dsc.p1.x = x_ofs;
-        line_dsc.p2.x = x_ofs;
+        if(points) {
+            uint32_t run_cnt = 0;
+            uint32_t run_start = 0;
+            int32_t x_prev = LV_COORD_MIN;
+            for(i = 0; i < chart->point_cnt; i++) {
+                if(x_prev > layer->_clip_area.x2 + point_w + 1) break;
+
+                int32_t x = (w * i) / (chart->point_cnt - 1) + x_ofs;
+                x_prev = x;
+
+                int32_t p_act = (start_point + i) % chart->point_cnt;
+                if(ser->y_points[p_act] == LV_CHART_POINT_NONE) {
+                    draw_series_polyline(layer, &line_dsc, &point_dsc_default, point_w, point_h, points, run_cnt, run_start);
+                    run_cnt = 0;
+                    continue;
+                }
 
-        int32_t p_act = start_point;
-        int32_t p_prev = start_point;
-        int32_t y_tmp = (int32_t)((int32_t)ser->y_points[p_prev] - chart->ymin[ser->y_axis_sec]) * h;
-        y_tmp  = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
-        line_dsc.p2.y   = h - y_tmp + y_ofs;
+                /*From the points on the left only the last one is required to draw the first line*/
+                if(x < layer->_clip_area.x1 - point_w - 1) run_cnt = 0;
+                if(run_cnt == 0) run_start = i;
 
-        lv_value_precise_t y_min = line_dsc.p2.y;
-        lv_value_precise_t y_max = line_dsc.p2.y;
+                int32_t y_tmp = (int32_t)((int32_t)ser->y_points[p_act] - chart->ymin[ser->y_axis_sec]) * h;
+                y_tmp = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
+                points[run_cnt].x = x;
+                points[run_cnt].y = h - y_tmp + y_ofs;
+                run_cnt++;
+            }
+            draw_series_polyline(layer, &line_dsc, &point_dsc_default, point_w, point_h, points, run_cnt, run_start);
+        }
+        else {
+            line_dsc.p1.x = x_ofs;
+            line_dsc.p2.x = x_ofs;
+
+            int32_t p_act = start_point;
+            int32_t p_prev = start_point;
+            int32_t y_tmp = 0;
+            /*The y of the missing points is not used, and calculating it would overflow*/
+            if(ser->y_points[p_prev] != LV_CHART_POINT_NONE) {
+                y_tmp = (int32_t)((int32_t)ser->y_points[p_prev] - chart->ymin[ser->y_axis_sec]) * h;
+                y_tmp  = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
+            }
+            line_dsc.p2.y   = h - y_tmp + y_ofs;
 
-        for(i = 0; i < chart->point_cnt; i++) {
-            line_dsc.p1.x = line_dsc.p2.x;
-            line_dsc.p1.y = line_dsc.p2.y;
+            lv_value_precise_t y_min = line_dsc.p2.y;
+            lv_value_precise_t y_max = line_dsc.p2.y;
 
-            if(line_dsc.p1.x > layer->_clip_area.x2 + point_w + 1) break;
-            line_dsc.p2.x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
+            for(i = 0; i < chart->point_cnt; i++) {
+                line_dsc.p1.x = line_dsc.p2.x;
+                line_dsc.p1.y = line_dsc.p2.y;
 
-            p_act = (start_point + i) % chart->point_cnt;
+                if(line_dsc.p1.x > layer->_clip_area.x2 + point_w + 1) break;
+                line_dsc.p2.x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
 
-            y_tmp = (int32_t)((int32_t)ser->y_points[p_act] - chart->ymin[ser->y_axis_sec]) * h;
-            y_tmp = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
-            line_dsc.p2.y  = h - y_tmp + y_ofs;
+                p_act = (start_point + i) % chart->point_cnt;
 
-            if(line_dsc.p2.x < layer->_clip_area.x1 - point_w - 1) {
-                p_prev = p_act;
-                continue;
-            }
+                if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                    y_tmp = (int32_t)((int32_t)ser->y_points[p_act] - chart->ymin[ser->y_axis_sec]) * h;
+                    y_tmp = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
+                }
+                line_dsc.p2.y  = h - y_tmp + y_ofs;
 
-            /*Don't draw the first point. A second point is also required to draw the line*/
-            if(i != 0) {
-                if(crowded_mode) {
-                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        /*Draw only one vertical line between the min and max y-values on the same x-value*/
-                        y_max = LV_MAX(y_max, line_dsc.p2.y);
-                        y_min = LV_MIN(y_min, line_dsc.p2.y);
-                        if(line_dsc.p1.x != line_dsc.p2.x) {
-                            lv_value_precise_t y_cur = line_dsc.p2.y;
-                            line_dsc.p2.x--;         /*It's already on the next x value*/
-                            line_dsc.p1.x = line_dsc.p2.x;
-                            line_dsc.p1.y = y_min;
-                            line_dsc.p2.y = y_max;
-                            if(line_dsc.p1.y == line_dsc.p2.y) line_dsc.p2.y++;    /*If they are the same no line will be drawn*/
-                            lv_draw_line(layer, &line_dsc);
-                            line_dsc.p2.x++;         /*Compensate the previous x--*/
-                            y_min = y_cur;  /*Start the line of the next x from the current last y*/
-                            y_max = y_cur;
-                        }
-                    }
+                if(line_dsc.p2.x < layer->_clip_area.x1 - point_w - 1) {
+                    p_prev = p_act;
+                    continue;
                 }
-                else {
-                    lv_area_t point_area;
-                    point_area.x1 = (int32_t)line_dsc.p1.x - point_w;
-                    point_area.x2 = (int32_t)line_dsc.p1.x + point_w;
-                    point_area.y1 = (int32_t)line_dsc.p1.y - point_h;
-                    point_area.y2 = (int32_t)line_dsc.p1.y + point_h;
 
-                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        line_dsc.base.id2 = i;
-                        lv_draw_line(layer, &line_dsc);
+                /*Don't draw the first point. A second point is also required to draw the line*/
+                if(i != 0) {
+                    if(crowded_mode) {
+                        if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                            /*Draw only one vertical line between the min and max y-values on the same x-value*/
+                            y_max = LV_MAX(y_max, line_dsc.p2.y);
+                            y_min = LV_MIN(y_min, line_dsc.p2.y);
+                            if(line_dsc.p1.x != line_dsc.p2.x) {
+                                lv_value_precise_t y_cur = line_dsc.p2.y;
+                                line_dsc.p2.x--;         /*It's already on the next x value*/
+                                line_dsc.p1.x = line_dsc.p2.x;
+                                line_dsc.p1.y = y_min;
+                                line_dsc.p2.y = y_max;
+                                if(line_dsc.p1.y == line_dsc.p2.y) line_dsc.p2.y++;    /*If they are the same no line will be drawn*/
+                                lv_draw_line(layer, &line_dsc);
+                                line_dsc.p2.x++;         /*Compensate the previous x--*/
+                                y_min = y_cur;  /*Start the line of the next x from the current last y*/
+                                y_max = y_cur;
+                            }
+                        }
                     }
+                    else {
+                        lv_area_t point_area;
+                        point_area.x1 = (int32_t)line_dsc.p1.x - point_w;
+                        point_area.x2 = (int32_t)line_dsc.p1.x + point_w;
+                        point_area.y1 = (int32_t)line_dsc.p1.y - point_h;
+                        point_area.y2 = (int32_t)line_dsc.p1.y + point_h;
+
+                        if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                            line_dsc.base.id2 = i;
+                            lv_draw_line(layer, &line_dsc);
+                        }
 
-                    if(point_w && point_h && ser->y_points[p_prev] != LV_CHART_POINT_NONE) {
-                        point_dsc_default.base.id2 = i - 1;
-                        lv_draw_rect(layer, &point_dsc_default, &point_area);
+                        if(point_w && point_h && ser->y_points[p_prev] != LV_CHART_POINT_NONE) {
+                            point_dsc_default.base.id2 = i - 1;
+                            lv_draw_rect(layer, &point_dsc_default, &point_area);
+                        }
                     }
-                }
 
+                }
+                p_prev = p_act;
             }
-            p_prev = p_act;
-        }
 
-        /*Draw the last point*/
-        if(!crowded_mode && i == chart->point_cnt) {
+            /*Draw the last point*/
+            if(!crowded_mode && i == chart->point_cnt) {
 
-            if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                lv_area_t point_area;
-                point_area.x1 = (int32_t)line_dsc.p2.x - point_w;
-                point_area.x2 = (int32_t)line_dsc.p2.x + point_w;
-                point_area.y1 = (int32_t)line_dsc.p2.y - point_h;
-                point_area.y2 = (int32_t)line_dsc.p2.y + point_h;
-                point_dsc_default.base.id2 = i - 1;
-                lv_draw_rect(layer, &point_dsc_default, &point_area);
+                if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                    lv_area_t point_area;
+                    point_area.x1 = (int32_t)line_dsc.p2.x - point_w;
+                    point_area.x2 = (int32_t)line_dsc.p2.x + point_w;
+                    point_area.y1 = (int32_t)line_dsc.p2.y - point_h;
+                    point_area.y2 = (int32_t)line_dsc.p2.y + point_h;
+                    point_dsc_default.base.id2 = i - 1;
+                    lv_draw_rect(layer, &point_dsc_default, &point_area);
+                }
             }
         }
 
@@ -1094,6 +1140,8 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
             line_dsc.base.id1--;
         }
     }
+
+    lv_free(points);
 }
 
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
@@ -1127,6 +1175,9 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
     if(LV_MIN(point_w, point_h) > line_dsc.width / 2) line_dsc.raw_end = 1;
     if(line_dsc.width == 1) line_dsc.raw_end = 1;
 
+    /*Draw the points and lines of a series with a few polyline tasks instead of a task per line and point*/
+    lv_point_precise_t * points = alloc_polyline_points(obj);
+
     /*Go through all data lines*/
     LV_LL_READ_BACK(&chart->series_ll, ser) {
         if(ser->hidden) continue;
@@ -1135,79 +1186,198 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
-        line_dsc.p1.x = x_ofs;
-        line_dsc.p2.x = x_ofs;
-
-        int32_t p_act = start_point;
-        int32_t p_prev = start_point;
-        if(ser->y_points[p_act] != LV_CHART_POINT_CNT_DEF) {
-            line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
-            line_dsc.p2.x += x_ofs;
+        if(points) {
+            uint32_t run_cnt = 0;
+            uint32_t run_start = 0;
+            for(i = 0; i < chart->point_cnt; i++) {
+                int32_t p_act = (start_point + i) % chart->point_cnt;
+                if(ser->y_points[p_act] == LV_CHART_POINT_NONE) {
+                    draw_series_polyline(layer, &line_dsc, &point_dsc_default, point_w, point_h, points, run_cnt, run_start);
+                    run_cnt = 0;
+                    continue;
+                }
 
-            line_dsc.p2.y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
-            line_dsc.p2.y = h - line_dsc.p2.y;
-            line_dsc.p2.y += y_ofs;
+                if(run_cnt == 0) run_start = i;
+                points[run_cnt].x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
+                points[run_cnt].x += x_ofs;
+                points[run_cnt].y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
+                points[run_cnt].y = h - points[run_cnt].y + y_ofs;
+                run_cnt++;
+            }
+            draw_series_polyline(layer, &line_dsc, &point_dsc_default, point_w, point_h, points, run_cnt, run_start);
         }
         else {
-            line_dsc.p2.x = (lv_value_precise_t)LV_COORD_MIN;
-            line_dsc.p2.y = (lv_value_precise_t)LV_COORD_MIN;
-        }
+            line_dsc.p1.x = x_ofs;
+            line_dsc.p2.x = x_ofs;
 
-        for(i = 0; i < chart->point_cnt; i++) {
-            line_dsc.p1.x = line_dsc.p2.x;
-            line_dsc.p1.y = line_dsc.p2.y;
+            int32_t p_act = start_point;
+            int32_t p_prev = start_point;
+            if(ser->y_points[p_act] != LV_CHART_POINT_CNT_DEF) {
+                line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
+                line_dsc.p2.x += x_ofs;
 
-            p_act = (start_point + i) % chart->point_cnt;
-            if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                line_dsc.p2.y =  lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
+                line_dsc.p2.y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
                 line_dsc.p2.y = h - line_dsc.p2.y;
                 line_dsc.p2.y += y_ofs;
-
-                line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
-                line_dsc.p2.x += x_ofs;
             }
             else {
-                p_prev = p_act;
-                continue;
+                line_dsc.p2.x = (lv_value_precise_t)LV_COORD_MIN;
+                line_dsc.p2.y = (lv_value_precise_t)LV_COORD_MIN;
             }
 
-            if(i != 0) { /*Don't draw line *to* the first point.*/
-                lv_area_t point_area;
-                point_area.x1 = (int32_t)line_dsc.p1.x - point_w;
-                point_area.x2 = (int32_t)line_dsc.p1.x + point_w;
-                point_area.y1 = (int32_t)line_dsc.p1.y - point_h;
-                point_area.y2 = (int32_t)line_dsc.p1.y + point_h;
-
-                if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                    line_dsc.base.id2 = i - 1;
-                    lv_draw_line(layer, &line_dsc);
-                    if(point_w && point_h) {
-                        point_dsc_default.base.id2 = i - 1;
-                        lv_draw_rect(layer, &point_dsc_default, &point_area);
-                    }
-                }
+            for(i = 0; i < chart->point_cnt; i++) {
+                line_dsc.p1.x = line_dsc.p2.x;
+                line_dsc.p1.y = line_dsc.p2.y;
 
-                p_prev = p_act;
-            }
+                p_act = (start_point + i) % chart->point_cnt;
+                if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                    line_dsc.p2.y =  lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
+                    line_dsc.p2.y = h - line_dsc.p2.y;
+                    line_dsc.p2.y += y_ofs;
 
-            /*Draw the last point*/
-            if(i == chart->point_cnt - 1) {
+                    line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
+                    line_dsc.p2.x += x_ofs;
+                }
+                else {
+                    p_prev = p_act;
+                    continue;
+                }
 
-                if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                if(i != 0) { /*Don't draw line *to* the first point.*/
                     lv_area_t point_area;
-                    point_area.x1 = (int32_t)line_dsc.p2.x - point_w;
-                    point_area.x2 = (int32_t)line_dsc.p2.x + point_w;
-                    point_area.y1 = (int32_t)line_dsc.p2.y - point_h;
-                    point_area.y2 = (int32_t)line_dsc.p2.y + point_h;
+                    point_area.x1 = (int32_t)line_dsc.p1.x - point_w;
+                    point_area.x2 = (int32_t)line_dsc.p1.x + point_w;
+                    point_area.y1 = (int32_t)line_dsc.p1.y - point_h;
+                    point_area.y2 = (int32_t)line_dsc.p1.y + point_h;
 
-                    point_dsc_default.base.id2 = i;
-                    lv_draw_rect(layer, &point_dsc_default, &point_area);
+                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                        line_dsc.base.id2 = i - 1;
+                        lv_draw_line(layer, &line_dsc);
+                        if(point_w && point_h) {
+                            point_dsc_default.base.id2 = i - 1;
+                            lv_draw_rect(layer, &point_dsc_default, &point_area);
+                        }
+                    }
+
+                    p_prev = p_act;
+                }
+
+                /*Draw the last point*/
+                if(i == chart->point_cnt - 1) {
+
+                    if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                        lv_area_t point_area;
+                        point_area.x1 = (int32_t)line_dsc.p2.x - point_w;
+                        point_area.x2 = (int32_t)line_dsc.p2.x + point_w;
+                        point_area.y1 = (int32_t)line_dsc.p2.y - point_h;
+                        point_area.y2 = (int32_t)line_dsc.p2.y + point_h;
+
+                        point_dsc_default.base.id2 = i;
+                        lv_draw_rect(layer, &point_dsc_default, &point_area);
+                    }
                 }
             }
         }
+
         line_dsc.base.id1++;
         point_dsc_default.base.id1++;
     }
+
+    lv_free(points);
+}
+
+/**
+ * Allocate a buffer for the coordinates of the points of a series to draw them with polyline draw tasks
+ * @param obj       pointer to a chart
+ * @return          the buffer or NULL if the series should be drawn with a draw task per line and point
+ */
+static lv_point_precise_t * alloc_polyline_points(lv_obj_t * obj)
+{
+    /*Keep the draw tasks of the other draw units (e.g. accelerated lines)*/
+    if(!lv_draw_polyline_is_supported()) return NULL;
+
+    /*The draw task event handlers might want to modify the lines and points one by one*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) return NULL;
+
+    lv_chart_t * chart = (lv_chart_t *)obj;
+    if(chart->point_cnt == 0) return NULL;
+
+    return lv_malloc(chart->point_cnt * sizeof(lv_point_precise_t));
+}
+
+/**
+ * Check whether the points of the series can be drawn as the markers of a polyline task
+ * instead of one `lv_draw_rect` task per point
+ * @param dsc       the draw descriptor of the points
+ * @return          true: only a simple background is drawn
+ */
+static bool is_simple_point(const lv_draw_rect_dsc_t * dsc)
+{
+    if(dsc->bg_grad.dir != LV_GRAD_DIR_NONE) return false;
+    if(dsc->bg_image_src && dsc->bg_image_opa > LV_OPA_MIN) return false;
+    if(dsc->border_width && dsc->border_opa > LV_OPA_MIN && dsc->border_side != LV_BORDER_SIDE_NONE) return false;
+    if(dsc->outline_width && dsc->outline_opa > LV_OPA_MIN) return false;
+    if(dsc->shadow_width && dsc->shadow_opa > LV_OPA_MIN) return false;
+
+    return true;
+}
+
+/**
+ * Draw consecutive points of a series and the lines between them with one polyline draw task
+ * @param layer         pointer to a layer
+ * @param line_dsc      the line draw descriptor of the series
+ * @param point_dsc     the draw descriptor of the points
+ * @param point_w       half width of the points
+ * @param point_h       half height of the points
+ * @param points        the coordinates of the points
+ * @param point_cnt     number of points
+ * @param id            index of the first point in the series
+ */
+static void draw_series_polyline(lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc,
+                                 lv_draw_rect_dsc_t * point_dsc, int32_t point_w, int32_t point_h,
+                                 const lv_point_precise_t * points, uint32_t point_cnt, uint32_t id)
+{
+    if(point_cnt == 0) return;
+
+    bool has_point = point_w && point_h;
+    bool simple_point = has_point && is_simple_point(point_dsc);
+
+    lv_draw_polyline_dsc_t dsc;
+    lv_draw_polyline_dsc_init(&dsc);
+    dsc.base = line_dsc->base;
+    dsc.base.dsc_size = sizeof(lv_draw_polyline_dsc_t);
+    dsc.base.id2 = id;
+    dsc.points = points;
+    dsc.point_cnt = point_cnt;
+    dsc.color = line_dsc->color;
+    dsc.width = line_dsc->width;
+    dsc.dash_width = line_dsc->dash_width;
+    dsc.dash_gap = line_dsc->dash_gap;
+    dsc.opa = line_dsc->opa;
+    dsc.round_start = line_dsc->round_start;
+    dsc.round_end = line_dsc->round_end;
+    dsc.raw_end = line_dsc->raw_end;
+    if(simple_point) {
+        dsc.marker_w = point_w;
+        dsc.marker_h = point_h;
+        dsc.marker_radius = point_dsc->radius;
+        dsc.marker_color = point_dsc->bg_color;
+        dsc.marker_opa = point_dsc->bg_opa;
+    }
+    lv_draw_polyline(layer, &dsc);
+
+    if(!has_point || simple_point) return;
+
+    uint32_t i;
+    for(i = 0; i < point_cnt; i++) {
+        lv_area_t point_area;
+        point_area.x1 = (int32_t)points[i].x - point_w;
+        point_area.x2 = (int32_t)points[i].x + point_w;
+        point_area.y1 = (int32_t)points[i].y - point_h;
+        point_area.y2 = (int32_t)points[i].y + point_h;
+        point_dsc->base.id2 = id + i;
+        lv_draw_rect(layer, point_dsc, &point_area);
+    }
 }
 
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer)
@@ -1546,6 +1716,7 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     int32_t scroll_left = lv_obj_get_scroll_left(obj);
     int32_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
     int32_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    lv_obj_sync_coords(obj);
     int32_t x_ofs = obj->coords.x1 + pleft + bwidth - scroll_left;
 
     if(chart->type == LV_CHART_TYPE_LINE) {
@@ -550,6 +550,8 @@ void lv_dropdown_open(lv_obj_t * dropdown_obj)
     int32_t list_fit_h = label_h + top + bottom;
     int32_t list_h = list_fit_h;
 
+    lv_obj_sync_coords(dropdown_obj);
+
     lv_dir_t dir = dropdown->dir;
     /*No space on the bottom? See if top is better.*/
     if(dropdown->dir == LV_DIR_BOTTOM) {
@@ -1051,6 +1053,7 @@ static void draw_box(lv_obj_t * dropdown_obj, lv_layer_t * layer, uint32_t id, l
     /*Draw the selected*/
     lv_obj_t * label = get_label(dropdown_obj);
     LV_ASSERT_NULL(label);
+    lv_obj_sync_coords(label);
     lv_area_t rect_area;
     rect_area.y1 = label->coords.y1;
     rect_area.y1 += id * (font_h + line_space);
@@ -1096,6 +1099,7 @@ static void draw_box_label(lv_obj_t * dropdown_obj, lv_layer_t * layer, uint32_t
 
     int32_t font_h        = lv_font_get_line_height(label_dsc.font);
 
+    lv_obj_sync_coords(label);
     lv_area_t area_sel;
     area_sel.y1 = label->coords.y1;
     area_sel.y1 += id * (font_h + label_dsc.line_space);
@@ -1210,6 +1214,7 @@ static uint32_t get_id_on_point(lv_obj_t * dropdown_obj, int32_t y)
     lv_dropdown_t * dropdown = (lv_dropdown_t *)dropdown_obj;
     lv_obj_t * label = get_label(dropdown_obj);
     if(label == NULL) return 0;
+    lv_obj_sync_coords(label);
     y -= label->coords.y1;
 
     const lv_font_t * font         = lv_obj_get_style_text_font(label, LV_PART_MAIN);
@@ -56,6 +56,10 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+#if LV_LABEL_LINE_TABLE
+    static const lv_draw_label_lines_t * get_lines(lv_label_t * label, const lv_font_t * font,
+                                                   const lv_text_attributes_t * attributes);
+#endif
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, lv_area_t * txt_coords, lv_text_attributes_t * attributes);
 
@@ -351,17 +355,29 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        bool last_line = y + letter_height + attributes.line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) attributes.text_flags |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LINE_TABLE
+    const lv_draw_label_lines_t * lines = get_lines(label, font, &attributes);
+    if(lines && lines->line_cnt > 0) {
+        uint32_t line_idx = lv_draw_label_lines_find(lines, byte_id);
+        line_start = lines->lines[line_idx].start;
+        new_line_start = lines->lines[line_idx + 1].start;
+        y = (int32_t)line_idx * (letter_height + attributes.line_space);
+    }
+    else
+#endif
+    {
+        while(txt[new_line_start] != '\0') {
+            bool last_line = y + letter_height + attributes.line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) attributes.text_flags |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, NULL, &attributes);
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, NULL, &attributes);
 
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + attributes.line_space;
-        line_start = new_line_start;
+            y += letter_height + attributes.line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -442,26 +458,54 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
     attributes.max_width = lv_area_get_width(&txt_coords);
 
     /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        /*If dots will be shown, break the last visible line anywhere,
-         *not only at word boundaries.*/
-        bool last_line = y + letter_height + attributes.line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) attributes.text_flags |= LV_TEXT_FLAG_BREAK_ALL;
-
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, NULL, &attributes);
+#if LV_LABEL_LINE_TABLE
+    const int32_t line_step = letter_height + attributes.line_space;
+    const lv_draw_label_lines_t * lines = line_step > 0 ? get_lines(label, font, &attributes) : NULL;
+    if(lines) {
+        /*The first line whose bottom is not above `pos.y`*/
+        uint32_t line_idx = 0;
+        if(pos.y > letter_height) line_idx = (pos.y - letter_height + line_step - 1) / line_step;
+
+        if(line_idx < lines->line_cnt) {
+            line_start = lines->lines[line_idx].start;
+            new_line_start = lines->lines[line_idx + 1].start;
 
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
             /*Include the NULL terminator in the last line*/
             uint32_t tmp = new_line_start;
             uint32_t letter;
             letter = lv_text_encoded_prev(txt, &tmp);
             if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
         }
-        y += letter_height + attributes.line_space;
+        else {
+            /*Below the last line*/
+            line_start = lines->lines[lines->line_cnt].start;
+            new_line_start = line_start;
+        }
+    }
+    else
+#endif
+    {
+        while(txt[line_start] != '\0') {
+            /*If dots will be shown, break the last visible line anywhere,
+             *not only at word boundaries.*/
+            bool last_line = y + letter_height + attributes.line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) attributes.text_flags |= LV_TEXT_FLAG_BREAK_ALL;
+
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, NULL, &attributes);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                /*Include the NULL terminator in the last line*/
+                uint32_t tmp = new_line_start;
+                uint32_t letter;
+                letter = lv_text_encoded_prev(txt, &tmp);
+                if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+                break;
+            }
+            y += letter_height + attributes.line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     char * bidi_txt;
@@ -753,6 +797,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LINE_TABLE
+    lv_draw_label_lines_reset(&label->lines);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -845,6 +893,9 @@ static void draw_main(lv_event_t * e)
         label_draw_dsc.hint = &label->hint;
     }
 #endif
+#if LV_LABEL_LINE_TABLE
+    label_draw_dsc.lines = &label->lines;
+#endif
 
     label_draw_dsc.flag = flag;
     label_draw_dsc.base.layer = layer;
@@ -989,6 +1040,12 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_text_get_size(&size, label->text, font, &attributes);
     label->text_size = size;
 
+#if LV_LABEL_LINE_TABLE
+    /*In DOTS mode the text is modified and the last line is wrapped differently, so don't use the lines*/
+    if(label->long_mode == LV_LABEL_LONG_MODE_DOTS) label->lines.text = NULL;
+    else lv_draw_label_lines_update(&label->lines, label->text, font, &attributes);
+#endif
+
     lv_obj_refresh_self_size(obj);
 
     /*In scroll mode start an offset animation*/
@@ -1315,6 +1372,23 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
 }
 
 /* Function created because of this pattern be used in multiple functions */
+#if LV_LABEL_LINE_TABLE
+/**
+ * Get the line table of the label if it's valid with the given parameters
+ * @param label         pointer to a label
+ * @param font          the font of the label
+ * @param attributes    the current text attributes of the label
+ * @return              the line table or NULL if it can't be used
+ */
+static const lv_draw_label_lines_t * get_lines(lv_label_t * label, const lv_font_t * font,
+                                               const lv_text_attributes_t * attributes)
+{
+    if(!lv_draw_label_lines_is_valid(&label->lines, label->text, font, attributes)) return NULL;
+    return &label->lines;
+}
+
+#endif
+
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, lv_area_t * txt_coords, lv_text_attributes_t * attributes)
 {
@@ -562,6 +562,7 @@ static void draw_main(lv_event_t * e)
             int32_t roller_h = lv_obj_get_height(obj);
             const lv_font_t * normal_label_font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
             /*label offset from the middle line of the roller*/
+            lv_obj_sync_coords(label);
             int32_t label_y_prop = (label->coords.y1 + normal_label_font->line_height / 2) - (roller_h / 2 + obj->coords.y1);
 
             /*Proportional position from the middle line.
@@ -765,6 +766,7 @@ static lv_result_t release_handler(lv_obj_t * obj)
             new_opt = 0;
             lv_point_t p;
             lv_indev_get_point(indev, &p);
+            lv_obj_sync_coords(label);
             p.y -= label->coords.y1;
             p.x -= label->coords.x1;
             uint32_t letter_i;
@@ -803,6 +805,7 @@ static lv_result_t release_handler(lv_obj_t * obj)
                 v = v * (100 - scroll_throw) / 100;
             }
 
+            lv_obj_sync_coords(label);
             int32_t label_y1 = label->coords.y1 + sum;
             int32_t id = (mid - label_y1) / label_unit;
 
@@ -690,6 +690,8 @@ lv_span_t * lv_spangroup_get_span_by_point(lv_obj_t * obj, const lv_point_t * p)
 
     if(obj == NULL || p == NULL || lv_ll_get_head(spans) == NULL) return NULL;
 
+    lv_obj_sync_coords(obj);
+
     lv_point_t point;
     point.x = p->x - obj->coords.x1;
     point.y = p->y - obj->coords.y1;
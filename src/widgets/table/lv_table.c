@@ -923,6 +923,7 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
     if(prev_row_size == table->row_h[row]) {
         lv_area_t cell_area;
         get_cell_area(obj, row, col, &cell_area);
+        lv_obj_sync_coords(obj);
         lv_area_move(&cell_area, obj->coords.x1, obj->coords.y1);
         lv_obj_invalidate_area(obj, &cell_area);
     }
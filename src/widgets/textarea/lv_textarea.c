@@ -1030,6 +1030,7 @@ static void cursor_blink_anim_cb(void * obj, int32_t show)
         ta->cursor.show = show ? 1U : 0U;
         lv_area_t area_tmp;
         lv_area_copy(&area_tmp, &ta->cursor.area);
+        lv_obj_sync_coords(ta->label);
         area_tmp.x1 += ta->label->coords.x1;
         area_tmp.y1 += ta->label->coords.y1;
         area_tmp.x2 += ta->label->coords.x1;
@@ -1171,6 +1172,8 @@ static void refr_cursor_area(lv_obj_t * obj)
 
     lv_text_align_t align = lv_obj_calculate_style_text_align(ta->label, LV_PART_MAIN, lv_label_get_text(ta->label));
 
+    lv_obj_sync_coords(ta->label);
+
     /*If the cursor is out of the text (most right) draw it to the next line*/
     if(((letter_pos.x + ta->label->coords.x1) + letter_w > ta->label->coords.x2) &&
        (ta->one_line == 0 && align != LV_TEXT_ALIGN_RIGHT)) {
@@ -1415,6 +1418,7 @@ static void draw_cursor(lv_event_t * e)
     lv_area_t cur_area;
     lv_area_copy(&cur_area, &ta->cursor.area);
 
+    lv_obj_sync_coords(ta->label);
     cur_area.x1 += ta->label->coords.x1;
     cur_area.y1 += ta->label->coords.y1;
     cur_area.x2 += ta->label->coords.x1;
@@ -21,7 +21,11 @@ extern "C" {
 #define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
+#define LV_DRAW_SW_DRAW_UNIT_CNT    2   /* Render with more threads to test the parallel rendering */
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE    64
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE    (32 * 1024)
+#define LV_FONT_FMT_TXT_GID_CACHE_CNT       128
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
 #endif
 
@@ -29,7 +33,12 @@ extern "C" {
 #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
+#define LV_USE_OS               LV_OS_PTHREAD
+#define LV_MEM_THREAD_ARENA_CNT 2   /* Test the arenas of the builtin allocator with the render thread */
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_CHILD_INDEX_MIN_CNT  4
+#define LV_OBJ_LAZY_COORDS      1
+#define LV_OBJ_SCROLL_BLIT      1
 #define LV_BIN_DECODER_RAM_LOAD 0
 #endif
 
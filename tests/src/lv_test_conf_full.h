@@ -2,8 +2,9 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_SHADOW_CACHE_BYTES    (32 * 1024)
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
+#define LV_DRAW_ARENA_SIZE              (64 * 1024)
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
 #define LV_LOG_PRINTF           1
@@ -15,6 +16,11 @@
 #define LV_USE_FLOAT      1
 #define LV_USE_MATRIX     1
 
+/*The SIMD blend functions must render the same images as the plain C ones*/
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LV_USE_DRAW_SW_ASM      LV_DRAW_SW_ASM_X86_SIMD
+#endif
+
 #define LV_FONT_MONTSERRAT_8    1
 #define LV_FONT_MONTSERRAT_10   1
 #define LV_FONT_MONTSERRAT_12   1
@@ -50,6 +56,7 @@
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
 #define LV_LABEL_TEXT_SELECTION     1
+#define LV_LABEL_LINE_TABLE         1
 
 #define LV_USE_CALENDAR_CHINESE 1
 #define LV_USE_LOTTIE 1
@@ -185,6 +185,10 @@
             *  - > 1 means multiple threads will render the screen in parallel. */
             #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+            /** If there are multiple draw units, max. number of draw tasks queued for each render thread.
+            *  More tasks can be dispatched at once but an idle thread might need to steal more often. */
+            #define LV_DRAW_SW_THREAD_QUEUE_SIZE    8
+
             /** Use Arm-2D to accelerate software (sw) rendering. */
             #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -197,10 +201,11 @@
             #define LV_DRAW_SW_COMPLEX          1
 
             #if LV_DRAW_SW_COMPLEX == 1
-                /** Allow buffering some shadow calculation.
-                *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-                *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+                /** Size of the cache storing the blurred corners of the box shadows [bytes].
+                 *  Shadows with the same width, radius and similar size share a corner
+                 *  so they are blurred only once. A corner costs `2 * (shadow_width + radius)^2` bytes.
+                 *  0: disable the cache */
+                #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0
 
                 /** Set number of maximally-cached circle data.
                 *  The circumference of 1/4 circle are saved for anti-aliasing.
@@ -444,6 +449,17 @@
         /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
         #define LV_OBJ_STYLE_CACHE      0
 
+        /** Keep the children of widgets having at least this many children sorted by their Y coordinate
+         *  while refreshing the screen. 0: disable the index */
+        #define LV_OBJ_CHILD_INDEX_MIN_CNT  32
+
+        /** Apply the scroll offset and the movement of widgets to their children only when the
+         *  coordinates of a child are used */
+        #define LV_OBJ_LAZY_COORDS  1
+
+        /** Move the rendered pixels of scrolled widgets in direct render mode */
+        #define LV_OBJ_SCROLL_BLIT  1
+
         /** Add `id` field to `lv_obj_t` */
         #define LV_USE_OBJ_ID           0
 
@@ -1015,6 +1031,9 @@
             /** Profiler end point function with custom tag */
             #define LV_PROFILER_END_TAG   LV_PROFILER_BUILTIN_END_TAG
 
+            /** Profiler function to record the value of a counter */
+            #define LV_PROFILER_COUNTER   LV_PROFILER_BUILTIN_COUNTER
+
             /*Enable layout profiler*/
             #define LV_PROFILER_LAYOUT 1
 
@@ -1104,7 +1123,7 @@
         #endif
 
         /** Enable loading XML UIs runtime */
-        #define LV_USE_XML    0
+        #define LV_USE_XML    1
 
         /*==================
         * DEVICES
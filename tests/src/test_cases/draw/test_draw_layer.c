@@ -6,7 +6,8 @@
 
 void setUp(void)
 {
-    /* Function run before every test */
+    /* The reference images were rendered in one tile */
+    lv_display_set_tile_cnt(NULL, 1);
 }
 
 void tearDown(void)
@@ -68,6 +69,18 @@ void test_draw_layer_bitmap_mask_from_image(void)
 #endif
 }
 
+void test_draw_layer_bitmap_mask_large(void)
+{
+    /*Larger than LV_DRAW_SW_SPLIT_MIN_AREA so with more draw units it could be rendered in bands,
+     *but the mask should be applied only once*/
+    LV_IMAGE_DECLARE(test_image_cogwheel_a8);
+    test_obj_create(&test_image_cogwheel_a8, 512, 0);
+
+#ifndef NON_AMD64_BUILD
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_layer_bitmap_mask_large.png");
+#endif
+}
+
 
 void test_draw_layer_bitmap_mask_from_image_not_found(void)
 {
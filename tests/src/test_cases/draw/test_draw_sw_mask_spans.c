@@ -0,0 +1,97 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define LINE_LEN 200
+
+static lv_opa_t mask_buf[LINE_LEN];
+static lv_draw_sw_mask_span_t spans[8];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void assert_span(uint32_t i, lv_draw_sw_mask_span_type_t type, int32_t len)
+{
+    TEST_ASSERT_EQUAL_INT(type, spans[i].type);
+    TEST_ASSERT_EQUAL_INT32(len, spans[i].len);
+}
+
+void test_draw_sw_mask_spans_rounded_line(void)
+{
+    /*A line at a rounded corner: transparent, anti-aliased edge, covered, edge, transparent*/
+    lv_memset(mask_buf, LV_OPA_COVER, LINE_LEN);
+    lv_memzero(mask_buf, 20);
+    lv_memzero(&mask_buf[LINE_LEN - 20], 20);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        mask_buf[20 + i] = (i + 1) * 60;
+        mask_buf[LINE_LEN - 21 - i] = (i + 1) * 60;
+    }
+
+    uint32_t span_cnt = lv_draw_sw_mask_get_spans(mask_buf, LINE_LEN, spans, 8);
+    TEST_ASSERT_EQUAL_UINT32(5, span_cnt);
+    assert_span(0, LV_DRAW_SW_MASK_SPAN_TRANSP, 20);
+    assert_span(1, LV_DRAW_SW_MASK_SPAN_PARTIAL, 3);
+    assert_span(2, LV_DRAW_SW_MASK_SPAN_FULL_COVER, LINE_LEN - 46);
+    assert_span(3, LV_DRAW_SW_MASK_SPAN_PARTIAL, 3);
+    assert_span(4, LV_DRAW_SW_MASK_SPAN_TRANSP, 20);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, spans[2].opa);
+
+    /*Unaligned start*/
+    span_cnt = lv_draw_sw_mask_get_spans(&mask_buf[1], LINE_LEN - 1, spans, 8);
+    TEST_ASSERT_EQUAL_UINT32(5, span_cnt);
+    assert_span(0, LV_DRAW_SW_MASK_SPAN_TRANSP, 19);
+}
+
+void test_draw_sw_mask_spans_same_opa(void)
+{
+    /*The fill initializes the mask to the opacity of the rectangle*/
+    lv_memset(mask_buf, LV_OPA_50, LINE_LEN);
+    mask_buf[0] = LV_OPA_10;
+
+    uint32_t span_cnt = lv_draw_sw_mask_get_spans(mask_buf, LINE_LEN, spans, 8);
+    TEST_ASSERT_EQUAL_UINT32(2, span_cnt);
+    assert_span(0, LV_DRAW_SW_MASK_SPAN_PARTIAL, 1);
+    assert_span(1, LV_DRAW_SW_MASK_SPAN_FULL_COVER, LINE_LEN - 1);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, spans[1].opa);
+}
+
+void test_draw_sw_mask_spans_short_runs(void)
+{
+    /*Short runs are not worth blending separately*/
+    uint32_t i;
+    for(i = 0; i < LINE_LEN; i++) {
+        mask_buf[i] = (i / 4) % 2 ? LV_OPA_COVER : LV_OPA_TRANSP;
+    }
+
+    uint32_t span_cnt = lv_draw_sw_mask_get_spans(mask_buf, LINE_LEN, spans, 8);
+    TEST_ASSERT_EQUAL_UINT32(1, span_cnt);
+    assert_span(0, LV_DRAW_SW_MASK_SPAN_PARTIAL, LINE_LEN);
+}
+
+void test_draw_sw_mask_spans_overflow(void)
+{
+    /*Alternating long runs, more than the available spans*/
+    uint32_t i;
+    for(i = 0; i < LINE_LEN; i++) {
+        mask_buf[i] = (i / 20) % 2 ? LV_OPA_COVER : LV_OPA_TRANSP;
+    }
+
+    uint32_t span_cnt = lv_draw_sw_mask_get_spans(mask_buf, LINE_LEN, spans, 4);
+    TEST_ASSERT_EQUAL_UINT32(4, span_cnt);
+    assert_span(0, LV_DRAW_SW_MASK_SPAN_TRANSP, 20);
+    assert_span(1, LV_DRAW_SW_MASK_SPAN_FULL_COVER, 20);
+    assert_span(2, LV_DRAW_SW_MASK_SPAN_TRANSP, 20);
+    assert_span(3, LV_DRAW_SW_MASK_SPAN_PARTIAL, LINE_LEN - 60);
+}
+
+#endif
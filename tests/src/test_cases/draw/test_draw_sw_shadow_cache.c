@@ -0,0 +1,145 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+static lv_obj_t * card_create(int32_t w, int32_t h)
+{
+    lv_obj_t * card = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(card, w, h);
+    lv_obj_set_style_radius(card, 8, 0);
+    lv_obj_set_style_shadow_width(card, 20, 0);
+    lv_obj_set_style_shadow_spread(card, 2, 0);
+    lv_obj_set_style_shadow_opa(card, LV_OPA_COVER, 0);
+    return card;
+}
+#endif
+
+void test_draw_sw_shadow_cache_shared_corner(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_ROW_WRAP);
+
+    /*A grid of cards with the same shadow*/
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        card_create(100, 80);
+    }
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_refr_now(NULL);
+
+    /*The corner might be cached already by an other test*/
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, stat.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(11, stat.hit_cnt);
+
+    /*Everything is cached now*/
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(12, stat.hit_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_DRAW_SW_SHADOW_CACHE_BYTES");
+#endif
+}
+
+void test_draw_sw_shadow_cache_small_rect(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    /*The far edges of a small rectangle are visible in the corner so it needs an other corner*/
+    lv_obj_t * card = card_create(100, 80);
+    lv_obj_t * small_card = card_create(20, 20);
+    lv_obj_align(card, LV_ALIGN_LEFT_MID, 40, 0);
+    lv_obj_align(small_card, LV_ALIGN_RIGHT_MID, -40, 0);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.hit_cnt);
+
+    /*A larger card gets the same corner as the first one*/
+    lv_obj_set_size(card, 200, 160);
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_DRAW_SW_SHADOW_CACHE_BYTES");
+#endif
+}
+
+void test_draw_sw_shadow_cache_too_large(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    /*The corner of the large shadow doesn't fit in the cache so it shouldn't evict the small one*/
+    lv_obj_t * card = card_create(100, 80);
+    lv_obj_t * large_card = card_create(200, 200);
+    lv_obj_set_style_shadow_width(large_card, 200, 0);
+    lv_obj_align(card, LV_ALIGN_LEFT_MID, 40, 0);
+    lv_obj_align(large_card, LV_ALIGN_RIGHT_MID, -40, 0);
+
+    /*Each tile would miss the large corner again*/
+    uint32_t tile_cnt = lv_display_get_tile_cnt(NULL);
+    lv_display_set_tile_cnt(NULL, 1);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    lv_display_set_tile_cnt(NULL, tile_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_DRAW_SW_SHADOW_CACHE_BYTES");
+#endif
+}
+
+void test_draw_sw_shadow_cache_split(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES
+    /*A large shadow might be drawn in bands by more threads but the corner is blurred only once*/
+    lv_obj_t * card = card_create(400, 300);
+    lv_obj_set_style_shadow_width(card, 31, 0);
+    lv_obj_center(card);
+
+    lv_draw_sw_shadow_cache_stat_t stat;
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+
+    lv_draw_sw_shadow_cache_reset_stat();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stat.hit_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_DRAW_SW_SHADOW_CACHE_BYTES");
+#endif
+}
+
+#endif
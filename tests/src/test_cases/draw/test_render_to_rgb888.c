@@ -7,7 +7,8 @@
 
 void setUp(void)
 {
-    /* Function run before every test */
+    /* The reference images were rendered in one tile */
+    lv_display_set_tile_cnt(NULL, 1);
 }
 
 void tearDown(void)
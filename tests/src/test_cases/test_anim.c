@@ -263,4 +263,81 @@ void test_anim_vsync_mode(void)
     lv_anim_delete(&var, exec_cb);
 }
 
+static uint32_t completed_order[8];
+static uint32_t completed_cnt;
+static int32_t vars[8];
+
+static void order_completed_cb(lv_anim_t * a)
+{
+    if(completed_cnt < 8) completed_order[completed_cnt] = (uint32_t)((int32_t *)a->var - vars);
+    completed_cnt++;
+}
+
+static void start_anims(uint32_t cnt, lv_anim_completed_cb_t completed_cb)
+{
+    completed_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_set_values(&a, 0, 100);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_duration(&a, 100);
+        lv_anim_set_completed_cb(&a, completed_cb);
+        lv_anim_start(&a);
+    }
+}
+
+void test_anim_complete_together(void)
+{
+    start_anims(8, order_completed_cb);
+    lv_test_wait(100);
+
+    /*All are completed in the same round in the order of the list (the newest first)*/
+    TEST_ASSERT_EQUAL_UINT32(8, completed_cnt);
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_UINT32(7 - i, completed_order[i]);
+        TEST_ASSERT_EQUAL_INT32(100, vars[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+}
+
+static void delete_next_completed_cb(lv_anim_t * a)
+{
+    order_completed_cb(a);
+    /*Delete the animation which would be handled next*/
+    if(a->var == &vars[7]) lv_anim_delete(&vars[6], exec_cb);
+}
+
+void test_anim_delete_next_in_completed_cb(void)
+{
+    start_anims(8, delete_next_completed_cb);
+    lv_test_wait(100);
+
+    TEST_ASSERT_EQUAL_UINT32(7, completed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(7, completed_order[0]);
+    TEST_ASSERT_EQUAL_UINT32(5, completed_order[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, completed_order[6]);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+}
+
+static void refr_now_completed_cb(lv_anim_t * a)
+{
+    order_completed_cb(a);
+    /*Handle the animations from a callback too*/
+    lv_refr_now(NULL);
+}
+
+void test_anim_refr_now_in_completed_cb(void)
+{
+    start_anims(8, refr_now_completed_cb);
+    lv_test_wait(500);
+
+    /*Each animation is completed exactly once*/
+    TEST_ASSERT_EQUAL_UINT32(8, completed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+}
+
 #endif
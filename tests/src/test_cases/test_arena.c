@@ -0,0 +1,184 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_arena_t arena;
+
+void setUp(void)
+{
+    lv_arena_init(&arena, 256);
+}
+
+void tearDown(void)
+{
+    lv_arena_deinit(&arena);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_arena_alloc(void)
+{
+    uint8_t * p1 = lv_arena_alloc_zeroed(&arena, 10);
+    uint8_t * p2 = lv_arena_alloc_zeroed(&arena, 20);
+    TEST_ASSERT_NOT_NULL(p1);
+    TEST_ASSERT_NOT_NULL(p2);
+    TEST_ASSERT_TRUE(lv_arena_owns(&arena, p1));
+    TEST_ASSERT_TRUE(lv_arena_owns(&arena, p2));
+
+    /*The blocks are aligned and don't overlap*/
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)p1 % LV_ARENA_ALIGN);
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)p2 % LV_ARENA_ALIGN);
+    TEST_ASSERT_TRUE(p2 >= p1 + 10);
+
+    for(uint32_t i = 0; i < 20; i++) TEST_ASSERT_EQUAL_UINT8(0, p2[i]);
+
+    TEST_ASSERT_EQUAL_UINT32(2, arena.alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, arena.live_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.fallback_cnt);
+
+    lv_arena_free(&arena, p1);
+    lv_arena_free(&arena, p2);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.live_cnt);
+}
+
+void test_arena_fallback(void)
+{
+    void * p1 = lv_arena_alloc_zeroed(&arena, 200);
+    void * p2 = lv_arena_alloc_zeroed(&arena, 200);
+    TEST_ASSERT_NOT_NULL(p1);
+    TEST_ASSERT_NOT_NULL(p2);
+    TEST_ASSERT_TRUE(lv_arena_owns(&arena, p1));
+    TEST_ASSERT_FALSE(lv_arena_owns(&arena, p2));
+    TEST_ASSERT_EQUAL_UINT32(1, arena.alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, arena.fallback_cnt);
+
+    /*Freeing the fallback block doesn't affect the arena*/
+    lv_arena_free(&arena, p2);
+    TEST_ASSERT_EQUAL_UINT32(1, arena.live_cnt);
+    lv_arena_free(&arena, p1);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.live_cnt);
+}
+
+void test_arena_zero_size(void)
+{
+    lv_arena_deinit(&arena);
+    lv_arena_init(&arena, 0);
+
+    void * p = lv_arena_alloc_zeroed(&arena, 8);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_FALSE(lv_arena_owns(&arena, p));
+    TEST_ASSERT_EQUAL_UINT32(1, arena.fallback_cnt);
+    lv_arena_free(&arena, p);
+}
+
+void test_arena_reset(void)
+{
+    void * p1 = lv_arena_alloc_zeroed(&arena, 100);
+    void * p2 = lv_arena_alloc_zeroed(&arena, 100);
+
+    /*Can't be reset while a block is in use*/
+    lv_arena_free(&arena, p1);
+    TEST_ASSERT_FALSE(lv_arena_reset(&arena));
+    TEST_ASSERT_NOT_EQUAL(0, arena.used);
+
+    lv_arena_free(&arena, p2);
+    TEST_ASSERT_TRUE(lv_arena_reset(&arena));
+    TEST_ASSERT_EQUAL_UINT32(0, arena.used);
+
+    /*The memory is reused after the reset*/
+    void * p3 = lv_arena_alloc_zeroed(&arena, 100);
+    TEST_ASSERT_EQUAL_PTR(p1, p3);
+    lv_arena_free(&arena, p3);
+
+    /*The statistics are kept until they are reset*/
+    TEST_ASSERT_EQUAL_UINT32(3, arena.alloc_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(200, arena.used_max);
+    lv_arena_reset_stat(&arena);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(arena.used, arena.used_max);
+}
+
+void test_arena_reused_when_all_freed(void)
+{
+    void * p1 = lv_arena_alloc_zeroed(&arena, 100);
+    void * p2 = lv_arena_alloc_zeroed(&arena, 100);
+    lv_arena_free(&arena, p2);
+    lv_arena_free(&arena, p1);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.used);
+
+    /*No explicit reset is required*/
+    void * p3 = lv_arena_alloc_zeroed(&arena, 200);
+    TEST_ASSERT_EQUAL_PTR(p1, p3);
+    TEST_ASSERT_EQUAL_UINT32(0, arena.fallback_cnt);
+    lv_arena_free(&arena, p3);
+}
+
+#if LV_DRAW_ARENA_SIZE
+static uint32_t refr_get_arena_used_max(const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+    lv_arena_reset_stat(&disp->draw_arena);
+    lv_inv_area(disp, a1);
+    if(a2) lv_inv_area(disp, a2);
+    lv_refr_now(disp);
+    return disp->draw_arena.used_max;
+}
+
+void test_arena_draw_tasks_reused_per_area(void)
+{
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_label_set_text_fmt(label, "Label %" LV_PRIu32, i);
+        lv_obj_set_pos(label, 10, i * 20);
+        label = lv_label_create(lv_screen_active());
+        lv_label_set_text_fmt(label, "Label %" LV_PRIu32, i);
+        lv_obj_set_pos(label, 600, i * 20);
+    }
+
+    lv_area_t left = {0, 0, 100, 399};
+    lv_area_t right = {600, 0, 700, 399};
+    uint32_t left_max = refr_get_arena_used_max(&left, NULL);
+    uint32_t right_max = refr_get_arena_used_max(&right, NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, left_max);
+
+    /*The areas are drawn one after the other, using the same memory*/
+    TEST_ASSERT_EQUAL_UINT32(LV_MAX(left_max, right_max), refr_get_arena_used_max(&left, &right));
+}
+
+void test_arena_draw_tasks(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_arena_reset_stat(&disp->draw_arena);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_pos(obj, (i % 5) * 150, (i / 5) * 100);
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "Label %" LV_PRIu32, i);
+    }
+
+    lv_refr_now(NULL);
+
+    /*The draw tasks were allocated from the arena and it was reset after the refresh*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, disp->draw_arena.alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->draw_arena.fallback_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->draw_arena.live_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->draw_arena.used);
+
+    /*Draw tasks created outside of a refresh are allocated by `lv_malloc`*/
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    lv_area_t a = {0, 0, 9, 9};
+    lv_draw_task_t * t = lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+    TEST_ASSERT_NULL(t->arena);
+    t->state = LV_DRAW_TASK_STATE_FINISHED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+}
+#endif
+
+#endif
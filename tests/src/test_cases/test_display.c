@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 #include "unity/unity.h"
 
 /*Bypassing resolution check*/
@@ -205,4 +206,136 @@ void test_display_triple_buffer(void)
     lv_draw_buf_destroy(buf3);
 }
 
+static uint8_t * pipeline_fb;
+static uint32_t pipeline_flush_cnt;
+static uint32_t pipeline_flush_last_cnt;
+
+static void pipeline_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
+{
+    /*Copy the stripe to a full frame buffer to compare the results*/
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_XRGB8888);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&pipeline_fb[(y * 240 + area->x1) * 4], color_p, lv_area_get_width(area) * 4);
+        color_p += stride;
+    }
+
+    pipeline_flush_cnt++;
+    if(lv_display_flush_is_last(disp)) pipeline_flush_last_cnt++;
+    lv_display_flush_ready(disp);
+}
+
+static void pipeline_render(bool pipeline, uint8_t * fb, lv_draw_buf_t * buf3)
+{
+    lv_display_t * disp = lv_display_create(240, 160);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_XRGB8888);
+    lv_display_set_flush_cb(disp, pipeline_flush_cb);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(240, 16, LV_COLOR_FORMAT_XRGB8888, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(240, 16, LV_COLOR_FORMAT_XRGB8888, 0);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    if(buf3) lv_display_set_3rd_draw_buffer(disp, buf3);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    /*Compare only the effect of pipelining, not how the stripes are split into tiles*/
+    lv_display_set_tile_cnt(disp, 1);
+    lv_display_set_render_pipeline(disp, pipeline);
+    TEST_ASSERT_EQUAL(pipeline, lv_display_get_render_pipeline(disp));
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 150, 100);
+    lv_obj_center(obj);
+    lv_obj_set_style_transform_rotation(obj, 150, 0);
+    lv_obj_set_style_shadow_width(obj, 20, 0);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Pipelined\nrendering");
+
+    pipeline_fb = fb;
+    pipeline_flush_cnt = 0;
+    pipeline_flush_last_cnt = 0;
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+
+    /*Every stripe is flushed exactly once and only the last one is marked as last*/
+    TEST_ASSERT_EQUAL(10, pipeline_flush_cnt);
+    TEST_ASSERT_EQUAL(1, pipeline_flush_last_cnt);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+void test_display_render_pipeline(void)
+{
+    lv_display_t * disp_ori = lv_display_get_default();
+    uint8_t * fb_ref = lv_malloc_zeroed(240 * 160 * 4);
+    uint8_t * fb_pipeline = lv_malloc_zeroed(240 * 160 * 4);
+    lv_draw_buf_t * buf3 = lv_draw_buf_create(240, 16, LV_COLOR_FORMAT_XRGB8888, 0);
+
+    pipeline_render(false, fb_ref, NULL);
+    pipeline_render(true, fb_pipeline, NULL);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, fb_pipeline, 240 * 160 * 4);
+
+    lv_memzero(fb_pipeline, 240 * 160 * 4);
+    pipeline_render(true, fb_pipeline, buf3);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, fb_pipeline, 240 * 160 * 4);
+
+    lv_draw_buf_destroy(buf3);
+    lv_free(fb_ref);
+    lv_free(fb_pipeline);
+    lv_display_set_default(disp_ori);
+}
+
+static uint32_t flushed_px;
+
+static void count_px_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
+{
+    LV_UNUSED(color_p);
+    flushed_px += lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+void test_display_many_invalidated_areas(void)
+{
+    lv_display_t * disp_ori = lv_display_get_default();
+    lv_display_t * disp = lv_display_create(480, 320);
+    lv_display_set_flush_cb(disp, count_px_flush_cb);
+    lv_draw_buf_t * buf = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_display_set_draw_buffers(disp, buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_refr_now(disp);
+
+    /*Much more small areas than slots. They are far from each other so they shouldn't be joined.*/
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < 10; y++) {
+        for(x = 0; x < 12; x++) {
+            lv_area_t a;
+            lv_area_set(&a, x * 40, y * 32, x * 40 + 9, y * 32 + 9);
+            lv_inv_area(disp, &a);
+        }
+    }
+
+    flushed_px = 0;
+    lv_refr_now(disp);
+
+    /*The areas are merged with their neighbors instead of redrawing the whole screen*/
+    TEST_ASSERT_GREATER_OR_EQUAL(120 * 100, flushed_px);
+    TEST_ASSERT_LESS_THAN(480 * 320 / 2, flushed_px);
+
+    /*An area covering the saved areas replaces them*/
+    lv_area_t small;
+    lv_area_t large;
+    lv_area_set(&small, 10, 10, 19, 19);
+    lv_area_set(&large, 0, 0, 99, 99);
+    lv_inv_area(disp, &small);
+    lv_inv_area(disp, &large);
+    flushed_px = 0;
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(100 * 100, flushed_px);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf);
+    lv_display_set_default(disp_ori);
+}
+
 #endif
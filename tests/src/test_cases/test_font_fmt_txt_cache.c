@@ -0,0 +1,50 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_font_fmt_txt_cache_hit_and_drop(void)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE && LV_FONT_FMT_TXT_GID_CACHE_CNT
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    lv_label_set_text(label, "Hello cache!");
+    lv_refr_now(NULL);
+
+    /*All the glyphs are cached now*/
+    lv_font_fmt_txt_cache_stat_t stat;
+    lv_font_fmt_txt_cache_reset_stat();
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    lv_font_fmt_txt_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.glyph_miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.gid_miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.glyph_hit_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.gid_hit_cnt);
+
+    /*After dropping the font's data the glyphs are looked up and unpacked again*/
+    lv_font_fmt_txt_cache_drop(&lv_font_montserrat_14);
+    lv_font_fmt_txt_cache_reset_stat();
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    lv_font_fmt_txt_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.glyph_miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.gid_miss_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE and LV_FONT_FMT_TXT_GID_CACHE_CNT");
+#endif
+}
+
+#endif
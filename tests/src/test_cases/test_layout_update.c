@@ -0,0 +1,143 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CONT_CNT    10
+#define LABEL_CNT   30
+
+static lv_obj_t * conts[CONT_CNT];
+
+void setUp(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < CONT_CNT; i++) {
+        conts[i] = lv_obj_create(scr);
+        lv_obj_set_size(conts[i], LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(conts[i], LV_FLEX_FLOW_COLUMN);
+
+        uint32_t j;
+        for(j = 0; j < LABEL_CNT; j++) {
+            lv_obj_t * label = lv_label_create(conts[i]);
+            lv_label_set_text_fmt(label, "%" LV_PRIu32 ". label", j);
+        }
+    }
+
+    lv_obj_update_layout(scr);
+}
+
+static void mark_all_as_dirty(lv_obj_t * obj)
+{
+    lv_obj_mark_layout_as_dirty(obj);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        mark_all_as_dirty(lv_obj_get_child(obj, i));
+    }
+}
+
+static void get_all_coords(lv_obj_t * obj, lv_area_t * coords, uint32_t * cnt)
+{
+    lv_obj_get_coords(obj, &coords[*cnt]);
+    (*cnt)++;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        get_all_coords(lv_obj_get_child(obj, i), coords, cnt);
+    }
+}
+
+/*Compare the result of the incremental update with updating the layout of all objects*/
+static void assert_same_as_full_update(void)
+{
+    static lv_area_t coords_incr[CONT_CNT * (LABEL_CNT + 1) + 1];
+    static lv_area_t coords_full[CONT_CNT * (LABEL_CNT + 1) + 1];
+    lv_obj_t * scr = lv_screen_active();
+
+    uint32_t cnt_incr = 0;
+    get_all_coords(scr, coords_incr, &cnt_incr);
+
+    mark_all_as_dirty(scr);
+    lv_obj_update_layout(scr);
+
+    uint32_t cnt_full = 0;
+    get_all_coords(scr, coords_full, &cnt_full);
+
+    TEST_ASSERT_EQUAL_UINT32(cnt_full, cnt_incr);
+    TEST_ASSERT_EQUAL_MEMORY(coords_full, coords_incr, cnt_full * sizeof(lv_area_t));
+}
+
+void tearDown(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_clean(scr);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW);
+    lv_obj_set_layout(scr, LV_LAYOUT_NONE);
+}
+
+void test_layout_update_visits_dirty_subtree(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    /*All the objects were visited in the first update*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(CONT_CNT * (LABEL_CNT + 1) + 1, LV_GLOBAL_DEFAULT()->layout_visited_cnt);
+
+    lv_obj_t * label = lv_obj_get_child(conts[5], 10);
+    lv_obj_t * next_label = lv_obj_get_child(conts[5], 11);
+    int32_t label_h = lv_obj_get_height(label);
+    int32_t next_label_y = lv_obj_get_y(next_label);
+    int32_t cont_h = lv_obj_get_height(conts[5]);
+    int32_t next_cont_y = lv_obj_get_y(conts[6]);
+
+    lv_label_set_text(label, "A\nmulti\nline\ntext");
+    lv_obj_update_layout(scr);
+
+    /*Everything depending on the label moved*/
+    int32_t diff = lv_obj_get_height(label) - label_h;
+    TEST_ASSERT_GREATER_THAN_INT32(0, diff);
+    TEST_ASSERT_EQUAL_INT32(next_label_y + diff, lv_obj_get_y(next_label));
+    TEST_ASSERT_EQUAL_INT32(cont_h + diff, lv_obj_get_height(conts[5]));
+    TEST_ASSERT_EQUAL_INT32(next_cont_y + diff, lv_obj_get_y(conts[6]));
+
+    /*The children of the resized container are updated too, but the other containers are not visited*/
+    uint32_t visited_cnt = LV_GLOBAL_DEFAULT()->layout_visited_cnt;
+    uint32_t updated_cnt = LV_GLOBAL_DEFAULT()->layout_updated_cnt;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, updated_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(updated_cnt + 10, visited_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(2 * LABEL_CNT, visited_cnt);
+
+    assert_same_as_full_update();
+}
+
+void test_layout_update_nothing_to_do(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    /*Invalidating and updating again visits only the path to the invalidated object*/
+    lv_obj_t * label = lv_obj_get_child(conts[CONT_CNT - 1], LABEL_CNT - 1);
+    lv_obj_mark_layout_as_dirty(label);
+    lv_obj_update_layout(scr);
+
+    TEST_ASSERT_EQUAL_UINT32(1, LV_GLOBAL_DEFAULT()->layout_updated_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, LV_GLOBAL_DEFAULT()->layout_visited_cnt);
+}
+
+void test_layout_update_moved_subtree(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    /*A dirty object moved to an other parent is still updated*/
+    lv_obj_t * label = lv_obj_get_child(conts[0], 0);
+    lv_label_set_text(label, "A much longer text than before");
+    lv_obj_set_parent(label, conts[1]);
+    lv_obj_update_layout(scr);
+
+    TEST_ASSERT_EQUAL_PTR(label, lv_obj_get_child(conts[1], LABEL_CNT));
+    TEST_ASSERT_GREATER_THAN_INT32(lv_obj_get_y2(lv_obj_get_child(conts[1], LABEL_CNT - 1)), lv_obj_get_y(label));
+
+    assert_same_as_full_update();
+}
+
+#endif
@@ -50,4 +50,71 @@ void test_memcpy_unaligned(void)
     }
 }
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_OS && LV_MEM_THREAD_ARENA_CNT
+#define ARENA_TEST_BLOCK_CNT 64
+
+static void * arena_test_blocks[2][ARENA_TEST_BLOCK_CNT];
+
+static void arena_test_thread_cb(void * user_data)
+{
+    void ** blocks = user_data;
+    uint32_t i;
+    for(i = 0; i < ARENA_TEST_BLOCK_CNT; i++) {
+        blocks[i] = lv_malloc(16 + i * 8);
+        if(blocks[i]) lv_memset(blocks[i], (int)i, 16 + i * 8);
+    }
+}
+#endif
+
+void test_mem_thread_arenas(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_OS && LV_MEM_THREAD_ARENA_CNT
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    lv_thread_t threads[2];
+    uint32_t t;
+    for(t = 0; t < 2; t++) {
+        lv_thread_init(&threads[t], "arena_test", LV_THREAD_PRIO_MID, arena_test_thread_cb, 8 * 1024, arena_test_blocks[t]);
+    }
+    for(t = 0; t < 2; t++) {
+        lv_thread_delete(&threads[t]);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt + 2 * ARENA_TEST_BLOCK_CNT, mon.used_cnt);
+    TEST_ASSERT_LESS_THAN(mon_start.free_size, mon.free_size);
+
+    /*Grow a block of an other thread beyond its arena*/
+    arena_test_blocks[0][0] = lv_realloc(arena_test_blocks[0][0], LV_MEM_THREAD_ARENA_SIZE * 2);
+    TEST_ASSERT_NOT_NULL(arena_test_blocks[0][0]);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, arena_test_blocks[0][0], 16);
+
+    /*Free the blocks of the other threads in this thread*/
+    uint32_t i;
+    for(t = 0; t < 2; t++) {
+        for(i = 0; i < ARENA_TEST_BLOCK_CNT; i++) {
+            TEST_ASSERT_NOT_NULL(arena_test_blocks[t][i]);
+            lv_free(arena_test_blocks[t][i]);
+        }
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    /*The blocks are only queued in their arenas without locking them*/
+    bool queued = false;
+    for(i = 0; i < LV_MEM_THREAD_ARENA_CNT; i++) {
+        if(LV_GLOBAL_DEFAULT()->tlsf_state.arenas[i].remote_free) queued = true;
+    }
+    TEST_ASSERT_TRUE(queued);
+#endif
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN, LV_USE_OS and LV_MEM_THREAD_ARENA_CNT");
+#endif
+}
+
 #endif
@@ -0,0 +1,194 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define ROW_CNT     20
+#define ITEM_CNT    4
+
+static lv_obj_t * list;
+static lv_obj_t * rows[ROW_CNT];
+static lv_obj_t * floating;
+
+void setUp(void)
+{
+    list = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(list, 300, 200);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        rows[i] = lv_obj_create(list);
+        lv_obj_set_size(rows[i], LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(rows[i], LV_FLEX_FLOW_ROW);
+
+        uint32_t j;
+        for(j = 0; j < ITEM_CNT; j++) {
+            lv_obj_t * btn = lv_button_create(rows[i]);
+            lv_obj_t * label = lv_label_create(btn);
+            lv_label_set_text_fmt(label, "%" LV_PRIu32 "/%" LV_PRIu32, i, j);
+        }
+    }
+
+    floating = lv_obj_create(list);
+    lv_obj_set_size(floating, 40, 40);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_align(floating, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+
+    lv_obj_update_layout(list);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_OBJ_LAZY_COORDS
+static void get_all_coords(lv_obj_t * obj, lv_area_t * coords, uint32_t * cnt)
+{
+    lv_obj_get_coords(obj, &coords[*cnt]);
+    (*cnt)++;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        get_all_coords(lv_obj_get_child(obj, i), coords, cnt);
+    }
+}
+
+static void assert_moved_by(const lv_area_t * a_ori, const lv_area_t * a_act, int32_t x, int32_t y)
+{
+    TEST_ASSERT_EQUAL_INT32(a_ori->x1 + x, a_act->x1);
+    TEST_ASSERT_EQUAL_INT32(a_ori->y1 + y, a_act->y1);
+    TEST_ASSERT_EQUAL_INT32(a_ori->x2 + x, a_act->x2);
+    TEST_ASSERT_EQUAL_INT32(a_ori->y2 + y, a_act->y2);
+}
+#endif
+
+void test_obj_lazy_coords_scroll(void)
+{
+#if LV_OBJ_LAZY_COORDS
+    static lv_area_t coords_ori[ROW_CNT * (ITEM_CNT * 2 + 1) + 2];
+    static lv_area_t coords_act[ROW_CNT * (ITEM_CNT * 2 + 1) + 2];
+
+    uint32_t cnt = 0;
+    get_all_coords(list, coords_ori, &cnt);
+
+    lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(rows[ROW_CNT - 1], 0), 0);
+    lv_area_t label_coords = label->coords;
+
+    /*Scroll like an input device does while dragging*/
+    lv_obj_scroll_by_raw(list, 0, -30);
+    lv_obj_scroll_by_raw(list, 0, -25);
+    lv_obj_scroll_by_raw(list, 0, 15);
+
+    /*Scrolling shouldn't touch the descendants*/
+    TEST_ASSERT_EQUAL_INT32(label_coords.y1, label->coords.y1);
+
+    cnt = 0;
+    get_all_coords(list, coords_act, &cnt);
+
+    /*The list itself and the floating object shouldn't move, all the others should*/
+    assert_moved_by(&coords_ori[0], &coords_act[0], 0, 0);
+    assert_moved_by(&coords_ori[cnt - 1], &coords_act[cnt - 1], 0, 0);
+    uint32_t i;
+    for(i = 1; i < cnt - 1; i++) {
+        assert_moved_by(&coords_ori[i], &coords_act[i], 0, -40);
+    }
+
+    /*The raw coordinates are up to date after reading them via the API*/
+    TEST_ASSERT_EQUAL_INT32(label_coords.y1 - 40, label->coords.y1);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_obj_lazy_coords_nested_scroll(void)
+{
+#if LV_OBJ_LAZY_COORDS
+    lv_obj_t * btn = lv_obj_get_child(rows[0], 0);
+    lv_obj_t * label = lv_obj_get_child(btn, 0);
+    lv_area_t ori;
+    lv_obj_get_coords(label, &ori);
+
+    lv_obj_scroll_by(list, 0, -20, LV_ANIM_OFF);
+    lv_obj_scroll_by(rows[0], 0, -5, LV_ANIM_OFF);
+    lv_obj_scroll_by(list, 0, 8, LV_ANIM_OFF);
+    lv_obj_move_children_by(btn, 3, 0, false);
+
+    lv_area_t act;
+    lv_obj_get_coords(label, &act);
+    assert_moved_by(&ori, &act, 3, -17);
+
+    /*Hit testing and refreshing should see the same coordinates*/
+    lv_point_t p = {(act.x1 + act.x2) / 2, (act.y1 + act.y2) / 2};
+    TEST_ASSERT_EQUAL_PTR(btn, lv_indev_search_obj(lv_screen_active(), &p));
+    lv_refr_now(NULL);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_obj_lazy_coords_floating(void)
+{
+#if LV_OBJ_LAZY_COORDS
+    lv_obj_t * obj = rows[1];
+    lv_area_t ori;
+    lv_area_t act;
+
+    lv_obj_get_coords(obj, &ori);
+    lv_obj_scroll_by(list, 0, -10, LV_ANIM_OFF);
+
+    /*A floating object stops following the scrolling but keeps its current position*/
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_FLOATING);
+    lv_obj_get_coords(obj, &act);
+    assert_moved_by(&ori, &act, 0, -10);
+
+    lv_obj_scroll_by(list, 0, -10, LV_ANIM_OFF);
+    lv_obj_get_coords(obj, &act);
+    assert_moved_by(&ori, &act, 0, -10);
+
+    /*...and follows it again when the flag is removed*/
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_FLOATING);
+    lv_obj_scroll_by(list, 0, 5, LV_ANIM_OFF);
+    lv_obj_get_coords(obj, &act);
+    assert_moved_by(&ori, &act, 0, -5);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_obj_lazy_coords_set_parent(void)
+{
+#if LV_OBJ_LAZY_COORDS
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 100, 100);
+    lv_obj_set_pos(cont, 400, 0);
+    lv_obj_update_layout(cont);
+
+    lv_obj_t * btn = lv_obj_get_child(rows[2], 0);
+    lv_obj_scroll_by(list, 0, -30, LV_ANIM_OFF);
+
+    /*The pending scroll of the old parent shouldn't be applied in the new parent*/
+    lv_obj_set_parent(btn, cont);
+    lv_obj_set_pos(btn, 0, 0);
+    lv_obj_update_layout(cont);
+
+    lv_area_t a;
+    lv_obj_get_coords(btn, &a);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.x1 + lv_obj_get_style_space_left(cont, LV_PART_MAIN), a.x1);
+    TEST_ASSERT_EQUAL_INT32(cont->coords.y1 + lv_obj_get_style_space_top(cont, LV_PART_MAIN), a.y1);
+
+    lv_obj_t * label = lv_obj_get_child(btn, 0);
+    lv_obj_get_coords(label, &a);
+    TEST_ASSERT_TRUE(lv_area_is_in(&a, &btn->coords, 0));
+
+    lv_obj_scroll_by(list, 0, 20, LV_ANIM_OFF);
+    lv_area_t b;
+    lv_obj_get_coords(label, &b);
+    assert_moved_by(&a, &b, 0, 0);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -98,4 +98,108 @@ void test_profiler_disable(void)
     TEST_ASSERT_EQUAL_CHAR(output_buf[4][0], '\0');
 }
 
+void test_profiler_counter(void)
+{
+    lv_profiler_builtin_set_enable(true);
+
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    lv_profiler_builtin_counter("counter", 42);
+    lv_profiler_builtin_counter("counter", -3);
+
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_INT(output_line, 2);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "   LVGL-1 [0] 0.000000000: tracing_mark_write: C|1|counter|42\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[1], "   LVGL-1 [0] 1.000000000: tracing_mark_write: C|1|counter|-3\n");
+}
+
+void test_profiler_chrome_json(void)
+{
+    lv_profiler_builtin_uninit();
+
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1000; /* One tick is 1000 microseconds */
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cb;
+    config.format = LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(true);
+
+    profiler_tick = 0;
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    LV_PROFILER_END_TAG("custom_tag");
+    lv_profiler_builtin_counter("counter", 7);
+
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_INT(output_line, 4);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "[\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[1],
+                             "{\"name\":\"custom_tag\",\"ph\":\"B\",\"ts\":0.000,\"pid\":1,\"tid\":1},\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[2],
+                             "{\"name\":\"custom_tag\",\"ph\":\"E\",\"ts\":1000.000,\"pid\":1,\"tid\":1},\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[3],
+                             "{\"name\":\"counter\",\"ph\":\"C\",\"ts\":2000.000,\"pid\":1,\"tid\":1,\"args\":{\"value\":7}},\n");
+}
+
+#if LV_USE_OS
+static int test_tid = 1;
+
+static int tid_get_cb(void)
+{
+    return test_tid;
+}
+#endif
+
+void test_profiler_thread_rings(void)
+{
+#if LV_USE_OS
+    lv_profiler_builtin_uninit();
+
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1;
+    config.tick_get_cb = get_tick_cb;
+    config.tid_get_cb = tid_get_cb;
+    config.flush_cb = flush_cb;
+    test_tid = 1;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(true);
+
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+
+    /* interleave the events of two threads */
+    LV_PROFILER_BEGIN_TAG("a");
+    test_tid = 2;
+    LV_PROFILER_BEGIN_TAG("b");
+    test_tid = 1;
+    LV_PROFILER_END_TAG("a");
+    test_tid = 2;
+    LV_PROFILER_END_TAG("b");
+    test_tid = 1;
+
+    lv_profiler_builtin_flush();
+
+    /* every thread's buffer is flushed in one go */
+    TEST_ASSERT_EQUAL_INT(output_line, 4);
+    TEST_ASSERT_EQUAL_STRING(output_buf[0], "   LVGL-1 [0] 0.000000000: tracing_mark_write: B|1|a\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[1], "   LVGL-1 [0] 2.000000000: tracing_mark_write: E|1|a\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[2], "   LVGL-2 [0] 1.000000000: tracing_mark_write: B|1|b\n");
+    TEST_ASSERT_EQUAL_STRING(output_buf[3], "   LVGL-2 [0] 3.000000000: tracing_mark_write: E|1|b\n");
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif
@@ -0,0 +1,187 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * list;
+static uint8_t * ref_buf;
+
+void setUp(void)
+{
+#if !LV_OBJ_SCROLL_BLIT
+    TEST_IGNORE_MESSAGE("Requires LV_OBJ_SCROLL_BLIT");
+#endif
+
+    list = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(list, 300, 300);
+    lv_obj_set_pos(list, 20, 20);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_obj_t * btn = lv_button_create(list);
+        lv_obj_set_width(btn, LV_PCT(100));
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Button %" LV_PRIu32, i);
+    }
+
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_free(ref_buf);
+    ref_buf = NULL;
+}
+
+/*Refresh the screen and return the number of redrawn pixels*/
+static uint32_t refr(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    disp->redrawn_px_sum = 0;
+    lv_refr_now(disp);
+    return disp->redrawn_px_sum;
+}
+
+/*The screen should look the same as after redrawing everything*/
+static void assert_same_as_full_redraw(void)
+{
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    uint32_t size = draw_buf->header.stride * draw_buf->header.h;
+    if(ref_buf == NULL) ref_buf = lv_malloc(size);
+    lv_memcpy(ref_buf, draw_buf->data, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    refr();
+
+    TEST_ASSERT_EQUAL_MEMORY(draw_buf->data, ref_buf, size);
+}
+
+void test_scroll_blit_vertical(void)
+{
+    int32_t list_size = lv_area_get_size(&list->coords);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_scroll_by_raw(list, 0, -7);
+        /*Only the uncovered strip and the scrollbar should be redrawn*/
+        TEST_ASSERT_LESS_THAN_UINT32(list_size / 4, refr());
+        assert_same_as_full_redraw();
+    }
+
+    /*Scroll back*/
+    lv_obj_scroll_by_raw(list, 0, 20);
+    TEST_ASSERT_LESS_THAN_UINT32(list_size / 4, refr());
+    assert_same_as_full_redraw();
+}
+
+void test_scroll_blit_multiple_scrolls(void)
+{
+    /*The offsets are summed up until the next refresh*/
+    lv_obj_scroll_by_raw(list, 0, -10);
+    lv_obj_scroll_by_raw(list, 0, -15);
+    lv_obj_scroll_by_raw(list, 0, 5);
+    refr();
+    assert_same_as_full_redraw();
+
+    /*Changes before scrolling are moved too, changes after scrolling are where they are*/
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(list, 3), 0), "Changed before");
+    lv_obj_scroll_by_raw(list, 0, -12);
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(list, 5), 0), "Changed after");
+    lv_obj_scroll_by_raw(list, 0, 4);
+    refr();
+    assert_same_as_full_redraw();
+
+    /*Scrolling out everything redraws the whole list*/
+    lv_obj_scroll_by_raw(list, 0, -150);
+    lv_obj_scroll_by_raw(list, 0, -250);
+    refr();
+    assert_same_as_full_redraw();
+}
+
+void test_scroll_blit_horizontal(void)
+{
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_ROW);
+    lv_refr_now(NULL);
+
+    lv_obj_scroll_by_raw(list, -13, 0);
+    TEST_ASSERT_LESS_THAN_UINT32(lv_area_get_size(&list->coords) / 4, refr());
+    assert_same_as_full_redraw();
+
+    lv_obj_scroll_by_raw(list, 6, 0);
+    refr();
+    assert_same_as_full_redraw();
+}
+
+void test_scroll_blit_double_buffered(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_draw_buf_t * buf1 = lv_display_get_buf_active(disp);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(buf1->header.w, buf1->header.h, buf1->header.cf, buf1->header.stride);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    lv_obj_invalidate(lv_screen_active());
+    refr();
+    lv_obj_invalidate(lv_screen_active());
+    refr();
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_scroll_by_raw(list, 0, -9);
+        TEST_ASSERT_LESS_THAN_UINT32(lv_area_get_size(&list->coords) / 4, refr());
+    }
+
+    /*Refresh a small area to sync the moved pixels to the other buffer too*/
+    lv_area_t a = {700, 400, 709, 409};
+    lv_inv_area(disp, &a);
+    refr();
+
+    /*Both buffers should have the same content as after redrawing everything*/
+    uint32_t size = buf1->header.stride * buf1->header.h;
+    uint8_t * shown_buf = lv_malloc(size);
+    lv_memcpy(shown_buf, buf1->data, size);
+    TEST_ASSERT_EQUAL_MEMORY(buf2->data, shown_buf, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    refr();
+    TEST_ASSERT_EQUAL_MEMORY(buf1->data, shown_buf, size);
+    TEST_ASSERT_EQUAL_MEMORY(buf2->data, shown_buf, size);
+
+    lv_free(shown_buf);
+    lv_display_set_draw_buffers(disp, buf1, NULL);
+    lv_draw_buf_destroy(buf2);
+}
+
+void test_scroll_blit_not_possible(void)
+{
+    int32_t list_size = lv_area_get_size(&list->coords);
+
+    /*A floating child doesn't move*/
+    lv_obj_t * floating = lv_button_create(list);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_align(floating, LV_ALIGN_BOTTOM_MID, 0, 0);
+    refr();
+    lv_obj_scroll_by_raw(list, 0, -10);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(list_size, refr());
+    assert_same_as_full_redraw();
+    lv_obj_delete(floating);
+
+    /*A sibling covers the list*/
+    lv_obj_t * sibling = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(sibling, 100, 100);
+    refr();
+    lv_obj_scroll_by_raw(list, 0, -10);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(list_size, refr());
+    assert_same_as_full_redraw();
+    lv_obj_delete(sibling);
+
+    /*Semi-transparent background*/
+    lv_obj_set_style_bg_opa(list, LV_OPA_50, 0);
+    refr();
+    lv_obj_scroll_by_raw(list, 0, -10);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(list_size, refr());
+    assert_same_as_full_redraw();
+}
+
+#endif
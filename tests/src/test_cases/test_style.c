@@ -141,4 +141,96 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_prop_value_follows_changes(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, lv_color_hex(0xff0000));
+
+    /*Use an own screen as the other tests leave objects with out of scope styles on the active screen*/
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_t * parent1 = lv_obj_create(scr);
+    lv_obj_t * parent2 = lv_obj_create(scr);
+    lv_obj_add_style(parent1, &style, LV_PART_MAIN);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x0000ff), LV_PART_MAIN);
+
+    lv_obj_t * obj = lv_obj_create(parent1);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, LV_PART_MAIN | LV_STATE_CHECKED);
+
+    /*Read the values twice to be sure the second read doesn't return an outdated value*/
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+
+    /*Inherited from a modified style*/
+    lv_style_set_text_color(&style, lv_color_hex(0x00ff00));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+
+    /*Inherited from a new parent*/
+    lv_obj_set_parent(obj, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+
+    /*Own style added, disabled and removed*/
+    lv_obj_add_style(obj, &style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+    lv_obj_style_set_disabled(obj, &style, LV_PART_MAIN, true);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+    lv_obj_style_set_disabled(obj, &style, LV_PART_MAIN, false);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+    lv_obj_remove_style(obj, &style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+
+    /*State changes*/
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    lv_obj_add_state(obj, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL(LV_OPA_70, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    lv_obj_remove_state(obj, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    /*Local style changes and removal*/
+    lv_obj_set_style_bg_opa(obj, LV_OPA_20, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(LV_OPA_20, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_OPA, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    lv_obj_delete(scr);
+    lv_style_reset(&style);
+}
+
+void test_style_prop_cache_invalidated_per_object(void)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_t * parent = lv_obj_create(scr);
+    lv_obj_t * child = lv_obj_create(parent);
+    lv_obj_t * other = lv_obj_create(scr);
+    /*Let the child inherit the text color instead of getting it from the theme*/
+    lv_obj_remove_style_all(child);
+
+    lv_obj_get_style_bg_opa(parent, LV_PART_MAIN);
+    lv_obj_get_style_bg_opa(child, LV_PART_MAIN);
+    lv_obj_get_style_bg_opa(other, LV_PART_MAIN);
+    uint32_t epoch = LV_GLOBAL_DEFAULT()->style_resolved_cache_epoch;
+
+    /*A local style change (e.g. a transition step) affects only the object*/
+    lv_obj_set_style_bg_opa(parent, LV_OPA_50, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_UINT32(epoch, LV_GLOBAL_DEFAULT()->style_resolved_cache_epoch);
+    TEST_ASSERT_NOT_EQUAL_UINT32(epoch, parent->style_resolved_cache->epoch);
+    TEST_ASSERT_EQUAL_UINT32(epoch, child->style_resolved_cache->epoch);
+    TEST_ASSERT_EQUAL_UINT32(epoch, other->style_resolved_cache->epoch);
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(parent, LV_PART_MAIN));
+
+    /*Inherited properties affect the children too*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xff0000), LV_PART_MAIN);
+    TEST_ASSERT_NOT_EQUAL_UINT32(epoch, child->style_resolved_cache->epoch);
+    TEST_ASSERT_EQUAL_UINT32(epoch, other->style_resolved_cache->epoch);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(child, LV_PART_MAIN));
+
+    lv_obj_delete(scr);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_OBJ_STYLE_RESOLVED_CACHE_SIZE");
+#endif
+}
+
 #endif
@@ -0,0 +1,91 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_sysmon_perf_info_t reported;
+static lv_observer_t * observer;
+
+static void perf_observer_cb(lv_observer_t * o, lv_subject_t * subject)
+{
+    LV_UNUSED(o);
+    const lv_sysmon_perf_info_t * info = lv_subject_get_pointer(subject);
+    reported = *info;
+}
+
+void setUp(void)
+{
+    lv_sysmon_show_performance(NULL);
+    observer = lv_subject_add_observer(lv_sysmon_get_performance_subject(NULL), perf_observer_cb, NULL);
+    lv_sysmon_performance_reset_latency(NULL);
+    lv_memzero(&reported, sizeof(reported));
+}
+
+void tearDown(void)
+{
+    lv_observer_remove(observer);
+    lv_sysmon_hide_performance(NULL);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_sysmon_frame_histograms(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(disp);
+    }
+
+    /*A refresh without any invalidated area shouldn't be recorded*/
+    lv_refr_now(disp);
+
+    lv_sysmon_histogram_t * hist = disp->perf_sysmon_info.histograms.stage;
+    for(i = 0; i < LV_SYSMON_STAGE_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(10, hist[i].sample_cnt);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(10, disp->perf_sysmon_info.histograms.draw_unit[0].sample_cnt);
+
+    lv_sysmon_performance_dump(disp);
+    TEST_ASSERT_EQUAL_UINT32(LV_MIN(lv_draw_get_unit_count(), LV_SYSMON_DRAW_UNIT_MAX),
+                             reported.calculated.draw_unit_cnt);
+
+    /*The histograms are kept between the reports*/
+    TEST_ASSERT_EQUAL_UINT32(10, hist[LV_SYSMON_STAGE_FRAME].sample_cnt);
+
+    lv_sysmon_performance_reset_latency(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, hist[LV_SYSMON_STAGE_FRAME].sample_cnt);
+}
+
+void test_sysmon_percentiles(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_sysmon_histogram_t * hist = &disp->perf_sysmon_info.histograms.stage[LV_SYSMON_STAGE_FRAME];
+
+    /*90 frames of 13..16 ms, 9 frames of 34..50 ms and a 70 ms frame*/
+    hist->bucket_cnt[8] = 90;
+    hist->bucket_cnt[12] = 9;
+    hist->bucket_cnt[14] = 1;
+    hist->sample_cnt = 100;
+    hist->max = 70;
+
+    lv_sysmon_performance_dump(disp);
+
+    const lv_sysmon_latency_t * latency = &reported.calculated.stage_latency[LV_SYSMON_STAGE_FRAME];
+    TEST_ASSERT_EQUAL_UINT32(16, latency->p50);
+    TEST_ASSERT_EQUAL_UINT32(50, latency->p95);
+    TEST_ASSERT_EQUAL_UINT32(50, latency->p99);
+    TEST_ASSERT_EQUAL_UINT32(70, latency->max);
+
+    /*An empty histogram gives zeros*/
+    latency = &reported.calculated.stage_latency[LV_SYSMON_STAGE_LAYOUT];
+    TEST_ASSERT_EQUAL_UINT32(0, latency->p50);
+    TEST_ASSERT_EQUAL_UINT32(0, latency->p99);
+    TEST_ASSERT_EQUAL_UINT32(0, latency->max);
+}
+
+#endif
@@ -0,0 +1,239 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TIMER_CNT 8
+
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t run_cnt[TIMER_CNT];
+static uint32_t run_order[TIMER_CNT];
+static uint32_t run_order_cnt;
+
+static void count_cb(lv_timer_t * t)
+{
+    uint32_t i = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(t);
+    run_cnt[i]++;
+    if(run_order_cnt < TIMER_CNT) run_order[run_order_cnt++] = i;
+}
+
+static lv_timer_t * create_timer(uint32_t i, uint32_t period)
+{
+    timers[i] = lv_timer_create(count_cb, period, (void *)(lv_uintptr_t)i);
+    return timers[i];
+}
+
+static void wait(uint32_t ms)
+{
+    while(ms) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        ms--;
+    }
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    lv_memzero(timers, sizeof(timers));
+    lv_memzero(run_cnt, sizeof(run_cnt));
+    run_order_cnt = 0;
+    /*Start from a state where the built-in timers are not ready*/
+    lv_timer_handler();
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        if(timers[i] && timer_exists(timers[i])) lv_timer_delete(timers[i]);
+    }
+}
+
+void test_timer_periods(void)
+{
+    create_timer(0, 10);
+    create_timer(1, 30);
+    create_timer(2, 20);
+
+    wait(60);
+    TEST_ASSERT_EQUAL_UINT32(6, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[2]);
+
+    /*A longer period applies from the last run*/
+    lv_timer_set_period(timers[0], 100);
+    wait(99);
+    TEST_ASSERT_EQUAL_UINT32(6, run_cnt[0]);
+    wait(1);
+    TEST_ASSERT_EQUAL_UINT32(7, run_cnt[0]);
+}
+
+void test_timer_same_time_newer_first(void)
+{
+    create_timer(0, 10);
+    create_timer(1, 10);
+    create_timer(2, 10);
+
+    wait(10);
+    TEST_ASSERT_EQUAL_UINT32(3, run_order_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, run_order[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_order[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_order[2]);
+}
+
+void test_timer_pause_resume_ready(void)
+{
+    create_timer(0, 10);
+    lv_timer_pause(timers[0]);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timers[0]));
+
+    wait(50);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+
+    /*It's already overdue so runs immediately*/
+    lv_timer_resume(timers[0]);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+
+    lv_timer_set_period(timers[0], 1000);
+    lv_timer_ready(timers[0]);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+
+    lv_timer_reset(timers[0]);
+    wait(999);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    wait(1);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[0]);
+}
+
+void test_timer_repeat_count(void)
+{
+    create_timer(0, 10);
+    lv_timer_set_repeat_count(timers[0], 3);
+    create_timer(1, 10);
+    lv_timer_set_repeat_count(timers[1], 2);
+    lv_timer_set_auto_delete(timers[1], false);
+
+    wait(100);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[0]);
+    TEST_ASSERT_FALSE(timer_exists(timers[0]));
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+    TEST_ASSERT_TRUE(timer_exists(timers[1]));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timers[1]));
+
+    /*The timers whose repeat count is over are deleted on the next call, even if not ready*/
+    create_timer(2, 1000);
+    lv_timer_set_repeat_count(timers[2], 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[2]);
+    TEST_ASSERT_FALSE(timer_exists(timers[2]));
+}
+
+static void zero_period_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    /*Even if it's made ready again it shouldn't run again in the same call*/
+    lv_timer_ready(t);
+}
+
+void test_timer_zero_period_runs_once_per_call(void)
+{
+    timers[0] = lv_timer_create(zero_period_cb, 0, (void *)0);
+
+    lv_timer_handler();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+}
+
+static void modify_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    /*Delete an other ready timer, create a ready one and pause a not ready one*/
+    lv_timer_delete(timers[1]);
+    timers[1] = NULL;
+    create_timer(3, 0);
+    lv_timer_set_repeat_count(timers[3], 1);
+    lv_timer_pause(timers[2]);
+}
+
+void test_timer_modify_in_callback(void)
+{
+    create_timer(1, 10);
+    create_timer(2, 15);
+    timers[0] = lv_timer_create(modify_cb, 10, (void *)0);
+    lv_timer_set_repeat_count(timers[0], 1);
+
+    wait(20);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[3]);
+    TEST_ASSERT_FALSE(timer_exists(timers[3]));
+}
+
+void test_timer_time_until_next(void)
+{
+    lv_timer_t * rnd_timers[200];
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        rnd_timers[i] = lv_timer_create(NULL, 5 + lv_rand(0, 300), NULL);
+    }
+
+    uint32_t step;
+    for(step = 0; step < 500; step++) {
+        lv_timer_t * t = rnd_timers[lv_rand(0, 199)];
+        switch(lv_rand(0, 4)) {
+            case 0:
+                lv_timer_pause(t);
+                break;
+            case 1:
+                lv_timer_resume(t);
+                break;
+            case 2:
+                lv_timer_set_period(t, 5 + lv_rand(0, 300));
+                break;
+            case 3:
+                lv_timer_ready(t);
+                break;
+            default:
+                lv_timer_reset(t);
+                break;
+        }
+
+        lv_tick_inc(lv_rand(0, 5));
+        uint32_t time_until_next = lv_timer_handler();
+
+        /*Compare with the smallest remaining time of all the timers*/
+        uint32_t now = lv_tick_get();
+        uint32_t expected = LV_NO_TIMER_READY;
+        lv_timer_t * next = lv_timer_get_next(NULL);
+        while(next) {
+            if(!next->paused) {
+                uint32_t elaps = now - next->last_run;
+                uint32_t remaining = elaps >= next->period ? 0 : next->period - elaps;
+                expected = LV_MIN(expected, remaining);
+            }
+            next = lv_timer_get_next(next);
+        }
+        TEST_ASSERT_EQUAL_UINT32(expected, time_until_next);
+    }
+
+    for(i = 0; i < 200; i++) {
+        lv_timer_delete(rnd_timers[i]);
+    }
+}
+
+#endif
@@ -219,4 +219,224 @@ void test_chart_scatter(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_scatter.png");
 }
 
+/**
+ * Render the chart with polyline draw tasks and again with a draw task per line and point
+ * (it's used when draw task events are sent) and check that the results are the same
+ * except for the anti-aliased pixels around the joints which are blended only once by the polylines
+ * @param ref       reference image of the chart drawn with polylines
+ */
+static void check_polyline_matches(const char * ref)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_SCREENSHOT(ref);
+
+    lv_draw_buf_t * snapshot_polyline = lv_snapshot_take(chart, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_polyline);
+
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_draw_buf_t * snapshot_lines = lv_snapshot_take(chart, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_lines);
+
+    TEST_ASSERT_EQUAL_UINT32(snapshot_lines->data_size, snapshot_polyline->data_size);
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < snapshot_lines->data_size; i += 4) {
+        if(lv_memcmp(&snapshot_lines->data[i], &snapshot_polyline->data[i], 4) != 0) diff_cnt++;
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(snapshot_lines->data_size / 4 / 100, diff_cnt);
+
+    lv_draw_buf_destroy(snapshot_polyline);
+    lv_draw_buf_destroy(snapshot_lines);
+}
+
+void test_chart_line_polyline(void)
+{
+    lv_obj_set_size(chart, 400, 300);
+    lv_obj_center(chart);
+    lv_obj_set_style_line_width(chart, 3, LV_PART_ITEMS);
+
+    lv_chart_set_point_count(chart, 12);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_SECONDARY_Y);
+    lv_chart_set_range(chart, LV_CHART_AXIS_SECONDARY_Y, 0, 50);
+
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        /*Leave gaps to draw more than one polyline per series*/
+        lv_chart_set_next_value(chart, ser1, i == 4 || i == 9 ? LV_CHART_POINT_NONE : (int32_t)((i * 37) % 100));
+        lv_chart_set_next_value(chart, ser2, i == 6 ? LV_CHART_POINT_NONE : (int32_t)((i * 13) % 50));
+    }
+
+    check_polyline_matches("widgets/chart_line_polyline.png");
+
+    /*Also with points having a border, which are drawn with a draw task per point*/
+    lv_obj_remove_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_set_style_border_width(chart, 2, LV_PART_INDICATOR);
+    lv_obj_set_style_border_color(chart, lv_color_black(), LV_PART_INDICATOR);
+    check_polyline_matches("widgets/chart_line_polyline_border.png");
+}
+
+void test_chart_scatter_polyline(void)
+{
+    lv_obj_set_size(chart, 400, 300);
+    lv_obj_center(chart);
+
+    lv_chart_set_type(chart, LV_CHART_TYPE_SCATTER);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_X, 0, 100);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+
+    lv_chart_set_point_count(chart, 8);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_chart_set_next_value2(chart, ser, (int32_t)(i * 13), (int32_t)((i * 41) % 100));
+    }
+
+    check_polyline_matches("widgets/chart_scatter_polyline.png");
+}
+
+/**
+ * Draw a polyline with markers to a canvas
+ * @param canvas        pointer to a canvas
+ * @param as_lines      true: draw a line per segment and a fill per marker instead of a polyline
+ */
+static void draw_polyline_to_canvas(lv_obj_t * canvas, bool as_lines)
+{
+    static const lv_point_precise_t points[] = {{10, 80}, {40, 20}, {70, 60}, {100, 10}, {130, 90}};
+    const uint32_t point_cnt = sizeof(points) / sizeof(points[0]);
+
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    if(as_lines) {
+        lv_draw_line_dsc_t line_dsc;
+        lv_draw_line_dsc_init(&line_dsc);
+        line_dsc.width = 3;
+        line_dsc.color = red_color;
+
+        uint32_t i;
+        for(i = 1; i < point_cnt; i++) {
+            line_dsc.p1 = points[i - 1];
+            line_dsc.p2 = points[i];
+            lv_draw_line(&layer, &line_dsc);
+        }
+
+        lv_draw_fill_dsc_t fill_dsc;
+        lv_draw_fill_dsc_init(&fill_dsc);
+        fill_dsc.radius = LV_RADIUS_CIRCLE;
+        fill_dsc.color = lv_palette_main(LV_PALETTE_BLUE);
+        for(i = 0; i < point_cnt; i++) {
+            lv_area_t marker_area;
+            marker_area.x1 = (int32_t)points[i].x - 4;
+            marker_area.x2 = (int32_t)points[i].x + 4;
+            marker_area.y1 = (int32_t)points[i].y - 4;
+            marker_area.y2 = (int32_t)points[i].y + 4;
+            lv_draw_fill(&layer, &fill_dsc, &marker_area);
+        }
+    }
+    else {
+        lv_draw_polyline_dsc_t dsc;
+        lv_draw_polyline_dsc_init(&dsc);
+        dsc.points = points;
+        dsc.point_cnt = point_cnt;
+        dsc.width = 3;
+        dsc.color = red_color;
+        dsc.marker_w = 4;
+        dsc.marker_h = 4;
+        dsc.marker_radius = LV_RADIUS_CIRCLE;
+        dsc.marker_color = lv_palette_main(LV_PALETTE_BLUE);
+        lv_draw_polyline(&layer, &dsc);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_chart_polyline_not_supported(void)
+{
+    lv_obj_set_size(chart, 400, 300);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 12);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_chart_set_next_value(chart, ser, (int32_t)((i * 37) % 100));
+    }
+
+    LV_DRAW_BUF_DEFINE_STATIC(buf_fallback, 140, 100, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_DEFINE_STATIC(buf_lines, 140, 100, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(buf_fallback);
+    LV_DRAW_BUF_INIT_STATIC(buf_lines);
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+
+    lv_canvas_set_draw_buf(canvas, &buf_lines);
+    draw_polyline_to_canvas(canvas, true);
+
+    /*The chart draws a task per line and point if draw task events are sent*/
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_draw_buf_t * snapshot_lines = lv_snapshot_take(chart, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_lines);
+    lv_obj_remove_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+
+    /*Pretend that there is an other draw unit which might not draw the polylines*/
+    LV_GLOBAL_DEFAULT()->draw_info.unit_cnt++;
+    TEST_ASSERT_FALSE(lv_draw_polyline_is_supported());
+
+    lv_canvas_set_draw_buf(canvas, &buf_fallback);
+    draw_polyline_to_canvas(canvas, false);
+    lv_draw_buf_t * snapshot_fallback = lv_snapshot_take(chart, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_fallback);
+
+    LV_GLOBAL_DEFAULT()->draw_info.unit_cnt--;
+
+    TEST_ASSERT_EQUAL_MEMORY(buf_lines.data, buf_fallback.data, buf_lines.data_size);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_lines->data, snapshot_fallback->data, snapshot_lines->data_size);
+
+    lv_draw_buf_destroy(snapshot_fallback);
+    lv_draw_buf_destroy(snapshot_lines);
+}
+
+void test_chart_polyline_joints_blended_once(void)
+{
+    /*A horizontal and a vertical segment overlapping at the joint*/
+    static const lv_point_precise_t points[] = {{10, 30}, {50, 30}, {50, 55}};
+
+    LV_DRAW_BUF_DEFINE_STATIC(buf, 60, 60, LV_COLOR_FORMAT_XRGB8888);
+    LV_DRAW_BUF_INIT_STATIC(buf);
+    lv_obj_t * canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_draw_buf(canvas, &buf);
+
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+
+        lv_draw_polyline_dsc_t dsc;
+        lv_draw_polyline_dsc_init(&dsc);
+        dsc.points = points;
+        dsc.point_cnt = sizeof(points) / sizeof(points[0]);
+        dsc.width = 8;
+        dsc.color = lv_color_black();
+        dsc.opa = LV_OPA_50;
+        dsc.round_start = round;
+        dsc.round_end = round;
+        lv_draw_polyline(&layer, &dsc);
+
+        lv_canvas_finish_layer(canvas, &layer);
+
+        /*The joint has the same color as the middle of the segments*/
+        lv_color32_t segment = lv_canvas_get_px(canvas, 30, 31);
+        lv_color32_t joint = lv_canvas_get_px(canvas, 48, 31);
+        TEST_ASSERT_LESS_THAN_UINT8(0xff, segment.red);
+        TEST_ASSERT_EQUAL_UINT8(segment.red, joint.red);
+        TEST_ASSERT_EQUAL_UINT8(segment.green, joint.green);
+        TEST_ASSERT_EQUAL_UINT8(segment.blue, joint.blue);
+    }
+}
+
 #endif
@@ -9,7 +9,8 @@ LV_IMAGE_DECLARE(test_arc_bg);
 
 void setUp(void)
 {
-
+    /* The reference images were rendered in one tile */
+    lv_display_set_tile_cnt(NULL, 1);
 }
 
 void tearDown(void)
@@ -708,4 +708,66 @@ void test_label_wrap_mode_clip(void)
     TEST_ASSERT_EQUAL_SCREENSHOT(buf);
 }
 
+void test_label_line_table(void)
+{
+#if LV_LABEL_LINE_TABLE
+    lv_obj_clean(lv_screen_active());
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 200);
+    lv_obj_center(cont);
+
+    lv_obj_t * label1 = lv_label_create(cont);
+    lv_obj_set_width(label1, 200);
+    lv_obj_set_style_text_align(label1, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_set_style_text_line_space(label1, 3, LV_PART_MAIN);
+
+    char buf[2048] = {0};
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_strcat(buf, long_text);
+        lv_strcat(buf, i % 3 ? " " : "\n");
+    }
+    lv_label_set_text(label1, buf);
+    lv_obj_scroll_to_y(cont, 400, LV_ANIM_OFF);
+
+    lv_label_t * lb = (lv_label_t *)label1;
+    TEST_ASSERT_NOT_NULL(lb->lines.text);
+    TEST_ASSERT_GREATER_THAN(20, lb->lines.line_cnt);
+
+    lv_draw_buf_t * snapshot_table = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_table);
+
+    uint32_t char_cnt = lv_text_get_encoded_length(buf);
+    lv_point_t pos_table[64];
+    uint32_t on_table[64];
+    for(i = 0; i < 64; i++) {
+        lv_label_get_letter_pos(label1, i * char_cnt / 64, &pos_table[i]);
+        lv_point_t p = {pos_table[i].x + 2, pos_table[i].y + 2};
+        on_table[i] = lv_label_get_letter_on(label1, &p, false);
+    }
+
+    /*Invalidate the lines to compare with the normal wrapping*/
+    lb->lines.text = NULL;
+
+    lv_draw_buf_t * snapshot_ref = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_ref);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_ref->data, snapshot_table->data, snapshot_ref->data_size);
+
+    for(i = 0; i < 64; i++) {
+        lv_point_t pos;
+        lv_label_get_letter_pos(label1, i * char_cnt / 64, &pos);
+        TEST_ASSERT_EQUAL_INT32(pos.x, pos_table[i].x);
+        TEST_ASSERT_EQUAL_INT32(pos.y, pos_table[i].y);
+        lv_point_t p = {pos.x + 2, pos.y + 2};
+        TEST_ASSERT_EQUAL_UINT32(lv_label_get_letter_on(label1, &p, false), on_table[i]);
+    }
+
+    lv_draw_buf_destroy(snapshot_table);
+    lv_draw_buf_destroy(snapshot_ref);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_LABEL_LINE_TABLE");
+#endif
+}
+
 #endif
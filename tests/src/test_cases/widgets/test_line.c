@@ -13,6 +13,8 @@ static const int32_t final_extra_draw_size = 10U;
 
 void setUp(void)
 {
+    /* The reference images were rendered in one tile */
+    lv_display_set_tile_cnt(NULL, 1);
     active_screen = lv_screen_active();
     line = lv_line_create(active_screen);
 }
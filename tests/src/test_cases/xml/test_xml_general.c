@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 
 #include "unity/unity.h"
 
@@ -365,4 +366,58 @@ void test_xml_complex(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("xml/complex_1.png");
 }
 
+void test_xml_component_compiled_view(void)
+{
+    const char * row_xml =
+        "<component>"
+        "  <api>"
+        "    <prop type=\"string\" name=\"title\" default=\"No title\"/>"
+        "  </api>"
+        "  <view width=\"200\" height=\"content\" flex_flow=\"row\">"
+        "    <lv_obj width=\"content\" height=\"content\">"
+        "      <lv_label text=\"$title\"/>"
+        "    </lv_obj>"
+        "    <lv_label text=\"&lt;&gt;\" x=\"1\" y=\"2\" width=\"50\" height=\"20\" align=\"center\""
+        "        style_text_color=\"0xff0000\" style_bg_color=\"0x00ff00\" style_bg_opa=\"50%\""
+        "        style_pad_left=\"1\" style_pad_right=\"2\" style_pad_top=\"3\" style_pad_bottom=\"4\""
+        "        style_margin_left=\"1\" style_margin_right=\"2\" style_margin_top=\"3\" style_margin_bottom=\"4\""
+        "        style_radius=\"5\"/>"
+        "    <lv_button/>"
+        "  </view>"
+        "</component>";
+
+    lv_xml_component_register_from_data("row", row_xml);
+
+    lv_xml_component_scope_t * scope = lv_xml_component_get_scope("row");
+    TEST_ASSERT_NOT_NULL(scope);
+    /*view, lv_obj, lv_label, lv_label, lv_button*/
+    TEST_ASSERT_EQUAL_UINT32(5, lv_array_size(&scope->view_elements));
+    TEST_ASSERT_EQUAL_UINT32(18, scope->view_max_attr_cnt);
+
+    const char * attrs[] = {
+        "title", "Hello",
+        NULL, NULL,
+    };
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * row = lv_xml_create(lv_screen_active(), "row", i == 1 ? attrs : NULL);
+        TEST_ASSERT_NOT_NULL(row);
+        TEST_ASSERT_EQUAL_UINT32(3, lv_obj_get_child_count(row));
+
+        lv_obj_t * cont = lv_obj_get_child(row, 0);
+        TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_count(cont));
+        TEST_ASSERT_EQUAL_STRING(i == 1 ? "Hello" : "No title", lv_label_get_text(lv_obj_get_child(cont, 0)));
+
+        lv_obj_t * label = lv_obj_get_child(row, 1);
+        TEST_ASSERT_EQUAL_STRING("<>", lv_label_get_text(label));
+        TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_radius(label, 0));
+        TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_count(label));
+
+        TEST_ASSERT_TRUE(lv_obj_check_type(lv_obj_get_child(row, 2), &lv_button_class));
+    }
+
+    lv_xml_component_unregister("row");
+}
+
 #endif
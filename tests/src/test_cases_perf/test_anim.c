@@ -0,0 +1,73 @@
+/* Performance test for running many animations at the same time */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define ANIM_CNT 1000
+
+static int32_t vars[ANIM_CNT];
+static uint32_t completed_cnt;
+
+static void exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void completed_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    completed_cnt++;
+}
+
+void setUp(void)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out
+    };
+
+    /*Like many style transitions started together*/
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_set_values(&a, 0, 255);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_completed_cb(&a, completed_cb);
+        lv_anim_set_path_cb(&a, paths[i % 4]);
+        /*The second half is added to the head of the list and keeps running longer*/
+        lv_anim_set_duration(&a, i < ANIM_CNT / 2 ? 10000 : 20000);
+        lv_anim_start(&a);
+    }
+    completed_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+}
+
+static void anim_step(void)
+{
+    lv_tick_inc(16);
+    lv_anim_refr_now();
+}
+
+static void anim_complete(void)
+{
+    lv_tick_inc(10000);
+    lv_anim_refr_now();
+}
+
+void test_anim_1000_running(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(anim_step, 10, 100);
+}
+
+void test_anim_1000_half_completed_together(void)
+{
+    /*Half of the animations complete in the same round behind the running ones*/
+    TEST_ASSERT_MAX_TIME_ITER(anim_complete, 5, 1);
+    TEST_ASSERT_EQUAL_UINT32(ANIM_CNT / 2, completed_cnt);
+}
+#endif
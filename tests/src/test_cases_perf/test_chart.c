@@ -30,4 +30,26 @@ void test_chart(void)
                              new_point_count);
     }
 }
+
+void test_chart_draw_line_series(void)
+{
+    static const lv_palette_t palettes[] = {LV_PALETTE_RED, LV_PALETTE_BLUE, LV_PALETTE_GREEN, LV_PALETTE_ORANGE};
+
+    lv_obj_set_size(chart, LV_PCT(100), LV_PCT(100));
+    /*Less points than pixels, else only a vertical line is drawn per x coordinate*/
+    lv_chart_set_point_count(chart, 500);
+
+    size_t s;
+    for(s = 0; s < sizeof(palettes) / sizeof(palettes[0]); s++) {
+        lv_chart_series_t * ser = lv_chart_add_series(chart, lv_palette_main(palettes[s]), LV_CHART_AXIS_PRIMARY_Y);
+        uint32_t i;
+        for(i = 0; i < 500; i++) {
+            lv_chart_set_next_value(chart, ser, (int32_t)lv_rand(0, 100));
+        }
+    }
+
+    lv_obj_invalidate(chart);
+    TEST_ASSERT_MAX_TIME(lv_refr_now, 200, NULL);
+}
+
 #endif
@@ -0,0 +1,165 @@
+/* Performance test of the software renderer with many small draw tasks */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include <time.h>
+
+#define FRAME_CNT   10
+
+void setUp(void)
+{
+    /*Create a dashboard like screen with many small widgets*/
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 48; i++) {
+        lv_obj_t * cont = lv_obj_create(scr);
+        lv_obj_set_size(cont, 90, 70);
+        lv_obj_set_style_shadow_width(cont, 10, 0);
+        lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Item %" LV_PRIu32, i);
+
+        lv_obj_t * bar = lv_bar_create(cont);
+        lv_obj_set_size(bar, LV_PCT(100), 8);
+        lv_obj_align(bar, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_bar_set_value(bar, (i * 7) % 100, LV_ANIM_OFF);
+    }
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void refresh(void)
+{
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+}
+
+void test_draw_sw_many_tasks(void)
+{
+#if LV_USE_OS
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u && lv_strcmp(u->name, "SW") != 0) u = u->next;
+    TEST_ASSERT_NOT_NULL(u);
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *)u;
+
+    uint32_t i;
+    uint32_t task_cnt_start[LV_DRAW_SW_DRAW_UNIT_CNT];
+    uint32_t busy_time_start[LV_DRAW_SW_DRAW_UNIT_CNT];
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        task_cnt_start[i] = draw_sw_unit->thread_dscs[i].task_cnt;
+        busy_time_start[i] = draw_sw_unit->thread_dscs[i].busy_time;
+    }
+#endif
+
+    TEST_ASSERT_MAX_TIME(refresh, 50 * FRAME_CNT);
+
+#if LV_USE_OS
+    /*Report how the draw tasks were distributed among the render threads*/
+    uint32_t task_sum = 0;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        task_sum += draw_sw_unit->thread_dscs[i].task_cnt - task_cnt_start[i];
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, task_sum);
+
+    /*The threads steal from each other, so none of them should get less than
+     *a quarter of its fair share of the draw tasks*/
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        uint32_t task_cnt = draw_sw_unit->thread_dscs[i].task_cnt - task_cnt_start[i];
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(task_sum, task_cnt * LV_DRAW_SW_DRAW_UNIT_CNT * 4);
+    }
+
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+#if LV_USE_SYSMON
+        TEST_PRINTF("SW render thread %" LV_PRIu32 "/%d: %" LV_PRIu32 "%% of the draw tasks, busy for %" LV_PRIu32 " ms",
+                    i + 1, LV_DRAW_SW_DRAW_UNIT_CNT, (thread_dsc->task_cnt - task_cnt_start[i]) * 100 / task_sum,
+                    thread_dsc->busy_time - busy_time_start[i]);
+#else
+        TEST_PRINTF("SW render thread %" LV_PRIu32 "/%d: %" LV_PRIu32 "%% of the draw tasks",
+                    i + 1, LV_DRAW_SW_DRAW_UNIT_CNT, (thread_dsc->task_cnt - task_cnt_start[i]) * 100 / task_sum);
+#endif
+    }
+#endif
+}
+
+#if LV_USE_OS
+static uint32_t tick_get_cb(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+#endif
+
+void test_draw_sw_queue_sizes(void)
+{
+#if LV_USE_OS
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u && lv_strcmp(u->name, "SW") != 0) u = u->next;
+    TEST_ASSERT_NOT_NULL(u);
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *)u;
+
+    /*The busy time of the threads is measured with the tick*/
+    lv_tick_get_cb_t tick_cb_ori = lv_tick_get_cb();
+    lv_tick_set_cb(tick_get_cb);
+
+    /*Report how much the render threads are utilized with shorter and longer queues.
+     *Only the number of draw tasks is asserted as the timings depend on the machine.*/
+    uint32_t queue_size = 1;
+    while(1) {
+        draw_sw_unit->queue_size = queue_size;
+
+        uint32_t i;
+        uint32_t task_cnt_start[LV_DRAW_SW_DRAW_UNIT_CNT];
+        uint32_t busy_time_start[LV_DRAW_SW_DRAW_UNIT_CNT];
+        for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            task_cnt_start[i] = draw_sw_unit->thread_dscs[i].task_cnt;
+            busy_time_start[i] = draw_sw_unit->thread_dscs[i].busy_time;
+        }
+
+        uint32_t t = lv_tick_get();
+        refresh();
+        uint32_t elaps = LV_MAX(lv_tick_elaps(t), 1);
+
+        uint32_t task_sum = 0;
+        for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            task_sum += draw_sw_unit->thread_dscs[i].task_cnt - task_cnt_start[i];
+        }
+        TEST_ASSERT_GREATER_THAN_UINT32(0, task_sum);
+
+        TEST_PRINTF("Queue size %" LV_PRIu32 ": %" LV_PRIu32 " ms for %d frames", queue_size, elaps, FRAME_CNT);
+        for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+#if LV_USE_SYSMON
+            TEST_PRINTF("  SW render thread %" LV_PRIu32 "/%d: %" LV_PRIu32 "%% of the draw tasks, %" LV_PRIu32 "%% utilized",
+                        i + 1, LV_DRAW_SW_DRAW_UNIT_CNT, (thread_dsc->task_cnt - task_cnt_start[i]) * 100 / task_sum,
+                        (thread_dsc->busy_time - busy_time_start[i]) * 100 / elaps);
+#else
+            LV_UNUSED(busy_time_start);
+            TEST_PRINTF("  SW render thread %" LV_PRIu32 "/%d: %" LV_PRIu32 "%% of the draw tasks",
+                        i + 1, LV_DRAW_SW_DRAW_UNIT_CNT, (thread_dsc->task_cnt - task_cnt_start[i]) * 100 / task_sum);
+#endif
+        }
+
+        /*Double the queue size up to the configured one*/
+        if(queue_size == LV_DRAW_SW_THREAD_QUEUE_SIZE) break;
+        queue_size = LV_MIN(queue_size * 2, LV_DRAW_SW_THREAD_QUEUE_SIZE);
+    }
+
+    draw_sw_unit->queue_size = LV_DRAW_SW_THREAD_QUEUE_SIZE;
+    lv_tick_set_cb(tick_cb_ori);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_USE_OS");
+#endif
+}
+
+#endif
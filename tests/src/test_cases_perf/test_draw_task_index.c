@@ -0,0 +1,186 @@
+/* Performance test for the dependency check and dispatching of the draw tasks */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define TILE_SIZE           16
+#define TASKS_PER_TILE      4
+
+static lv_layer_t layer;
+
+void setUp(void)
+{
+    lv_area_t area;
+    lv_area_set(&area, 0, 0, lv_display_get_horizontal_resolution(NULL) - 1,
+                lv_display_get_vertical_resolution(NULL) - 1);
+
+    lv_layer_init(&layer);
+    layer.buf_area = area;
+    layer.phy_clip_area = area;
+    layer._clip_area = area;
+}
+
+void tearDown(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+/**
+ * Add draw tasks like a dashboard of small widgets:
+ * a few overlapping draw tasks on each tile of the screen
+ */
+static void add_tasks(uint32_t task_cnt)
+{
+    int32_t hor_res = lv_display_get_horizontal_resolution(NULL);
+    int32_t ver_res = lv_display_get_vertical_resolution(NULL);
+    int32_t tile_per_row = hor_res / TILE_SIZE;
+    int32_t tile_cnt = tile_per_row * (ver_res / TILE_SIZE);
+
+    uint32_t i;
+    for(i = 0; i < task_cnt; i++) {
+        int32_t tile = (i / TASKS_PER_TILE) % tile_cnt;
+        lv_area_t a;
+        a.x1 = (tile % tile_per_row) * TILE_SIZE;
+        a.y1 = (tile / tile_per_row) * TILE_SIZE;
+        a.x2 = a.x1 + TILE_SIZE - 1 - (i % TASKS_PER_TILE);
+        a.y2 = a.y1 + TILE_SIZE - 1 - (i % TASKS_PER_TILE);
+        lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+    }
+}
+
+/*Add draw tasks covering the whole screen, like the backgrounds of stacked screens*/
+static void add_full_screen_tasks(uint32_t task_cnt)
+{
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, lv_display_get_horizontal_resolution(NULL) - 1,
+                lv_display_get_vertical_resolution(NULL) - 1);
+
+    uint32_t i;
+    for(i = 0; i < task_cnt; i++) {
+        lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+    }
+}
+
+/*Collect all the independent draw tasks as the draw units would do it*/
+static uint32_t get_available_tasks(void)
+{
+    uint32_t cnt = 0;
+    lv_draw_task_t * t = NULL;
+    while((t = lv_draw_get_next_available_task(&layer, t, 0)) != NULL) {
+        cnt++;
+    }
+
+    return cnt;
+}
+
+/**
+ * Finish the draw tasks one by one and remove them as the dispatcher would do it
+ * @return  the number of the finished draw tasks
+ */
+static uint32_t dispatch_all(void)
+{
+    /*Only this test should take the draw tasks, not the real draw units*/
+    lv_draw_unit_t * unit_head = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    LV_GLOBAL_DEFAULT()->draw_info.unit_head = NULL;
+
+    uint32_t cnt = 0;
+    while(layer.draw_task_head) {
+        lv_draw_task_t * t = lv_draw_get_next_available_task(&layer, NULL, 0);
+        TEST_ASSERT_NOT_NULL(t);
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        lv_draw_dispatch_layer(NULL, &layer);
+        cnt++;
+    }
+
+    LV_GLOBAL_DEFAULT()->draw_info.unit_head = unit_head;
+
+    return cnt;
+}
+
+static void dispatch_all_cb(void)
+{
+    dispatch_all();
+}
+
+static double measure_dispatch_ms(uint32_t task_cnt, bool full_screen)
+{
+    if(full_screen) add_full_screen_tasks(task_cnt);
+    else add_tasks(task_cnt);
+
+    clock_t t = clock();
+    uint32_t dispatched_cnt = dispatch_all();
+    t = clock() - t;
+
+    /*Each dispatch should finish one draw task and find the next one without getting stuck*/
+    TEST_ASSERT_EQUAL_UINT32(task_cnt, dispatched_cnt);
+
+    return ((double)t * 1000.) / CLOCKS_PER_SEC;
+}
+
+static double measure_ms(uint32_t task_cnt)
+{
+    add_tasks(task_cnt);
+
+    /*The draw tasks of a bin are drawn one by one, but the draw tasks of other bins are still available*/
+    uint32_t available_cnt = get_available_tasks();
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, available_cnt);
+
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_UINT32(available_cnt, get_available_tasks());
+    }
+    t = clock() - t;
+
+    tearDown();
+    return ((double)t * 1000.) / CLOCKS_PER_SEC;
+}
+
+void test_draw_task_dependency_500(void)
+{
+    add_tasks(500);
+    TEST_ASSERT_MAX_TIME_ITER(get_available_tasks, 5, 20);
+}
+
+void test_draw_task_dependency_4000(void)
+{
+    add_tasks(4000);
+    TEST_ASSERT_MAX_TIME_ITER(get_available_tasks, 40, 20);
+}
+
+void test_draw_task_dependency_scaling(void)
+{
+    /*8 times more tasks shouldn't be much more than 8 times slower (a quadratic check would be ~64 times).
+     *The timings depend on the machine, so they are only reported.*/
+    double t_small = measure_ms(500);
+    double t_large = measure_ms(4000);
+    TEST_PRINTF("Dependency check: 500 tasks %f ms, 4000 tasks %f ms", t_small, t_large);
+}
+
+void test_draw_task_dispatch_4000(void)
+{
+    add_tasks(4000);
+    TEST_ASSERT_MAX_TIME(dispatch_all_cb, 80);
+}
+
+void test_draw_task_dispatch_scaling(void)
+{
+    /*Each dispatch should check only the draw tasks without dependencies, not the whole list*/
+    double t_small = measure_dispatch_ms(500, false);
+    double t_large = measure_dispatch_ms(4000, false);
+    TEST_PRINTF("Dispatch: 500 tasks %f ms, 4000 tasks %f ms", t_small, t_large);
+}
+
+void test_draw_task_dispatch_full_screen_scaling(void)
+{
+    /*Adding a draw task shouldn't check all the older draw tasks of its bins*/
+    double t_small = measure_dispatch_ms(500, true);
+    double t_large = measure_dispatch_ms(4000, true);
+    TEST_PRINTF("Dispatch full screen: 500 tasks %f ms, 4000 tasks %f ms", t_small, t_large);
+}
+#endif
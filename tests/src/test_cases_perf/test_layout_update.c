@@ -0,0 +1,74 @@
+/* Performance test for updating the layout of a few objects on screens with many widgets */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+static lv_obj_t * label;
+static uint32_t text_cnt;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/**
+ * Create a grid of cards with a title and a value label on each
+ */
+static void create_cards(uint32_t card_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < card_cnt; i++) {
+        lv_obj_t * card = lv_obj_create(cont);
+        lv_obj_set_size(card, 100, LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(card, LV_FLEX_FLOW_COLUMN);
+        lv_obj_t * title = lv_label_create(card);
+        lv_label_set_text_fmt(title, "Card %" LV_PRIu32, i);
+        lv_obj_t * value = lv_label_create(card);
+        lv_label_set_text(value, "0");
+    }
+
+    /*Update the value in the middle*/
+    label = lv_obj_get_child(lv_obj_get_child(cont, card_cnt / 2), 1);
+    lv_obj_update_layout(cont);
+}
+
+/*Change the text of a label, e.g. a value shown on a dashboard*/
+static void update_label(void)
+{
+    text_cnt++;
+    lv_label_set_text_fmt(label, "%" LV_PRIu32, text_cnt);
+    lv_obj_update_layout(cont);
+}
+
+void test_layout_update_500(void)
+{
+    create_cards(500);
+    TEST_ASSERT_MAX_TIME_ITER(update_label, 1, 100);
+}
+
+void test_layout_update_2000(void)
+{
+    create_cards(2000);
+    TEST_ASSERT_MAX_TIME_ITER(update_label, 1, 100);
+}
+
+void test_layout_update_visited_cnt(void)
+{
+    create_cards(2000);
+    update_label();
+
+    /*Only the label, its card and the container are updated, the other 6000 objects are not visited*/
+    uint32_t visited_cnt = LV_GLOBAL_DEFAULT()->layout_visited_cnt;
+    uint32_t updated_cnt = LV_GLOBAL_DEFAULT()->layout_updated_cnt;
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(10, updated_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(20, visited_cnt);
+}
+#endif
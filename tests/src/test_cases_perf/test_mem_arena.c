@@ -0,0 +1,158 @@
+/* Measure how fast the threads can allocate memory in parallel */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include <time.h>
+
+#define THREAD_CNT  4
+#define ROUND_CNT   20000
+#define BLOCK_CNT   32
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+#if LV_USE_OS
+#define USE_ARENAS (LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_ARENA_CNT)
+
+static uint32_t alloc_cnt[THREAD_CNT];
+
+#if USE_ARENAS
+/*What `lv_malloc()` and `lv_free()` do without the arenas: use the main pool with its global lock*/
+static void * main_pool_malloc(size_t size)
+{
+    lv_tlsf_state_t * tlsf_state = &LV_GLOBAL_DEFAULT()->tlsf_state;
+    lv_mutex_lock(&tlsf_state->mutex);
+    void * p = lv_tlsf_malloc(tlsf_state->tlsf, size);
+    lv_mutex_unlock(&tlsf_state->mutex);
+    return p;
+}
+
+static void main_pool_free(void * p)
+{
+    if(p == NULL) return;
+    lv_tlsf_state_t * tlsf_state = &LV_GLOBAL_DEFAULT()->tlsf_state;
+    lv_mutex_lock(&tlsf_state->mutex);
+    lv_tlsf_free(tlsf_state->tlsf, p);
+    lv_mutex_unlock(&tlsf_state->mutex);
+}
+#endif
+
+static void alloc_thread_cb(void * user_data)
+{
+    uint32_t * cnt = user_data;
+    void * blocks[BLOCK_CNT] = {0};
+    uint32_t i;
+    for(i = 0; i < ROUND_CNT; i++) {
+        uint32_t b = i % BLOCK_CNT;
+        lv_free(blocks[b]);
+        blocks[b] = lv_malloc(16 + (i * 37) % 1024);
+        if(blocks[b]) (*cnt)++;
+    }
+
+    for(i = 0; i < BLOCK_CNT; i++) {
+        lv_free(blocks[i]);
+    }
+}
+
+#if USE_ARENAS
+static void alloc_loop(uint32_t * cnt, void * (*malloc_cb)(size_t), void (*free_cb)(void *))
+{
+    void * blocks[BLOCK_CNT] = {0};
+    uint32_t i;
+    for(i = 0; i < ROUND_CNT; i++) {
+        uint32_t b = i % BLOCK_CNT;
+        if(blocks[b]) free_cb(blocks[b]);
+        blocks[b] = malloc_cb(16 + (i * 37) % 1024);
+        if(blocks[b]) (*cnt)++;
+    }
+
+    for(i = 0; i < BLOCK_CNT; i++) {
+        if(blocks[i]) free_cb(blocks[i]);
+    }
+}
+
+/*Call the core functions directly to measure only the pools and not the logging of `lv_malloc()`*/
+static void arena_thread_cb(void * user_data)
+{
+    alloc_loop(user_data, lv_malloc_core, lv_free_core);
+}
+
+static void main_pool_thread_cb(void * user_data)
+{
+    alloc_loop(user_data, main_pool_malloc, main_pool_free);
+}
+#endif
+
+static void run_in_threads(void (*cb)(void *))
+{
+    lv_thread_t threads[THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        alloc_cnt[i] = 0;
+        lv_thread_init(&threads[i], "alloc", LV_THREAD_PRIO_MID, cb, 8 * 1024, &alloc_cnt[i]);
+    }
+
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+}
+
+static void alloc_in_threads(void)
+{
+    run_in_threads(alloc_thread_cb);
+}
+
+#if USE_ARENAS
+/*Run the threads and return the elapsed (wall clock) time*/
+static uint32_t measure_threads_ms(void (*cb)(void *))
+{
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    run_in_threads(cb);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(ROUND_CNT, alloc_cnt[i]);
+    }
+
+    return (uint32_t)((end.tv_sec - start.tv_sec) * 1000 + (end.tv_nsec - start.tv_nsec) / 1000000);
+}
+#endif
+#endif
+
+void test_mem_contention(void)
+{
+#if LV_USE_OS
+    clock_t t = clock();
+    alloc_in_threads();
+    t = clock() - t;
+    TEST_PRINTF("%d threads did %d allocations each in %d ms CPU time (LV_MEM_THREAD_ARENA_CNT = %d)",
+                THREAD_CNT, ROUND_CNT, (int)(t * 1000 / CLOCKS_PER_SEC), LV_MEM_THREAD_ARENA_CNT);
+
+    TEST_ASSERT_MAX_TIME(alloc_in_threads, 1000);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_USE_OS");
+#endif
+}
+
+void test_mem_arena_vs_main_pool(void)
+{
+#if LV_USE_OS && USE_ARENAS
+    /*Only report the timings: they depend too much on the machine and its load to compare them*/
+    uint32_t arena_ms = measure_threads_ms(arena_thread_cb);
+    uint32_t main_pool_ms = measure_threads_ms(main_pool_thread_cb);
+    TEST_PRINTF("%d threads did %d allocations each in %" LV_PRIu32 " ms with %d arenas and in %" LV_PRIu32
+                " ms with the main pool", THREAD_CNT, ROUND_CNT, arena_ms, LV_MEM_THREAD_ARENA_CNT, main_pool_ms);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_USE_OS, LV_STDLIB_BUILTIN and LV_MEM_THREAD_ARENA_CNT");
+#endif
+}
+
+#endif
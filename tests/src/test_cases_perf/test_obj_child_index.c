@@ -0,0 +1,85 @@
+/* Performance test for refreshing small areas of screens with many widgets */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/**
+ * Create a large grid of buttons like a scrolled tile grid or a long list
+ */
+static void create_buttons(uint32_t btn_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < btn_cnt; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_set_size(btn, 60, 30);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "%" LV_PRIu32, i);
+    }
+
+    /*Scroll to the middle to have invisible children before and after the visible ones*/
+    lv_obj_update_layout(cont);
+    lv_obj_scroll_to_y(cont, lv_obj_get_scroll_bottom(cont) / 2, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+}
+
+/*Redraw a small area in the middle of the screen, e.g. a button which was pressed*/
+static void refr_small_area(void)
+{
+    lv_area_t a;
+    lv_area_set(&a, 100, 100, 159, 129);
+    lv_inv_area(NULL, &a);
+    lv_refr_now(NULL);
+}
+
+static double measure_ms(uint32_t btn_cnt)
+{
+    create_buttons(btn_cnt);
+
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        refr_small_area();
+    }
+    t = clock() - t;
+
+    lv_obj_clean(cont);
+    return ((double)t * 1000.) / CLOCKS_PER_SEC;
+}
+
+void test_obj_child_index_500(void)
+{
+    create_buttons(500);
+    TEST_ASSERT_MAX_TIME_ITER(refr_small_area, 2, 20);
+}
+
+void test_obj_child_index_4000(void)
+{
+    create_buttons(4000);
+    TEST_ASSERT_MAX_TIME_ITER(refr_small_area, 4, 20);
+}
+
+void test_obj_child_index_scaling(void)
+{
+    double t_small = measure_ms(500);
+    double t_large = measure_ms(4000);
+
+    /*With the index the invisible children are not visited,
+     *so 8 times more children shouldn't make the refresh much slower.
+     *The timings depend on the machine, so they are only reported.*/
+    TEST_PRINTF("Refreshing a small area: 500 children %f ms, 4000 children %f ms", t_small, t_large);
+}
+#endif
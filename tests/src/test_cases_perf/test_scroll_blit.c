@@ -0,0 +1,37 @@
+/* Performance test for scrolling a full screen list in direct render mode */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+static lv_obj_t * list;
+
+void setUp(void)
+{
+    list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, LV_PCT(100), LV_PCT(100));
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_list_add_button(list, LV_SYMBOL_FILE, "List item");
+    }
+
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Scroll by a few pixels like in the middle of a scroll animation*/
+static void scroll_and_refr(void)
+{
+    lv_obj_scroll_by_raw(list, 0, -4);
+    lv_refr_now(NULL);
+}
+
+void test_scroll_blit_list(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(scroll_and_refr, 2, 20);
+}
+#endif
@@ -0,0 +1,68 @@
+/* Performance test for calling the timer handler with many timers */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define TIMER_CNT 10000
+
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t run_cnt;
+
+static void timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+    run_cnt++;
+}
+
+void setUp(void)
+{
+    /*Long and different periods, like many widgets polling something*/
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        timers[i] = lv_timer_create(timer_cb, 1000 + lv_rand(0, 9000), NULL);
+    }
+    run_cnt = 0;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+/*Call the handler in every millisecond as a main loop would*/
+static void tick_and_handle(void)
+{
+    lv_tick_inc(1);
+    lv_timer_handler();
+}
+
+static void pause_and_resume(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i += 10) {
+        lv_timer_pause(timers[i]);
+        lv_timer_resume(timers[i]);
+    }
+}
+
+void test_timer_handler_10k(void)
+{
+    /*Most of the calls don't find any ready timers*/
+    TEST_ASSERT_MAX_TIME_ITER(tick_and_handle, 5, 1000);
+
+    /*Run all timers at least once*/
+    uint32_t i;
+    for(i = 0; i < 10000; i++) {
+        tick_and_handle();
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TIMER_CNT, run_cnt);
+}
+
+void test_timer_pause_resume_10k(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(pause_and_resume, 2, 10);
+}
+#endif
@@ -0,0 +1,83 @@
+/* Performance test for creating XML components */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define ROW_CNT     500
+
+static const char * row_xml =
+    "<component>"
+    "  <api>"
+    "    <prop type=\"string\" name=\"title\" default=\"Title\"/>"
+    "    <prop type=\"string\" name=\"value\" default=\"0\"/>"
+    "  </api>"
+    "  <view width=\"100%\" height=\"content\" flex_flow=\"row\" style_pad_all=\"4\">"
+    "    <lv_label text=\"$title\" width=\"120\"/>"
+    "    <lv_bar width=\"100\" height=\"10\" min_value=\"0\" max_value=\"100\"/>"
+    "    <lv_obj width=\"content\" height=\"content\" style_pad_all=\"2\" style_radius=\"4\">"
+    "      <lv_label text=\"$value\"/>"
+    "    </lv_obj>"
+    "  </view>"
+    "</component>";
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    lv_xml_component_register_from_data("row", row_xml);
+    cont = lv_obj_create(lv_screen_active());
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(cont);
+    lv_xml_component_unregister("row");
+}
+
+static void create_rows(void)
+{
+    const char * attrs[] = {
+        "title", "Temperature",
+        "value", "42",
+        NULL, NULL,
+    };
+
+    /*Delete the rows immediately to measure only the creation and not
+     *the growing number of children*/
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_xml_create(cont, "row", attrs);
+        lv_obj_delete(row);
+    }
+}
+
+static double measure_ms(void)
+{
+    clock_t t = clock();
+    create_rows();
+    t = clock() - t;
+
+    return ((double)t * 1000.) / CLOCKS_PER_SEC;
+}
+
+void test_xml_component_create(void)
+{
+    TEST_ASSERT_MAX_TIME(create_rows, 500);
+}
+
+void test_xml_component_create_compiled_vs_parsed(void)
+{
+    double t_compiled = measure_ms();
+
+    /*Hide the compiled view to parse the XML on every creation*/
+    lv_xml_component_scope_t * scope = lv_xml_component_get_scope("row");
+    lv_array_t elements = scope->view_elements;
+    lv_memzero(&scope->view_elements, sizeof(lv_array_t));
+    double t_parsed = measure_ms();
+    scope->view_elements = elements;
+
+    /*Creating the widgets takes most of the time so expect only a small gain.
+     *The timings depend on the machine, so they are only reported.*/
+    TEST_PRINTF("%d rows: compiled %f ms, parsed %f ms", ROW_CNT, t_compiled, t_parsed);
+}
+#endif